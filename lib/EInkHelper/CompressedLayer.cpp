@@ -0,0 +1,74 @@
+#include <CompressedLayer.hpp>
+#include <PackBitsReader.hpp>
+
+namespace {
+constexpr size_t maxPackBitsRun = 128;
+}  // namespace
+
+CompressedLayer::CompressedLayer() : bandOffsets{ 0 }, nrBands{ 0 } {}
+
+void CompressedLayer::clear() { nrBands = 0; }
+
+bool CompressedLayer::appendBand(const uint8_t *rows, uint16_t bytesPerRow, uint8_t nrRows) {
+  if (nrBands >= maxBands) {
+    return false;
+  }
+  // Each row is stored as difference to the row above, which turns vertical lines into runs of zeros.
+  const size_t size = bytesPerRow * nrRows;
+  auto delta = [rows, bytesPerRow](size_t index) -> uint8_t {
+    return index < bytesPerRow ? rows[index] : rows[index] ^ rows[index - bytesPerRow];
+  };
+  size_t output = bandOffsets[nrBands];
+  size_t position = 0;
+  while (position < size) {
+    size_t run = 1;
+    while (position + run < size && run < maxPackBitsRun && delta(position + run) == delta(position)) {
+      run++;
+    }
+    if (run >= 2) {
+      if (output + 2 > capacity) {
+        return false;
+      }
+      data[output++] = 257 - run;
+      data[output++] = delta(position);
+      position += run;
+      continue;
+    }
+    // Collect literal bytes until the next run.
+    size_t literal = 1;
+    while (position + literal < size && literal < maxPackBitsRun &&
+           (position + literal + 1 >= size || delta(position + literal) != delta(position + literal + 1))) {
+      literal++;
+    }
+    if (output + 1 + literal > capacity) {
+      return false;
+    }
+    data[output++] = literal - 1;
+    for (size_t i = 0; i < literal; ++i) {
+      data[output++] = delta(position++);
+    }
+  }
+  nrBands++;
+  bandOffsets[nrBands] = output;
+  return true;
+}
+
+bool CompressedLayer::readBand(uint8_t band, uint8_t *rows, uint16_t bytesPerRow, uint8_t nrRows) const {
+  if (band >= nrBands) {
+    return false;
+  }
+  // The data is in RAM, which PackBitsReader can read just like PROGMEM.
+  PackBitsReader reader(data + bandOffsets[band], bandOffsets[band + 1] - bandOffsets[band]);
+  const size_t size = bytesPerRow * nrRows;
+  if (reader.read(rows, size) != size) {
+    return false;
+  }
+  for (size_t index = bytesPerRow; index < size; ++index) {
+    rows[index] ^= rows[index - bytesPerRow];
+  }
+  return true;
+}
+
+uint8_t CompressedLayer::getNrBands() const { return nrBands; }
+
+size_t CompressedLayer::getSize() const { return bandOffsets[nrBands]; }
@@ -0,0 +1,54 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief A PackBits compressed 1bpp image of the display, stored in bands of rows.
+ *
+ * Every band is compressed on its own, so it can be restored without decoding the bands before it. Rows are stored as
+ * difference to the row above, so repeated rows like the ones crossing vertical lines compress to almost nothing.
+ * Used to restore the static content of the display with a copy instead of drawing it again.
+ */
+class CompressedLayer {
+ public:
+  static constexpr size_t capacity = 2048;
+  static constexpr uint8_t maxBands = 32;
+
+  CompressedLayer();
+
+  /**
+   * @brief Removes all bands.
+   */
+  void clear();
+
+  /**
+   * @brief Compresses and appends a band.
+   *
+   * @return False, if the capacity is exceeded. The band is not added then.
+   */
+  bool appendBand(const uint8_t *rows, uint16_t bytesPerRow, uint8_t nrRows);
+
+  /**
+   * @brief Decodes a band.
+   *
+   * @param band The index of the band.
+   * @param rows Where to decode to.
+   * @param bytesPerRow The size of a row of the band.
+   * @param nrRows The number of rows of the band.
+   * @return False, if there is no such band.
+   */
+  bool readBand(uint8_t band, uint8_t *rows, uint16_t bytesPerRow, uint8_t nrRows) const;
+
+  uint8_t getNrBands() const;
+
+  /**
+   * @brief The size of all compressed bands in bytes.
+   */
+  size_t getSize() const;
+
+ private:
+  uint8_t data[capacity];
+  /// The start of every band within data and the end of the last one.
+  uint16_t bandOffsets[maxBands + 1];
+  uint8_t nrBands;
+};
@@ -0,0 +1,67 @@
+#include <DirtyRegions.hpp>
+#include <DisplayLayout.hpp>
+
+DirtyRegions::DirtyRegions() : regions{}, nrRegions{ 0 } {}
+
+void DirtyRegions::add(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+  const int16_t xAligned = x & ~7;
+  const int16_t xEndAligned = (x + w + 7) & ~7;
+  insert(DisplayRegion{ xAligned, y, static_cast<int16_t>(xEndAligned - xAligned), h });
+}
+
+void DirtyRegions::clear() { nrRegions = 0; }
+
+bool DirtyRegions::isEmpty() const { return nrRegions == 0; }
+
+uint8_t DirtyRegions::size() const { return nrRegions; }
+
+const DisplayRegion &DirtyRegions::operator[](uint8_t index) const { return regions[index]; }
+
+DisplayRegion DirtyRegions::unite(const DisplayRegion &first, const DisplayRegion &second) {
+  const int16_t x0 = first.x < second.x ? first.x : second.x;
+  const int16_t y0 = first.y < second.y ? first.y : second.y;
+  const int16_t x1 = (first.x + first.w) > (second.x + second.w) ? (first.x + first.w) : (second.x + second.w);
+  const int16_t y1 = (first.y + first.h) > (second.y + second.h) ? (first.y + first.h) : (second.y + second.h);
+  return DisplayRegion{ x0, y0, static_cast<int16_t>(x1 - x0), static_cast<int16_t>(y1 - y0) };
+}
+
+bool DirtyRegions::shouldMerge(const DisplayRegion &first, const DisplayRegion &second) {
+  return unite(first, second).area() - first.area() - second.area() <= Layout::maxMergeOverheadArea;
+}
+
+void DirtyRegions::insert(DisplayRegion region) {
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < nrRegions; ++i) {
+      if (shouldMerge(regions[i], region)) {
+        region = unite(regions[i], region);
+        regions[i] = regions[--nrRegions];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  if (nrRegions < maxRegions) {
+    regions[nrRegions++] = region;
+    return;
+  }
+
+  // No slot left. Merge with the region, which grows the least.
+  uint8_t bestIndex = 0;
+  int32_t bestGrowth = INT32_MAX;
+  for (uint8_t i = 0; i < nrRegions; ++i) {
+    const int32_t growth = unite(regions[i], region).area() - regions[i].area();
+    if (growth < bestGrowth) {
+      bestGrowth = growth;
+      bestIndex = i;
+    }
+  }
+  region = unite(regions[bestIndex], region);
+  regions[bestIndex] = regions[--nrRegions];
+  insert(region);
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief A rectangle on the display.
+ */
+struct DisplayRegion {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+
+  int32_t area() const { return static_cast<int32_t>(w) * h; }
+};
+
+/**
+ * @brief Collects the regions of the display, which have been drawn to since the last refresh.
+ *
+ * Regions are aligned to multiples of 8 pixels in x, as the panel transfers whole bytes per row. Nearby regions are
+ * merged, as every windowed update costs one panel refresh.
+ */
+class DirtyRegions {
+ public:
+  static constexpr uint8_t maxRegions = 4;
+
+  DirtyRegions();
+
+  /**
+   * @brief Marks a rectangle as changed.
+   */
+  void add(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  void clear();
+
+  bool isEmpty() const;
+
+  uint8_t size() const;
+
+  const DisplayRegion &operator[](uint8_t index) const;
+
+ private:
+  /**
+   * @brief Returns the smallest region containing both regions.
+   */
+  static DisplayRegion unite(const DisplayRegion &first, const DisplayRegion &second);
+
+  /**
+   * @brief Whether the two regions should rather be refreshed as one.
+   */
+  static bool shouldMerge(const DisplayRegion &first, const DisplayRegion &second);
+
+  /**
+   * @brief Adds the region and merges regions until no further merge is worth it.
+   */
+  void insert(DisplayRegion region);
+
+  DisplayRegion regions[maxRegions];
+  uint8_t nrRegions;
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief The geometry of the meter on a panel of the given size.
+ *
+ * Everything is a compile time constant, so the compiler folds all derived coordinates. The graph and the two
+ * temperature boxes of the info bar grow with the panel, all other sizes are fixed.
+ *
+ * @tparam Width The width of the panel in pixels.
+ * @tparam Height The height of the panel in pixels.
+ * @tparam PageHeight The rows of a page in paged mode. Has to divide Height and be a multiple of chromeBandHeight.
+ */
+template <int16_t Width, int16_t Height, int16_t PageHeight>
+struct DisplayLayout {
+  static constexpr int16_t width = Width;
+  static constexpr int16_t height = Height;
+
+  //----------- Graph -----------
+  static constexpr int16_t x0GraphArea = 20;
+  static constexpr int16_t y0GraphArea = 60;
+  static constexpr int16_t widthGraphArea = Width - 2 * x0GraphArea;
+  static constexpr int16_t heightGraphArea = Height - y0GraphArea;
+  static constexpr int16_t xLastGraphArea = x0GraphArea + widthGraphArea;
+  static constexpr int16_t yLastGraphArea = y0GraphArea + heightGraphArea;
+  /// Defines the initial time that can be represented in the graph. It is doubled, whenever it is exceeded.
+  static constexpr unsigned int maxTimeInMin = 45;
+  /// Defines the maximum temperature that can be represented in the graph.
+  static constexpr unsigned int maxTempInCel = 140;
+  /// Allows setting an offset for the temperature (e.g. starting from 20°C instead of 0°C).
+  static constexpr unsigned int minTempInCel = 20;
+  /**
+   * @brief Sets the number of horizontal lines.
+   *
+   * Based on minTempInCel and maxTempInCel.
+   * E.g.: minTempInCel = 20°C, maxTempInCel = 140°, nrOfHorizontalLines = 5
+   * --> line drawn every 20 °C (40, 60, 80, 100, 120)
+   */
+  static constexpr unsigned int nrOfHorizontalLines = 5;
+  static constexpr unsigned int distanceBetweenHorizontalLines =
+      (maxTempInCel - minTempInCel) / (nrOfHorizontalLines + 1);
+
+  //----------- InfoBar -----------
+  static constexpr int16_t xHeatingOnInfo = 0;
+  static constexpr int16_t widthHeatingOnInfo = 50;
+  static constexpr int16_t widthShotTimer = 100;
+  static constexpr int16_t xHXInfo = xHeatingOnInfo + widthHeatingOnInfo;
+  static constexpr int16_t widthHXInfo = (Width - widthHeatingOnInfo - widthShotTimer) / 2;
+  static constexpr int16_t xSteamInfo = xHXInfo + widthHXInfo;
+  static constexpr int16_t widthSteamInfo = widthHXInfo;
+  static constexpr int16_t xShotTimer = xSteamInfo + widthSteamInfo;
+  static constexpr int16_t heightInfoBar = y0GraphArea;
+  static constexpr int16_t yTextInfoBar = 5;
+  /// The area below the label of an info box, which holds its value.
+  static constexpr int16_t yValueInfoBar = yTextInfoBar + 9;
+  static constexpr int16_t heightValueInfoBar = heightInfoBar - 2 - yValueInfoBar;
+
+  //----------- Refresh -----------
+  /// Merging dirty regions costs transferring this many additional pixels at most, 40 rows of the panel. This is
+  /// cheaper than an additional panel refresh.
+  static constexpr int32_t maxMergeOverheadArea = static_cast<int32_t>(Width) * 40;
+
+  //----------- Buffers -----------
+  /// The rows compressed together in the chrome cache.
+  static constexpr int16_t chromeBandHeight = 12;
+  static constexpr int16_t pageHeight = PageHeight;
+
+  static_assert(Width % 8 == 0, "The panel transfers whole bytes per row");
+  static_assert(Height % PageHeight == 0 && PageHeight % chromeBandHeight == 0,
+                "A page has to consist of whole chrome bands and the panel of whole pages");
+  static_assert(y0GraphArea % chromeBandHeight == 0, "The graph area has to start at a chrome band");
+};
+
+#if defined(EINK_CAPTURE_PANEL)
+// The native tests capture the pushed content instead of driving a panel.
+#include <CapturePanel.hpp>
+#if defined(EINK_PANEL_750)
+using EInkPanel = CapturePanel<640, 384>;
+using Layout = DisplayLayout<EInkPanel::WIDTH, EInkPanel::HEIGHT, 48>;
+#else
+using EInkPanel = CapturePanel<400, 300>;
+using Layout = DisplayLayout<EInkPanel::WIDTH, EInkPanel::HEIGHT, 60>;
+#endif
+#elif defined(EINK_PANEL_750)
+#include <epd/GxEPD2_750.h>  // 7.5" b/w 640x384 (GDEW075T8)
+using EInkPanel = GxEPD2_750;
+using Layout = DisplayLayout<EInkPanel::WIDTH, EInkPanel::HEIGHT, 48>;
+#else
+#include <epd/GxEPD2_420.h>  // 4.2" b/w 400x300 (GDEW042T2)
+using EInkPanel = GxEPD2_420;
+using Layout = DisplayLayout<EInkPanel::WIDTH, EInkPanel::HEIGHT, 60>;
+#endif
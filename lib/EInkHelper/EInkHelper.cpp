@@ -1,6 +1,7 @@
 #include "Arduino.h"
 #include <EInkHelper.hpp>
 #include <Fonts/FreeSerif12pt7b.h>
+#include <PackBitsReader.hpp>
 #include <bootscreen.h>
 #include <stdint.h>
 
@@ -13,178 +14,593 @@ constexpr uint8_t csPin = 5;
 constexpr uint8_t rstPin = 12;
 #endif
 EInkHelper::EInkHelper()
-    : io(SPI, /*CS=D8*/ csPin, /*DC=D3*/ 0, /*RST=D1*/ rstPin),
-      display(io, /*RST=D1*/ 5, /*BUSY=D2*/ 4),
-      x0GraphArea{ 20 },
-      y0GraphArea{ 60 },
-      widthGraphArea{ 360 },
-      heightGraphArea{ 240 },
-      xLastGraphArea(widthGraphArea + x0GraphArea),
-      yLastGraphArea(heightGraphArea + y0GraphArea),
-      maxTimeInMin{ 45 },
-      maxTempInCel{ 140 },
-      minTempInCel{ 20 },
-      nrOfHorizontalLines{ 5 },
-      distanceBetweenHorizontalLines{ (maxTempInCel - minTempInCel) / (nrOfHorizontalLines + 1) },
-      xHeatingOnInfo{ 0 },
-      widthHeatingOnInfo{ 50 },
-      xHXInfo(xHeatingOnInfo + widthHeatingOnInfo),
-      widthHXInfo{ 125 },
-      xSteamInfo(xHXInfo + widthHXInfo),
-      widthSteamInfo{ 125 },
-      xShotTimer(xSteamInfo + widthSteamInfo),
-      widthShotTimer{ 100 },
-      heightInfoBar{ y0GraphArea },
-      yTextInfoBar{ 5 },
-      shotTimerUpdateDelay{ 0 },
+    : epd(/*CS=D8*/ csPin, /*DC=D3*/ 0, /*RST=D1*/ rstPin, /*BUSY=D2*/ 4),
+      display{},
+      graphMapper(Layout::x0GraphArea, Layout::y0GraphArea, Layout::widthGraphArea, Layout::heightGraphArea,
+                  Layout::maxTimeInMin * 60, Layout::minTempInCel, Layout::maxTempInCel),
+      graphEnvelope{},
+      lastGraphRedrawDuration{ 0 },
+      openGraphColumn{ -1 },
+      lastDrawnGraphColumn{ -1 },
+      shownPumpStoppedTime{ 0 },
+      shotMode{ false },
+      shotModeRefreshInterval{ 1000 },
+      shotTimerLagPending{ false },
+      shotTimerLagSum{ 0 },
+      nrShotTimerLags{ 0 },
+      dirtyRegions{},
+      lastRefreshBytes{ 0 },
+      totalRefreshBytes{ 0 },
+      renderedHXTemp{ -1 },
+      renderedSteamTemp{ -1 },
+      renderedTargetSteamTemp{ -1 },
+      renderedShotTimer{ -1 },
+      renderedHeatingStatus{ -1 },
+      widgetCacheHits{ 0 },
+      widgetCacheMisses{ 0 },
+      refreshBusyHandler{ nullptr },
+      refreshAborted{ false },
+      lastRefreshDuration{ 0 },
+      lastRenderDuration{ 0 },
+      lastDiffDuration{ 0 },
       displayWentToSleep{ false } {}
 
-void EInkHelper::clearEntireDisplay() {
-  display.eraseDisplay(false);
-  display.eraseDisplay(true);
-}
-unsigned int EInkHelper::getYForTemp(unsigned int temperature) {
-  int16_t yPosPixel = yLastGraphArea;
-  if (temperature <= minTempInCel) {
-  } else if (temperature >= maxTempInCel) {
-    yPosPixel = y0GraphArea;
+bool EInkHelper::updateRenderedValue(int &renderedValue, int newValue) {
+  const bool changed = renderedValue != newValue;
+  renderedValue = newValue;
+  return changed;
+}
+bool EInkHelper::countWidgetUpdate(bool changed) {
+  if (changed) {
+    widgetCacheMisses++;
   } else {
-    // Lower end - Pxl/°C + y0 offset - temp offset  (NOTE: Inverse calculation)
-    yPosPixel = yLastGraphArea -
-                static_cast<float>(heightGraphArea) / static_cast<float>(maxTempInCel - minTempInCel) * temperature +
-                y0GraphArea - minTempInCel;
+    widgetCacheHits++;
   }
-  return yPosPixel;
+  return changed;
+}
+void EInkHelper::clearEntireDisplay() {
+  epd.clearScreen();
+#ifndef EINK_PAGED_MODE
+  frameDiff.reset(0xFF);
+#endif
 }
-void EInkHelper::drawPixelInGraph(unsigned int timeInSeconds, unsigned int temperature) {
-  const int16_t yPosPixel = getYForTemp(temperature);
+void EInkHelper::addGraphSample(unsigned int timeInSeconds, unsigned int steamTemp, unsigned int hxTemp) {
+  const unsigned long drawStart = micros();
+  if (timeInSeconds >= graphMapper.getMaxTime()) {
+    extendGraphTimeWindow(timeInSeconds);
+  }
+  // Samples are only collected, while their column is open. The column is drawn once, when the next one starts.
+  const uint16_t column = graphMapper.getColumnForTime(timeInSeconds);
+  if (openGraphColumn >= 0 && column != openGraphColumn) {
+    drawGraphColumn(openGraphColumn, lastDrawnGraphColumn);
+    lastDrawnGraphColumn = openGraphColumn;
+  }
+  graphEnvelope.add(column, steamTemp, hxTemp);
+  openGraphColumn = column;
+  renderTimings.add(RenderCall::GraphSample, micros() - drawStart);
+}
+unsigned long EInkHelper::getLastGraphRedrawDuration() const { return lastGraphRedrawDuration; }
+void EInkHelper::extendGraphTimeWindow(unsigned int timeInSeconds) {
+  unsigned int maxTimeInS = graphMapper.getMaxTime();
+  while (timeInSeconds >= maxTimeInS) {
+    maxTimeInS *= 2;
+    graphEnvelope.mergeColumnPairs();
+  }
+  graphMapper.setMaxTime(maxTimeInS);
 
-  int16_t xPosPixel = x0GraphArea;
-  if (timeInSeconds >= maxTimeInMin * 60) {
-    xPosPixel = xLastGraphArea;
-  } else {
-    xPosPixel = static_cast<float>(widthGraphArea) / static_cast<float>(maxTimeInMin) *
-                    (static_cast<float>(timeInSeconds) / 60.0) +
-                x0GraphArea;
+  const unsigned long redrawStart = millis();
+  redrawGraph();
+  lastGraphRedrawDuration = millis() - redrawStart;
+  Serial.printf("Graph time window extended to %u min. Redraw took %lu ms\n", maxTimeInS / 60,
+                lastGraphRedrawDuration);
+}
+void EInkHelper::redrawGraph() {
+  if (!restoreChrome(Layout::y0GraphArea, Layout::yLastGraphArea)) {
+    display.fillRect(Layout::x0GraphArea, Layout::y0GraphArea, Layout::widthGraphArea + 1, Layout::heightGraphArea,
+                     GxEPD_WHITE);
+    drawGraphGrid();
   }
+  lastDrawnGraphColumn = -1;
+  for (uint16_t column = 0; column < graphEnvelope.getNrColumns(); ++column) {
+    if (graphEnvelope[column].hasSamples()) {
+      drawGraphColumn(column, lastDrawnGraphColumn);
+      lastDrawnGraphColumn = column;
+    }
+  }
+  // The open column has been drawn with its samples so far. Draw it again, when it is closed.
+  openGraphColumn = -1;
+  dirtyRegions.add(Layout::x0GraphArea, Layout::y0GraphArea, Layout::widthGraphArea + 1, Layout::heightGraphArea);
+}
+void EInkHelper::drawGraphColumn(uint16_t column, int16_t previousColumn) {
+  const ColumnEnvelope &envelope = graphEnvelope[column];
+  const int16_t x = Layout::x0GraphArea + column;
+  if (previousColumn < 0) {
+    drawTraceColumn(x, envelope.minSteamTemp, envelope.maxSteamTemp, x, envelope.minSteamTemp,
+                    envelope.maxSteamTemp);
+    drawTraceColumn(x, envelope.minHXTemp, envelope.maxHXTemp, x, envelope.minHXTemp, envelope.maxHXTemp);
+    return;
+  }
+  const ColumnEnvelope &previous = graphEnvelope[previousColumn];
+  const int16_t xPrevious = Layout::x0GraphArea + previousColumn;
+  drawTraceColumn(x, envelope.minSteamTemp, envelope.maxSteamTemp, xPrevious, previous.minSteamTemp,
+                  previous.maxSteamTemp);
+  drawTraceColumn(x, envelope.minHXTemp, envelope.maxHXTemp, xPrevious, previous.minHXTemp, previous.maxHXTemp);
+}
+void EInkHelper::drawTraceColumn(int16_t x, uint8_t minTemp, uint8_t maxTemp, int16_t xPrevious,
+                                 uint8_t previousMinTemp, uint8_t previousMaxTemp) {
+  const int16_t yTop = graphMapper.getYForTemp(maxTemp);
+  const int16_t yBottom = graphMapper.getYForTemp(minTemp);
+  display.drawFastVLine(x, yTop, yBottom - yTop + 1, GxEPD_BLACK);
+  dirtyRegions.add(x, yTop, 1, yBottom - yTop + 1);
 
-  display.writePixel(xPosPixel, yPosPixel, GxEPD_BLACK);
+  // Join the spans, if they do not overlap.
+  int16_t yFrom = 0;
+  int16_t yTo = 0;
+  if (maxTemp < previousMinTemp) {
+    yFrom = graphMapper.getYForTemp(previousMinTemp);
+    yTo = yTop;
+  } else if (minTemp > previousMaxTemp) {
+    yFrom = graphMapper.getYForTemp(previousMaxTemp);
+    yTo = yBottom;
+  } else {
+    return;
+  }
+  display.drawLine(xPrevious, yFrom, x, yTo, GxEPD_BLACK);
+  dirtyRegions.add(xPrevious, yFrom < yTo ? yFrom : yTo, x - xPrevious + 1, abs(yTo - yFrom) + 1);
 }
 void EInkHelper::setHeatingStatus(bool heatingOn) {
-  int16_t y0HeatingStatusBox = heightInfoBar / 4;
-  int16_t heightStatusBox = heightInfoBar / 2;
-  int16_t widthStatusBox = widthHeatingOnInfo / 2;
-  int16_t x0HeatingStatusBox = xHeatingOnInfo + widthHeatingOnInfo / 4;
+  if (!countWidgetUpdate(updateRenderedValue(renderedHeatingStatus, heatingOn))) {
+    return;
+  }
+  const unsigned long drawStart = micros();
+  drawHeatingStatus();
+  renderTimings.add(RenderCall::HeatingStatus, micros() - drawStart);
+}
+void EInkHelper::drawHeatingStatus() {
+  if (renderedHeatingStatus < 0) {
+    return;
+  }
+  const bool heatingOn = renderedHeatingStatus;
+  int16_t y0HeatingStatusBox = Layout::heightInfoBar / 4;
+  int16_t heightStatusBox = Layout::heightInfoBar / 2;
+  int16_t widthStatusBox = Layout::widthHeatingOnInfo / 2;
+  int16_t x0HeatingStatusBox = Layout::xHeatingOnInfo + Layout::widthHeatingOnInfo / 4;
   if (heatingOn) {
     display.fillRect(x0HeatingStatusBox, y0HeatingStatusBox, widthStatusBox, heightStatusBox, GxEPD_BLACK);
   } else {
     display.fillRect(x0HeatingStatusBox, y0HeatingStatusBox, widthStatusBox, heightStatusBox, GxEPD_WHITE);
     display.drawRect(x0HeatingStatusBox, y0HeatingStatusBox, widthStatusBox, heightStatusBox, GxEPD_BLACK);
   }
+  dirtyRegions.add(x0HeatingStatusBox, y0HeatingStatusBox, widthStatusBox, heightStatusBox);
 }
 void EInkHelper::setHXTemperature(unsigned int currentHXTemp) {
-  int16_t x0HxTemp = xHXInfo + 2;
-  int16_t y0HxTemp = yTextInfoBar + heightInfoBar / 2;
-  display.fillRect(xHXInfo + 1, yTextInfoBar + 9, widthHXInfo - 2, heightInfoBar - 2 - yTextInfoBar - 9, GxEPD_WHITE);
-  display.setFont(&FreeSerif12pt7b);
-  display.setCursor(x0HxTemp, y0HxTemp);
-  char *output = (char *)malloc(100 * sizeof(char));
-  sprintf(output, "%3d", currentHXTemp);
-  display.print(output);
-  free(output);
-  display.setFont(nullptr);
+  if (!countWidgetUpdate(updateRenderedValue(renderedHXTemp, currentHXTemp))) {
+    return;
+  }
+  const unsigned long drawStart = micros();
+  drawHXTemperature();
+  renderTimings.add(RenderCall::HXTemperature, micros() - drawStart);
 }
-void EInkHelper::setSteamTemperature(unsigned int currentSteamTemp, unsigned int targetSteamTemp) {
-  int16_t x0SteamTemp = xSteamInfo + 2;
-  int16_t y0SteamTemp = yTextInfoBar + heightInfoBar / 2;
-  display.fillRect(xSteamInfo + 1, yTextInfoBar + 9, widthSteamInfo - 2, heightInfoBar - 2 - yTextInfoBar - 9,
+void EInkHelper::drawHXTemperature() {
+  if (renderedHXTemp < 0) {
+    return;
+  }
+  int16_t x0HxTemp = Layout::xHXInfo + 2;
+  int16_t y0HxTemp = Layout::yTextInfoBar + Layout::heightInfoBar / 2;
+  display.fillRect(Layout::xHXInfo + 1, Layout::yValueInfoBar, Layout::widthHXInfo - 2, Layout::heightValueInfoBar,
                    GxEPD_WHITE);
-  display.setFont(&FreeSerif12pt7b);
-  display.setCursor(x0SteamTemp, y0SteamTemp);
-  char *output = (char *)malloc(100 * sizeof(char));
-  sprintf(output, "%3d/%3d", currentSteamTemp, targetSteamTemp);
-  display.print(output);
-  free(output);
-  display.setFont(nullptr);
+  dirtyRegions.add(Layout::xHXInfo + 1, Layout::yValueInfoBar, Layout::widthHXInfo - 2, Layout::heightValueInfoBar);
+  char output[GlyphCache::maxDigits + 1];
+  GlyphCache::formatNumber(output, renderedHXTemp, 3);
+  drawInfoBarText(x0HxTemp, y0HxTemp, output);
 }
-void EInkHelper::setShotTimer(unsigned int timerValueInS) {
-  int16_t x0Timer = xShotTimer + 2;
-  int16_t y0Timer = yTextInfoBar + heightInfoBar / 2;
-  display.fillRect(xShotTimer + 1, yTextInfoBar + 9, widthShotTimer - 2, heightInfoBar - 2 - yTextInfoBar - 9,
-                   GxEPD_WHITE);
+void EInkHelper::setSteamTemperature(unsigned int currentSteamTemp, unsigned int targetSteamTemp) {
+  // Evaluate both, so that both rendered values are up to date.
+  const bool steamTempChanged = updateRenderedValue(renderedSteamTemp, currentSteamTemp);
+  const bool targetSteamTempChanged = updateRenderedValue(renderedTargetSteamTemp, targetSteamTemp);
+  if (!countWidgetUpdate(steamTempChanged || targetSteamTempChanged)) {
+    return;
+  }
+  const unsigned long drawStart = micros();
+  drawSteamTemperature();
+  renderTimings.add(RenderCall::SteamTemperature, micros() - drawStart);
+}
+void EInkHelper::drawSteamTemperature() {
+  if (renderedSteamTemp < 0) {
+    return;
+  }
+  int16_t x0SteamTemp = Layout::xSteamInfo + 2;
+  int16_t y0SteamTemp = Layout::yTextInfoBar + Layout::heightInfoBar / 2;
+  display.fillRect(Layout::xSteamInfo + 1, Layout::yValueInfoBar, Layout::widthSteamInfo - 2,
+                   Layout::heightValueInfoBar, GxEPD_WHITE);
+  dirtyRegions.add(Layout::xSteamInfo + 1, Layout::yValueInfoBar, Layout::widthSteamInfo - 2,
+                   Layout::heightValueInfoBar);
+  // Both numbers and the '/'.
+  char output[2 * GlyphCache::maxDigits + 2];
+  char *end = GlyphCache::formatNumber(output, renderedSteamTemp, 3);
+  *end++ = '/';
+  GlyphCache::formatNumber(end, renderedTargetSteamTemp, 3);
+  drawInfoBarText(x0SteamTemp, y0SteamTemp, output);
+}
+void EInkHelper::setShotTimer(unsigned long timerValueInMs) {
+  const unsigned long steps = timerValueInMs / shotModeRefreshInterval;
+  if (!countWidgetUpdate(updateRenderedValue(renderedShotTimer, steps * shotModeRefreshInterval / 100))) {
+    return;
+  }
+  const unsigned long drawStart = micros();
+  drawShotTimer();
+  renderTimings.add(RenderCall::ShotTimer, micros() - drawStart);
+}
+void EInkHelper::drawShotTimer() {
+  if (renderedShotTimer < 0) {
+    return;
+  }
+  int16_t x0Timer = Layout::xShotTimer + 2;
+  int16_t y0Timer = Layout::yTextInfoBar + Layout::heightInfoBar / 2;
+  display.fillRect(Layout::xShotTimer + 1, Layout::yValueInfoBar, Layout::widthShotTimer - 2,
+                   Layout::heightValueInfoBar, GxEPD_WHITE);
+  // In shot mode, refreshShotTimer() pushes the box right away. Marked, it would be pushed again after the shot.
+  if (!shotMode) {
+    dirtyRegions.add(Layout::xShotTimer + 1, Layout::yValueInfoBar, Layout::widthShotTimer - 2,
+                     Layout::heightValueInfoBar);
+  }
+  // The seconds, '.' and the tenth.
+  char output[GlyphCache::maxDigits + 3];
+  char *end = GlyphCache::formatNumber(output, renderedShotTimer / 10);
+  if (shotModeRefreshInterval < 1000) {
+    *end++ = '.';
+    GlyphCache::formatNumber(end, renderedShotTimer % 10);
+  }
+  drawInfoBarText(x0Timer, y0Timer, output);
+}
+void EInkHelper::drawInfoBarText(int16_t x, int16_t baselineY, const char *text) {
+  if (glyphCache.drawText(display, x, baselineY, text, GxEPD_BLACK) > 0) {
+    return;
+  }
+  // Fallback, if the glyphs could not be cached.
   display.setFont(&FreeSerif12pt7b);
-  display.setCursor(x0Timer, y0Timer);
-  char *output = (char *)malloc(100 * sizeof(char));
-  sprintf(output, "%d", timerValueInS);
-  display.print(output);
-  free(output);
+  display.setCursor(x, baselineY);
+  display.print(text);
   display.setFont(nullptr);
 }
 void EInkHelper::prepareInfoBar() {
   display.setTextColor(GxEPD_BLACK);
-  display.setCursor(xHeatingOnInfo + 2, yTextInfoBar);
+  display.setCursor(Layout::xHeatingOnInfo + 2, Layout::yTextInfoBar);
   display.println("Heating");
-  display.setCursor(xHXInfo + 2, yTextInfoBar);
+  display.setCursor(Layout::xHXInfo + 2, Layout::yTextInfoBar);
   display.println("HX");
-  display.setCursor(xSteamInfo + 2, yTextInfoBar);
+  display.setCursor(Layout::xSteamInfo + 2, Layout::yTextInfoBar);
   display.println("Steam");
-  display.setCursor(xShotTimer + 2, yTextInfoBar);
+  display.setCursor(Layout::xShotTimer + 2, Layout::yTextInfoBar);
   display.println("Timer");
-  display.drawRect(xHeatingOnInfo, 0, widthHeatingOnInfo, heightInfoBar, GxEPD_BLACK);
-  display.drawRect(xHXInfo, 0, widthHXInfo, heightInfoBar, GxEPD_BLACK);
-  display.drawRect(xSteamInfo, 0, widthSteamInfo, heightInfoBar, GxEPD_BLACK);
-  display.drawRect(xShotTimer, 0, widthShotTimer, heightInfoBar, GxEPD_BLACK);
+  display.drawRect(Layout::xHeatingOnInfo, 0, Layout::widthHeatingOnInfo, Layout::heightInfoBar, GxEPD_BLACK);
+  display.drawRect(Layout::xHXInfo, 0, Layout::widthHXInfo, Layout::heightInfoBar, GxEPD_BLACK);
+  display.drawRect(Layout::xSteamInfo, 0, Layout::widthSteamInfo, Layout::heightInfoBar, GxEPD_BLACK);
+  display.drawRect(Layout::xShotTimer, 0, Layout::widthShotTimer, Layout::heightInfoBar, GxEPD_BLACK);
+}
+void EInkHelper::drawChrome() {
+  prepareInfoBar();
+  drawTemperatureLabels();
+  drawGraphGrid();
 }
-void EInkHelper::prepareTemperatureDrawingArea() {
-  // Text:
+void EInkHelper::buildChromeLayer() {
+  bool fits = true;
+  chromeLayer.clear();
+  for (int16_t firstRow = 0; firstRow < Layout::height; firstRow += framePageHeight) {
+#ifdef EINK_PAGED_MODE
+    display.setPage(firstRow);
+#endif
+    display.fillScreen(GxEPD_WHITE);
+    drawChrome();
+    for (int16_t band = 0; fits && band < framePageHeight; band += Layout::chromeBandHeight) {
+      fits = chromeLayer.appendBand(display.getBuffer() + band * display.bytesPerRow, display.bytesPerRow,
+                                    Layout::chromeBandHeight);
+    }
+  }
+#ifdef EINK_PAGED_MODE
+  display.setPage(display.noPage);
+#endif
+  if (fits) {
+    Serial.printf("Chrome cached in %u bytes\n", static_cast<unsigned>(chromeLayer.getSize()));
+  } else {
+    Serial.println("Chrome does not fit into its cache. It is drawn instead.");
+    chromeLayer.clear();
+  }
+}
+bool EInkHelper::restoreChrome(int16_t firstRow, int16_t endRow) {
+  if (chromeLayer.getNrBands() * Layout::chromeBandHeight < Layout::height) {
+    return false;
+  }
+  for (int16_t row = firstRow; row < endRow; row += Layout::chromeBandHeight) {
+    uint8_t *rows = display.getRow(row);
+    if (rows != nullptr) {
+      chromeLayer.readBand(row / Layout::chromeBandHeight, rows, display.bytesPerRow, Layout::chromeBandHeight);
+    }
+  }
+  return true;
+}
+void EInkHelper::drawTemperatureLabels() {
   display.setTextColor(GxEPD_BLACK);
-  display.setCursor(1, y0GraphArea);
+  display.setCursor(1, Layout::y0GraphArea);
   display.println("T/C");
-  display.println(maxTempInCel);
-  display.setCursor(1, yLastGraphArea - 10);
-  display.println(minTempInCel);
-  display.update();
+  display.println(Layout::maxTempInCel);
+  display.setCursor(1, Layout::yLastGraphArea - 10);
+  display.println(Layout::minTempInCel);
 
-  for (unsigned int i = 1; i <= nrOfHorizontalLines; ++i) {
-    const unsigned int yHorizontal = getYForTemp(i * distanceBetweenHorizontalLines + minTempInCel);
-    display.drawLine(x0GraphArea, yHorizontal, xLastGraphArea, yHorizontal, GxEPD_BLACK);
+  for (unsigned int i = 1; i <= Layout::nrOfHorizontalLines; ++i) {
+    const unsigned int yHorizontal =
+        graphMapper.getYForTemp(i * Layout::distanceBetweenHorizontalLines + Layout::minTempInCel);
     display.setCursor(1, yHorizontal);
-    display.println(i * distanceBetweenHorizontalLines + minTempInCel);
+    display.println(i * Layout::distanceBetweenHorizontalLines + Layout::minTempInCel);
+  }
+}
+void EInkHelper::drawGraphGrid() {
+  for (unsigned int i = 1; i <= Layout::nrOfHorizontalLines; ++i) {
+    const unsigned int yHorizontal =
+        graphMapper.getYForTemp(i * Layout::distanceBetweenHorizontalLines + Layout::minTempInCel);
+    display.drawLine(Layout::x0GraphArea, yHorizontal, Layout::xLastGraphArea, yHorizontal, GxEPD_BLACK);
   }
 
-  display.drawRoundRect(x0GraphArea, y0GraphArea, widthGraphArea, heightGraphArea, 10, GxEPD_BLACK);
+  display.drawRoundRect(Layout::x0GraphArea, Layout::y0GraphArea, Layout::widthGraphArea, Layout::heightGraphArea, 10,
+                        GxEPD_BLACK);
 }
 void EInkHelper::drawRandomBootScreen() {
+  const unsigned char *picture = MrBeanFromBottomRight;
+  size_t pictureSize = sizeof(MrBeanFromBottomRight);
   switch (rand() % 3) {
-    case 0: display.drawPicture(MrBeanFromBottomRight, sizeof(MrBeanFromBottomRight)); break;
-    case 1: display.drawPicture(MrBeanAnticipated, sizeof(MrBeanAnticipated)); break;
-    case 2: display.drawPicture(MrBeanSurprised, sizeof(MrBeanSurprised)); break;
+    case 0: break;
+    case 1:
+      picture = MrBeanAnticipated;
+      pictureSize = sizeof(MrBeanAnticipated);
+      break;
+    case 2:
+      picture = MrBeanSurprised;
+      pictureSize = sizeof(MrBeanSurprised);
+      break;
+  }
+  PackBitsReader bootScreen(picture, pictureSize);
+  // The pictures are 400x300. On bigger panels, they are centered on a white screen.
+  constexpr int16_t bootScreenWidth = 400;
+  constexpr int16_t bootScreenHeight = 300;
+  static_assert(Layout::width >= bootScreenWidth && Layout::height >= bootScreenHeight,
+                "The boot screens do not fit the panel");
+  constexpr int16_t x0BootScreen = (Layout::width - bootScreenWidth) / 2 / 8 * 8;
+  constexpr int16_t y0BootScreen = (Layout::height - bootScreenHeight) / 2;
+  // Decode and transfer the picture in bands, so it is never decompressed as a whole.
+  constexpr int16_t bandHeight = 20;
+  uint8_t band[bootScreenWidth / 8 * bandHeight];
+  if (x0BootScreen > 0 || y0BootScreen > 0) {
+    epd.writeScreenBuffer(0xFF);
+  }
+  for (int16_t y = 0; y < bootScreenHeight; y += bandHeight) {
+    const size_t decoded = bootScreen.read(band, sizeof(band));
+    memset(band + decoded, 0xFF, sizeof(band) - decoded);
+    epd.writeImage(band, x0BootScreen, y0BootScreen + y, bootScreenWidth, bandHeight);
   }
+  epd.refresh(false);
 }
 void EInkHelper::goToSleep() {
   if (isDisplayAwake()) {
     clearEntireDisplay();
-    display.powerDown();
+    epd.powerOff();
     displayWentToSleep = true;
   }
 }
 bool EInkHelper::isDisplayAwake() { return !displayWentToSleep; }
-void EInkHelper::setupDisplay() {
-  display.init(115200);  // enable diagnostic output on Serial
-  display.fillScreen(GxEPD_WHITE);
-  clearEntireDisplay();
-  drawRandomBootScreen();
+void EInkHelper::setupDisplay(bool showBootScreen) {
+  epd.init(115200);  // enable diagnostic output on Serial
+  epd.setBusyCallback(onDisplayBusy, this);
+  glyphCache.build(FreeSerif12pt7b);
   display.fillScreen(GxEPD_WHITE);
+  if (showBootScreen) {
+    clearEntireDisplay();
+    drawRandomBootScreen();
+  }
   clearEntireDisplay();
-  prepareInfoBar();
-  prepareTemperatureDrawingArea();
+  buildChromeLayer();
+  dirtyRegions.add(0, 0, Layout::width, Layout::height);
 }
 void EInkHelper::handleShotTimer(bool pumpRunning, const unsigned long &currentMillis,
-                                 const unsigned long &pumpStartedTime) {
-  // Set the shottimer only every second.
-  if (pumpRunning && (currentMillis - shotTimerUpdateDelay) > 1000) {
-    shotTimerUpdateDelay = currentMillis;
-    setShotTimer((currentMillis - pumpStartedTime) / 1000);
+                                 const unsigned long &pumpStartedTime, const unsigned long &pumpStoppedTime) {
+  if (pumpRunning) {
+    if (!shotMode) {
+      shotMode = true;
+      shotTimerLagPending = true;
+    }
+    const int shownShotTimer = renderedShotTimer;
+    setShotTimer(currentMillis - pumpStartedTime);
+    if (renderedShotTimer == shownShotTimer && !shotTimerLagPending) {
+      return;
+    }
+    refreshShotTimer();
+    if (shotTimerLagPending) {
+      shotTimerLagPending = false;
+      const unsigned long lag = millis() - pumpStartedTime;
+      shotTimerLagSum += lag;
+      ++nrShotTimerLags;
+      Serial.printf("Shot timer visible %lu ms after the pump start (average %lu ms over %u shots)\n", lag,
+                    shotTimerLagSum / nrShotTimerLags, nrShotTimerLags);
+    }
+  } else if (shotMode || pumpStoppedTime != shownPumpStoppedTime) {
+    // The seconds counted while running lag behind. The final time is dated by the pump detection.
+    shownPumpStoppedTime = pumpStoppedTime;
+    setShotTimer(pumpStoppedTime - pumpStartedTime);
+    if (shotMode) {
+      refreshShotTimer();
+      shotMode = false;
+    }
+  }
+}
+void EInkHelper::setShotModeRefreshInterval(unsigned long intervalInMs) {
+  shotModeRefreshInterval = intervalInMs > 100 ? intervalInMs : 100;
+}
+bool EInkHelper::isInShotMode() const { return shotMode; }
+void EInkHelper::refreshShotTimer() {
+  const unsigned long refreshStart = micros();
+  DirtyRegions timerRegion;
+  timerRegion.add(Layout::xShotTimer + 1, Layout::yValueInfoBar, Layout::widthShotTimer - 2,
+                  Layout::heightValueInfoBar);
+  // Drawing from the model in paged mode marks regions again. The marked ones are refreshed after the shot.
+  const DirtyRegions markedRegions = dirtyRegions;
+#ifdef EINK_PAGED_MODE
+  pushWindow(timerRegion[0]);
+#else
+  // Pushed in the units of the diff, so that the next updateWindow() does not find the timer changed again.
+  const DisplayRegion pushedRegion = decltype(frameDiff)::align(timerRegion[0]);
+  pushWindow(pushedRegion);
+  frameDiff.takeAsPushed(display.getBuffer(), pushedRegion);
+#endif
+  dirtyRegions = markedRegions;
+  renderTimings.add(RenderCall::ShotTimerRefresh, micros() - refreshStart);
+}
+void EInkHelper::updateWindow() {
+  // Frozen in shot mode, so that refreshing other regions does not delay the shot timer.
+  if (shotMode) {
+    return;
+  }
+  const unsigned long refreshStart = millis();
+  const unsigned long refreshStartInUs = micros();
+  lastRefreshBytes = 0;
+  lastRenderDuration = 0;
+#ifndef EINK_PAGED_MODE
+  // The marked regions are only an estimate of the drawing code. The diff finds what really changed.
+  const unsigned long diffStart = micros();
+  dirtyRegions.clear();
+  frameDiff.findChanges(display.getBuffer(), dirtyRegions);
+  lastDiffDuration = micros() - diffStart;
+#endif
+  // Drawing from the model in paged mode marks regions as dirty again, so work on a copy.
+  const DirtyRegions regionsToPush = dirtyRegions;
+  // The busy handler may abort between the regions. The skipped ones are not shown, but the display is about to be
+  // cleared anyway.
+  for (uint8_t i = 0; i < regionsToPush.size() && !refreshAborted; ++i) {
+    pushWindow(regionsToPush[i]);
+  }
+  refreshAborted = false;
+  totalRefreshBytes += lastRefreshBytes;
+  dirtyRegions.clear();
+  lastRefreshDuration = millis() - refreshStart;
+  renderTimings.add(RenderCall::UpdateWindow, micros() - refreshStartInUs);
+}
+void EInkHelper::printFrameBuffer(Print &output) {
+  output.printf("P4\n%u %u\n", Layout::width, Layout::height);
+  // PBM uses 1 for black, the display 1 for white.
+  uint8_t row[Layout::width / 8];
+#ifdef EINK_PAGED_MODE
+  const DirtyRegions markedRegions = dirtyRegions;
+  const DisplayRegion fullFrame{ 0, 0, Layout::width, Layout::height };
+#endif
+  for (int16_t firstRow = 0; firstRow < Layout::height; firstRow += framePageHeight) {
+#ifdef EINK_PAGED_MODE
+    display.setPage(firstRow);
+    display.fillScreen(GxEPD_WHITE);
+    drawFromModel(fullFrame);
+#endif
+    for (int16_t y = 0; y < framePageHeight; ++y) {
+      for (uint8_t x = 0; x < sizeof(row); ++x) {
+        row[x] = ~display.getBuffer()[y * sizeof(row) + x];
+      }
+      output.write(row, sizeof(row));
+    }
+  }
+#ifdef EINK_PAGED_MODE
+  display.setPage(display.noPage);
+  dirtyRegions = markedRegions;
+#endif
+}
+void EInkHelper::printRenderTimings(Print &output) const {
+  renderTimings.print(output);
+  output.printf("Last update: %lu ms, of which %lu ms drawing pages. Diff took %lu us\n", lastRefreshDuration,
+                lastRenderDuration, lastDiffDuration);
+  output.printf("Transferred bytes: last update %u, total %u\n", lastRefreshBytes, totalRefreshBytes);
+  output.printf("Widget updates: %u unchanged, %u drawn\n", widgetCacheHits, widgetCacheMisses);
+}
+void EInkHelper::pushWindow(const DisplayRegion &markedRegion) {
+  // The marked regions may reach beyond the panel, e.g. by the row of the graph baseline.
+  const int16_t x0 = markedRegion.x > 0 ? markedRegion.x : 0;
+  const int16_t y0 = markedRegion.y > 0 ? markedRegion.y : 0;
+  const int16_t xEnd = markedRegion.x + markedRegion.w;
+  const int16_t yEnd = markedRegion.y + markedRegion.h;
+  const int16_t x1 = xEnd < Layout::width ? xEnd : Layout::width;
+  const int16_t y1 = yEnd < Layout::height ? yEnd : Layout::height;
+  if (x1 <= x0 || y1 <= y0) {
+    return;
+  }
+  const DisplayRegion region{ x0, y0, static_cast<int16_t>(x1 - x0), static_cast<int16_t>(y1 - y0) };
+  writeRegion(region, false);
+  epd.refresh(region.x, region.y, region.w, region.h);
+  writeRegion(region, true);
+  lastRefreshBytes += 2 * (region.w / 8 * region.h);
+}
+void EInkHelper::writeRegion(const DisplayRegion &region, bool again) {
+#ifdef EINK_PAGED_MODE
+  const int16_t yEnd = region.y + region.h;
+  for (int16_t firstRow = region.y - region.y % framePageHeight; firstRow < yEnd; firstRow += framePageHeight) {
+    const unsigned long renderStart = millis();
+    display.setPage(firstRow);
+    display.fillScreen(GxEPD_WHITE);
+    drawFromModel(region);
+    lastRenderDuration += millis() - renderStart;
+
+    // Only transfer the rows of the region within this page.
+    const int16_t y = region.y > firstRow ? region.y : firstRow;
+    const int16_t h = (yEnd < firstRow + framePageHeight ? yEnd : firstRow + framePageHeight) - y;
+    if (again) {
+      epd.writeImagePartAgain(display.getBuffer(), region.x, y - firstRow, Layout::width, framePageHeight,
+                              region.x, y, region.w, h);
+    } else {
+      epd.writeImagePart(display.getBuffer(), region.x, y - firstRow, Layout::width, framePageHeight, region.x, y,
+                         region.w, h);
+    }
+  }
+  display.setPage(display.noPage);
+#else
+  if (again) {
+    epd.writeImagePartAgain(display.getBuffer(), region.x, region.y, Layout::width, Layout::height, region.x,
+                            region.y, region.w, region.h);
+  } else {
+    epd.writeImagePart(display.getBuffer(), region.x, region.y, Layout::width, Layout::height, region.x,
+                       region.y, region.w, region.h);
+  }
+#endif
+}
+void EInkHelper::drawFromModel(const DisplayRegion &region) {
+  if (!restoreChrome(display.getFirstRow(), display.getFirstRow() + framePageHeight)) {
+    drawChrome();
+  }
+  drawHeatingStatus();
+  drawHXTemperature();
+  drawSteamTemperature();
+  drawShotTimer();
+
+  // Only draw the columns, which are within the region or joined to it by a line.
+  const int16_t firstColumn = region.x - Layout::x0GraphArea;
+  const int16_t lastColumn = region.x + region.w - 1 - Layout::x0GraphArea;
+  int16_t previousColumn = -1;
+  for (int16_t column = 0; column <= lastDrawnGraphColumn; ++column) {
+    if (!graphEnvelope[column].hasSamples()) {
+      continue;
+    }
+    if (column >= firstColumn && (previousColumn < 0 ? column : previousColumn) <= lastColumn) {
+      drawGraphColumn(column, previousColumn);
+    }
+    previousColumn = column;
+  }
+}
+void EInkHelper::onDisplayBusy(const void *eInkHelper) {
+  const EInkHelper *helper = static_cast<const EInkHelper *>(eInkHelper);
+  if (helper->refreshBusyHandler != nullptr) {
+    helper->refreshBusyHandler();
   }
+  yield();
 }
-void EInkHelper::updateWindow() { display.updateWindow(0, 0, GxGDEW042T2_WIDTH, GxGDEW042T2_HEIGHT); }
+void EInkHelper::setRefreshBusyHandler(void (*busyHandler)()) { refreshBusyHandler = busyHandler; }
+void EInkHelper::abortRefresh() { refreshAborted = true; }
+unsigned long EInkHelper::getLastRefreshDuration() const { return lastRefreshDuration; }
+unsigned long EInkHelper::getLastRenderDuration() const { return lastRenderDuration; }
+unsigned long EInkHelper::getLastDiffDuration() const { return lastDiffDuration; }
+size_t EInkHelper::getFrameBufferSize() const { return sizeof(display); }
+uint32_t EInkHelper::getLastRefreshBytes() const { return lastRefreshBytes; }
+uint32_t EInkHelper::getTotalRefreshBytes() const { return totalRefreshBytes; }
+uint32_t EInkHelper::getWidgetCacheHits() const { return widgetCacheHits; }
+uint32_t EInkHelper::getWidgetCacheMisses() const { return widgetCacheMisses; }
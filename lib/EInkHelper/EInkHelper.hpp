@@ -1,26 +1,56 @@
 #pragma once
-#include <GxEPD.h>
-#include <GxGDEW042T2/GxGDEW042T2.h>  // 4.2" b/w
-
-#include <GxIO/GxIO.h>
-#include <GxIO/GxIO_SPI/GxIO_SPI.h>
+#include <CompressedLayer.hpp>
+#include <DirtyRegions.hpp>
+#include <DisplayLayout.hpp>
+#include <GlyphCache.hpp>
+#include <GraphEnvelope.hpp>
+#include <FrameBuffer.hpp>
+#include <FrameDiff.hpp>
+#include <GraphMapper.hpp>
+#include <RenderTimings.hpp>
 
+/**
+ * @brief Draws the meter to the e-ink display.
+ *
+ * By default, the whole framebuffer is kept in RAM and widgets are drawn into it, when their values change. With the
+ * build flag EINK_PAGED_MODE, only a page of Layout::pageHeight rows is kept. Widgets then only store their values and
+ * the changed regions are drawn page by page from these values, when the display is updated.
+ *
+ * With the whole framebuffer in RAM, the regions to refresh are found by comparing the framebuffer to the content
+ * pushed last, so any drawing is refreshed correctly. By default, hashes of 40x12 pixel tiles are compared. With the
+ * build flag EINK_DIFF_SHADOW_COPY, a copy of the framebuffer is compared, which is exact to 8 pixels but costs another
+ * framebuffer of RAM.
+ *
+ * The panel is selected with a build flag (see DisplayLayout.hpp), the 4.2" GDEW042T2 by default.
+ */
 class EInkHelper {
  public:
   EInkHelper();
 
   /**
-   * @brief Shows a boot screen and draws all boxes and labels, which are present at any time.
+   * @brief Clears the display and draws all boxes and labels, which are present at any time.
+   *
+   * They are shown with the first updateWindow().
+   *
+   * @param showBootScreen Whether to show a boot screen before. It costs two full refreshes.
    */
-  void setupDisplay();
+  void setupDisplay(bool showBootScreen);
 
   /**
-   * @brief Helper function to draw a pixel within the graph.
+   * @brief Adds the temperatures of a time point to the graph.
+   *
+   * If the time point is beyond the time window of the graph, the window is doubled and the graph is redrawn.
    *
-   * @param timeInSeconds The time point, when that temperature was active.
-   * @param temperature The temperature.
+   * @param timeInSeconds The time point, when those temperatures were active.
+   * @param steamTemp The steam temperature.
+   * @param hxTemp The hx temperature.
    */
-  void drawPixelInGraph(unsigned int timeInSeconds, unsigned int temperature);
+  void addGraphSample(unsigned int timeInSeconds, unsigned int steamTemp, unsigned int hxTemp);
+
+  /**
+   * @brief How long the last redraw of the graph after doubling its time window took.
+   */
+  unsigned long getLastGraphRedrawDuration() const;
 
   /**
    * @brief Updates the symbol indicating, whether the heating is on or not.
@@ -55,41 +85,232 @@ class EInkHelper {
   /**
    * @brief Updates the shot timer.
    *
-   * @param pumpRunning Only update the shot timer, if the pump is still running.
+   * While the pump runs, the shot timer counts the seconds since pumpStartedTime. Once it has stopped, the time from
+   * pumpStartedTime to pumpStoppedTime is shown. These may also be the times of an earlier run, e.g. to restore the
+   * last shot after a pump run, which was no shot.
+   *
+   * While the pump runs, the display is in shot mode: each new step of the shot mode refresh interval is refreshed
+   * right away, but only within the shot timer box. updateWindow() does nothing, so all other regions keep their
+   * content until the pump stops.
+   *
+   * @param pumpRunning Whether the pump is running.
    * @param currentMillis What is the current millis (time point).
    * @param pumpStartedTime When was the pump last started.
+   * @param pumpStoppedTime When did the pump last stop.
+   */
+  void handleShotTimer(bool pumpRunning, const unsigned long &currentMillis, const unsigned long &pumpStartedTime,
+                       const unsigned long &pumpStoppedTime);
+
+  /**
+   * @brief Sets how often the shot timer is refreshed in shot mode. 1000 ms by default.
+   *
+   * The shot timer counts in steps of this interval. Below 1000 ms, it shows tenths of seconds, e.g. 12.5 for 500 ms.
+   * As every step costs a partial refresh of the panel, the interval should not be shorter than such a refresh takes.
+   *
+   * @param intervalInMs The interval. At least 100 ms.
+   */
+  void setShotModeRefreshInterval(unsigned long intervalInMs);
+
+  /**
+   * @brief Whether only the shot timer is refreshed, as the pump is running.
    */
-  void handleShotTimer(bool pumpRunning, const unsigned long &currentMillis, const unsigned long &pumpStartedTime);
+  bool isInShotMode() const;
 
   /**
-   * @brief Refresh all values in the window.
+   * @brief Refresh all regions, which have changed since the last refresh.
    *
    * This has to be called whenever a value, that has been set, shall be visible.
    * The display is not automatically updated, as it is rather slow.
    */
   void updateWindow();
 
+  /**
+   * @brief Sets a function, which is called repeatedly while the display is busy.
+   *
+   * A refresh takes several hundred ms. The handler allows keeping time critical work running in the meantime. It must
+   * not draw anything.
+   */
+  void setRefreshBusyHandler(void (*busyHandler)());
+
+  /**
+   * @brief Skips the regions of the running updateWindow(), which have not been pushed yet.
+   *
+   * May be called from the busy handler, e.g. when the power is lost and the display shall be cleared instead. The
+   * region being refreshed is finished. Called outside of a refresh, it applies to the next updateWindow().
+   */
+  void abortRefresh();
+
+  /**
+   * @brief How long the last updateWindow() took, including transfer and refresh of all regions.
+   */
+  unsigned long getLastRefreshDuration() const;
+
+  /**
+   * @brief How much of the last updateWindow() was spent on drawing the pages. Always 0 without EINK_PAGED_MODE.
+   */
+  unsigned long getLastRenderDuration() const;
+
+  /**
+   * @brief How long finding the changed regions took in the last updateWindow(), in us. Always 0 in paged mode.
+   */
+  unsigned long getLastDiffDuration() const;
+
+  /**
+   * @brief The RAM used for the framebuffer in bytes.
+   */
+  size_t getFrameBufferSize() const;
+
+  /**
+   * @brief Number of framebuffer bytes transferred to the display by the last updateWindow().
+   */
+  uint32_t getLastRefreshBytes() const;
+
+  /**
+   * @brief Number of framebuffer bytes transferred to the display by all updateWindow() calls.
+   */
+  uint32_t getTotalRefreshBytes() const;
+
+  /**
+   * @brief Writes the current content of the display as binary PBM (P4).
+   *
+   * In paged mode, the content is drawn page by page from the current values.
+   */
+  void printFrameBuffer(Print &output);
+
+  /**
+   * @brief Writes the number of calls, average and maximum duration of each drawing entry point, the durations of the
+   * last updateWindow(), the bytes transferred to the display and how many widget updates were skipped.
+   */
+  void printRenderTimings(Print &output) const;
+
+  /**
+   * @brief Number of widget updates skipped, as the value was already shown.
+   */
+  uint32_t getWidgetCacheHits() const;
+
+  /**
+   * @brief Number of widget updates, which had to be drawn.
+   */
+  uint32_t getWidgetCacheMisses() const;
+
  private:
+  /**
+   * @brief Stores the value as rendered.
+   *
+   * @param renderedValue The value currently shown by the widget.
+   * @param newValue The value, which shall be shown.
+   * @return True, if the value differs from the one shown.
+   */
+  bool updateRenderedValue(int &renderedValue, int newValue);
+
+  /**
+   * @brief Counts a widget update as cache hit or miss.
+   *
+   * @param changed Whether any value of the widget changed.
+   * @return changed, i.e. whether the widget has to be drawn.
+   */
+  bool countWidgetUpdate(bool changed);
+
   /**
    * @brief Erases the entire display.
    */
   void clearEntireDisplay();
 
   /**
-   * @brief Helper function to get the Y position of a temperature within the graph.
+   * @brief Transfers a region of the framebuffer and performs a partial refresh of it.
+   *
+   * @param markedRegion The region to refresh. The part outside of the panel is ignored.
+   */
+  void pushWindow(const DisplayRegion &markedRegion);
+
+  /**
+   * @brief Called by the display driver while waiting for the BUSY pin.
+   *
+   * @param eInkHelper The EInkHelper instance.
+   */
+  static void onDisplayBusy(const void *eInkHelper);
+
+  /**
+   * @brief Transfers a region of the framebuffer to the display without refreshing it.
+   *
+   * In paged mode, the region is drawn page by page from the current values before.
+   *
+   * @param region The region to transfer.
+   * @param again Whether the transfer follows a refresh of the region, to update the previous content of the display.
+   */
+  void writeRegion(const DisplayRegion &region, bool again);
+
+  /**
+   * @brief Draws everything shown within the region from the current values.
    *
-   * @param temperature The temperature, for which the y position shall be
-   * evaluated.
-   * @return The y pixel position on the display.
+   * Used in paged mode, where the framebuffer does not keep the content.
+   */
+  void drawFromModel(const DisplayRegion &region);
+
+  /**
+   * @brief Draws the info bar widgets from their rendered values.
+   */
+  void drawHeatingStatus();
+  void drawHXTemperature();
+  void drawSteamTemperature();
+  void drawShotTimer();
+
+  /**
+   * @brief Draws the min/max span of both traces within a graph column and joins them to the previous column.
+   *
+   * @param column The graph column to draw.
+   * @param previousColumn The last drawn column before, or -1 if there is none.
+   */
+  void drawGraphColumn(uint16_t column, int16_t previousColumn);
+
+  /**
+   * @brief Draws the span of one trace within a column and a line to its span in the previous column.
+   *
+   * @param x The x position of the column.
+   * @param minTemp The minimum temperature within the column.
+   * @param maxTemp The maximum temperature within the column.
+   * @param xPrevious The x position of the previous column.
+   * @param previousMinTemp The minimum temperature within the previous column.
+   * @param previousMaxTemp The maximum temperature within the previous column.
+   */
+  void drawTraceColumn(int16_t x, uint8_t minTemp, uint8_t maxTemp, int16_t xPrevious, uint8_t previousMinTemp,
+                       uint8_t previousMaxTemp);
+
+  /**
+   * @brief Doubles the time window of the graph until timeInSeconds fits and redraws the graph.
+   */
+  void extendGraphTimeWindow(unsigned int timeInSeconds);
+
+  /**
+   * @brief Redraws the graph area from the envelope of each column.
    */
-  unsigned int getYForTemp(unsigned int temperature);
+  void redrawGraph();
+
+  /**
+   * @brief Draws the horizontal lines and the frame of the graph.
+   */
+  void drawGraphGrid();
 
   /**
    * @brief Updates the text in the shot timer info bar box.
    *
-   * @param timerValueInS The current shot timer value in seconds.
+   * @param timerValueInMs The current shot timer value. Shown in steps of the shot mode refresh interval.
    */
-  void setShotTimer(unsigned int timerValueInS);
+  void setShotTimer(unsigned long timerValueInMs);
+
+  /**
+   * @brief Transfers and refreshes only the shot timer box.
+   */
+  void refreshShotTimer();
+
+  /**
+   * @brief Draws the text of an info bar box from the glyph cache.
+   *
+   * @param x The left end of the text.
+   * @param baselineY The baseline of the text.
+   * @param text Digits, '/' and ' ' only.
+   */
+  void drawInfoBarText(int16_t x, int16_t baselineY, const char *text);
 
   /**
    * @brief Creates the static parts of the info bar.
@@ -97,52 +318,100 @@ class EInkHelper {
   void prepareInfoBar();
 
   /**
-   * @brief Prepares the graph area and adds the labels.
+   * @brief Draws everything, which is present at any time: info bar boxes and labels, graph grid and its labels.
+   */
+  void drawChrome();
+
+  /**
+   * @brief Draws the chrome once and stores it compressed in chromeLayer. In full mode, the chrome is left drawn.
+   */
+  void buildChromeLayer();
+
+  /**
+   * @brief Copies the chrome from chromeLayer into the rows of the framebuffer. Other content of the rows is lost.
+   *
+   * @param firstRow The first row to restore. Has to be a multiple of Layout::chromeBandHeight.
+   * @param endRow The row behind the last one to restore.
+   * @return False, if the chrome could not be cached. It has to be drawn then.
    */
-  void prepareTemperatureDrawingArea();
+  bool restoreChrome(int16_t firstRow, int16_t endRow);
+
+  /**
+   * @brief Draws the temperature labels left of the graph.
+   */
+  void drawTemperatureLabels();
 
   /**
    * @brief Draws a picture of mr bean while setting up.
    */
   void drawRandomBootScreen();
 
-  GxIO_Class io;
-  GxEPD_Class display;
-
-  const int16_t x0GraphArea;
-  const int16_t y0GraphArea;
-  const int16_t widthGraphArea;
-  const int16_t heightGraphArea;
-  const int16_t xLastGraphArea;  // x0GraphArea + widthGraphArea
-  const int16_t yLastGraphArea;  // y0GraphArea + heightGraphArea
-  /// Defines the total time that can be represented in the graph.
-  const unsigned int maxTimeInMin;
-  /// Defines the maximum temperature that can be represented in the graph.
-  const unsigned int maxTempInCel;
-  /// Allows setting an offset for the temperature (e.g. starting from 20°C instead of 0°C).
-  const unsigned int minTempInCel;
-  /**
-   * @brief Sets the number of horizontal lines.
-   *
-   * Based on minTempInCel and maxTempInCel.
-   * E.g.: minTempInCel = 20°C, maxTempInCel = 140°, nrOfHorizontalLines = 5
-   * --> line drawn every 20 °C (40, 60, 80, 100, 120)
-   */
-  const unsigned int nrOfHorizontalLines;
-  const unsigned int distanceBetweenHorizontalLines;
-
-  //----------- InfoBar -----------
-  const int16_t xHeatingOnInfo;
-  const int16_t widthHeatingOnInfo;
-  const int16_t xHXInfo;
-  const int16_t widthHXInfo;
-  const int16_t xSteamInfo;
-  const int16_t widthSteamInfo;
-  const int16_t xShotTimer;
-  const int16_t widthShotTimer;
-  const int16_t heightInfoBar;
-  const int16_t yTextInfoBar;
-  unsigned long shotTimerUpdateDelay;
+#ifdef EINK_PAGED_MODE
+  /// A page takes 3 KB on the 4.2" panel instead of 15 KB for the whole display.
+  static constexpr int16_t framePageHeight = Layout::pageHeight;
+#else
+  static constexpr int16_t framePageHeight = Layout::height;
+#endif
+
+  EInkPanel epd;
+  /// All drawing is done in here and then transferred to the epd.
+  FrameBuffer<Layout::width, Layout::height, framePageHeight> display;
+  /// The static content of the display. Restored instead of drawn again for every full redraw.
+  CompressedLayer chromeLayer;
+#if defined(EINK_PAGED_MODE)
+  // The framebuffer does not hold the whole content, so the regions marked while drawing are used.
+#elif defined(EINK_DIFF_SHADOW_COPY)
+  ShadowFrameDiff<Layout::width, Layout::height> frameDiff;
+#else
+  TileHashFrameDiff<Layout::width, Layout::height, 40, Layout::chromeBandHeight> frameDiff;
+#endif
+  /// Pre-rendered glyphs of the info bar font.
+  GlyphCache glyphCache;
+
+  /// Maps temperatures and time points to pixels within the graph.
+  GraphMapper graphMapper;
+  /// Min/max of the temperatures per graph column, used to redraw the graph.
+  GraphEnvelope<Layout::widthGraphArea> graphEnvelope;
+  unsigned long lastGraphRedrawDuration;
+  /// The column currently collecting samples, or -1.
+  int16_t openGraphColumn;
+  /// The column drawn last, to join the next one to it, or -1.
+  int16_t lastDrawnGraphColumn;
+
+  /// The stop time of the pump run, whose final time is shown by the shot timer.
+  unsigned long shownPumpStoppedTime;
+  /// Whether the pump is running. Only the shot timer is refreshed meanwhile.
+  bool shotMode;
+  unsigned long shotModeRefreshInterval;
+  /// Whether the first second of the running shot has not been refreshed yet.
+  bool shotTimerLagPending;
+  /// The time from the pump start until its first second was visible, summed over all shots.
+  unsigned long shotTimerLagSum;
+  uint16_t nrShotTimerLags;
+
+  /// The regions drawn to since the last updateWindow(). Replaced by the diff of the framebuffer, if available.
+  DirtyRegions dirtyRegions;
+  uint32_t lastRefreshBytes;
+  uint32_t totalRefreshBytes;
+
+  //----------- Rendered values -----------
+  /// The values currently shown in the info bar. Unchanged values are not drawn again. -1 if nothing is shown yet.
+  int renderedHXTemp;
+  int renderedSteamTemp;
+  int renderedTargetSteamTemp;
+  /// In tenths of seconds.
+  int renderedShotTimer;
+  int renderedHeatingStatus;
+  uint32_t widgetCacheHits;
+  uint32_t widgetCacheMisses;
+  RenderTimings renderTimings;
+
+  void (*refreshBusyHandler)();
+  /// Set by abortRefresh(), cleared after updateWindow() has stopped.
+  bool refreshAborted;
+  unsigned long lastRefreshDuration;
+  unsigned long lastRenderDuration;
+  unsigned long lastDiffDuration;
 
   /**
    * Indicates, whether the display has already been switched off.
@@ -0,0 +1,76 @@
+#pragma once
+#include <Adafruit_GFX.h>
+#include <GxEPD2.h>
+#include <string.h>
+
+/**
+ * @brief 1bpp framebuffer in the format of the e-ink controller (MSB first, 1 = white).
+ *
+ * All drawing is done into this buffer. EInkHelper transfers (parts of) it to the panel. Owning the buffer instead of
+ * using the one of the display driver allows to transfer and compare arbitrary windows of it.
+ *
+ * If PageHeight is smaller than Height, only a page of PageHeight rows is held in RAM. Drawing outside of the selected
+ * page is discarded, so the whole content has to be drawn again for every page.
+ *
+ * @tparam Width The width of the panel in pixels. Has to be a multiple of 8.
+ * @tparam Height The height of the panel in pixels.
+ * @tparam PageHeight The number of rows held in RAM.
+ */
+template <int16_t Width, int16_t Height, int16_t PageHeight = Height>
+class FrameBuffer : public Adafruit_GFX {
+  static_assert(Width % 8 == 0, "The width has to be a multiple of 8");
+  static_assert(PageHeight > 0 && PageHeight <= Height, "The page has to be part of the panel");
+
+ public:
+  static constexpr uint16_t bytesPerRow = Width / 8;
+  static constexpr int16_t pageHeight = PageHeight;
+  /// Selecting this row as first row of the page discards all drawing.
+  static constexpr int16_t noPage = Height;
+
+  FrameBuffer() : Adafruit_GFX(Width, Height), firstRow{ PageHeight == Height ? 0 : noPage } {
+    fillScreen(GxEPD_WHITE);
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    y -= firstRow;
+    if (x < 0 || x >= Width || y < 0 || y >= PageHeight) {
+      return;
+    }
+    uint8_t &pixelByte = buffer[y * bytesPerRow + x / 8];
+    if (color == GxEPD_WHITE) {
+      pixelByte |= 0x80 >> (x % 8);
+    } else {
+      pixelByte &= ~(0x80 >> (x % 8));
+    }
+  }
+
+  void fillScreen(uint16_t color) override { memset(buffer, color == GxEPD_WHITE ? 0xFF : 0x00, sizeof(buffer)); }
+
+  /**
+   * @brief Selects the rows held in RAM. The content of the buffer is kept.
+   *
+   * @param row The first row of the page or noPage.
+   */
+  void setPage(int16_t row) { firstRow = row; }
+
+  int16_t getFirstRow() const { return firstRow; }
+
+  /**
+   * @brief A row of the selected page for direct writing.
+   *
+   * @return nullptr, if the row is not within the page.
+   */
+  uint8_t *getRow(int16_t row) {
+    row -= firstRow;
+    return row >= 0 && row < PageHeight ? buffer + row * bytesPerRow : nullptr;
+  }
+
+  /**
+   * @brief The content of the selected page. Its first byte is the left end of getFirstRow().
+   */
+  const uint8_t *getBuffer() const { return buffer; }
+
+ private:
+  int16_t firstRow;
+  alignas(4) uint8_t buffer[bytesPerRow * PageHeight];
+};
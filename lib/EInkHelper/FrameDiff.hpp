@@ -0,0 +1,211 @@
+#pragma once
+#include <DirtyRegions.hpp>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Finds the changed regions of a framebuffer by comparing it to a copy of the content pushed last.
+ *
+ * The buffers are compared 32 bit at a time. Only differing words are examined byte by byte, so the changed columns
+ * are exact to 8 pixels. Consecutive changed rows are combined into one region. Costs a second framebuffer of RAM.
+ *
+ * @tparam Width The width of the panel in pixels. Has to be a multiple of 8.
+ * @tparam Height The height of the panel in pixels.
+ */
+template <int16_t Width, int16_t Height>
+class ShadowFrameDiff {
+ public:
+  static constexpr uint16_t bytesPerRow = Width / 8;
+  static constexpr size_t bufferSize = bytesPerRow * Height;
+  static_assert(Width % 8 == 0, "The width has to be a multiple of 8");
+  static_assert(bufferSize % 4 == 0, "The buffer is compared in 32 bit words");
+
+  ShadowFrameDiff() { reset(0xFF); }
+
+  /**
+   * @brief Sets the content of the display, e.g. after it has been cleared.
+   */
+  void reset(uint8_t fill) { memset(shadow, fill, bufferSize); }
+
+  /**
+   * @brief Adds the regions, which differ from the content pushed last, and takes the buffer as pushed.
+   *
+   * @param buffer The framebuffer. Has to be 4 byte aligned.
+   * @param regions Where to add the changed regions.
+   */
+  void findChanges(const uint8_t *buffer, DirtyRegions &regions) {
+    // Column bytes of the first and last change per row. firstChanged > lastChanged marks an unchanged row.
+    uint8_t firstChanged[Height];
+    uint8_t lastChanged[Height];
+    memset(firstChanged, 0xFF, sizeof(firstChanged));
+    memset(lastChanged, 0, sizeof(lastChanged));
+
+    const uint32_t *words = reinterpret_cast<const uint32_t *>(buffer);
+    uint32_t *shadowWords = reinterpret_cast<uint32_t *>(shadow);
+    for (size_t word = 0; word < bufferSize / 4; ++word) {
+      if ((words[word] ^ shadowWords[word]) == 0) {
+        continue;
+      }
+      for (size_t index = word * 4; index < word * 4 + 4; ++index) {
+        if (buffer[index] != shadow[index]) {
+          const uint16_t row = index / bytesPerRow;
+          const uint8_t column = index % bytesPerRow;
+          if (column < firstChanged[row]) firstChanged[row] = column;
+          if (column > lastChanged[row]) lastChanged[row] = column;
+        }
+      }
+      shadowWords[word] = words[word];
+    }
+
+    int16_t firstRow = -1;
+    uint8_t firstColumn = 0;
+    uint8_t lastColumn = 0;
+    for (int16_t row = 0; row <= Height; ++row) {
+      if (row < Height && firstChanged[row] <= lastChanged[row]) {
+        if (firstRow < 0) {
+          firstRow = row;
+          firstColumn = firstChanged[row];
+          lastColumn = lastChanged[row];
+        } else {
+          if (firstChanged[row] < firstColumn) firstColumn = firstChanged[row];
+          if (lastChanged[row] > lastColumn) lastColumn = lastChanged[row];
+        }
+      } else if (firstRow >= 0) {
+        regions.add(firstColumn * 8, firstRow, (lastColumn - firstColumn + 1) * 8, row - firstRow);
+        firstRow = -1;
+      }
+    }
+  }
+
+  /**
+   * @brief Widens the region to whole bytes, the unit of the comparison.
+   */
+  static DisplayRegion align(const DisplayRegion &region) {
+    const int16_t x = region.x & ~7;
+    return DisplayRegion{ x, region.y, static_cast<int16_t>(((region.x + region.w + 7) & ~7) - x), region.h };
+  }
+
+  /**
+   * @brief Takes the content of the region as pushed, e.g. after it has been refreshed outside of findChanges().
+   *
+   * @param buffer The framebuffer.
+   * @param region The pushed region. Has to be aligned by align().
+   */
+  void takeAsPushed(const uint8_t *buffer, const DisplayRegion &region) {
+    for (int16_t y = region.y; y < region.y + region.h; ++y) {
+      const size_t offset = y * bytesPerRow + region.x / 8;
+      memcpy(shadow + offset, buffer + offset, region.w / 8);
+    }
+  }
+
+ private:
+  alignas(4) uint8_t shadow[bufferSize];
+};
+
+/**
+ * @brief Finds the changed regions of a framebuffer by comparing hashes of its tiles.
+ *
+ * Needs only 4 bytes per tile instead of a copy of the framebuffer, but every tile has to be hashed for each call and
+ * changes are only exact to a tile. Changed tiles next to each other within a row of tiles are combined into one
+ * region. A change is missed, if the hash of the tile does not change (about 1 in 4 billion).
+ *
+ * @tparam Width The width of the panel in pixels.
+ * @tparam Height The height of the panel in pixels.
+ * @tparam TileWidth The width of a tile in pixels. Has to be a multiple of 8 and divide Width.
+ * @tparam TileHeight The height of a tile in pixels. Has to divide Height.
+ */
+template <int16_t Width, int16_t Height, int16_t TileWidth = 40, int16_t TileHeight = 10>
+class TileHashFrameDiff {
+ public:
+  static constexpr uint16_t bytesPerRow = Width / 8;
+  static constexpr uint8_t bytesPerTileRow = TileWidth / 8;
+  static constexpr uint8_t nrTileColumns = Width / TileWidth;
+  static constexpr uint8_t nrTileRows = Height / TileHeight;
+  static_assert(TileWidth % 8 == 0 && Width % TileWidth == 0, "Tiles have to cover whole bytes of the width");
+  static_assert(Height % TileHeight == 0, "Tiles have to cover the height");
+
+  TileHashFrameDiff() { reset(0xFF); }
+
+  /**
+   * @brief Sets the content of the display, e.g. after it has been cleared.
+   */
+  void reset(uint8_t fill) {
+    uint32_t hash = initialHash;
+    for (uint16_t i = 0; i < bytesPerTileRow * TileHeight; ++i) {
+      hash = (hash ^ fill) * hashPrime;
+    }
+    for (uint16_t tile = 0; tile < nrTileColumns * nrTileRows; ++tile) {
+      hashes[tile] = hash;
+    }
+  }
+
+  /**
+   * @brief Adds the regions, which differ from the content pushed last, and takes the buffer as pushed.
+   *
+   * @param buffer The framebuffer.
+   * @param regions Where to add the changed regions.
+   */
+  void findChanges(const uint8_t *buffer, DirtyRegions &regions) {
+    for (uint8_t tileRow = 0; tileRow < nrTileRows; ++tileRow) {
+      int16_t firstChanged = -1;
+      int16_t lastChanged = -1;
+      for (uint8_t tileColumn = 0; tileColumn < nrTileColumns; ++tileColumn) {
+        const uint32_t hash = hashTile(buffer, tileColumn, tileRow);
+        uint32_t &storedHash = hashes[tileRow * nrTileColumns + tileColumn];
+        if (hash != storedHash) {
+          storedHash = hash;
+          if (firstChanged < 0) firstChanged = tileColumn;
+          lastChanged = tileColumn;
+        }
+      }
+      if (firstChanged >= 0) {
+        regions.add(firstChanged * TileWidth, tileRow * TileHeight, (lastChanged - firstChanged + 1) * TileWidth,
+                    TileHeight);
+      }
+    }
+  }
+
+  /**
+   * @brief Widens the region to whole tiles, the unit of the comparison.
+   */
+  static DisplayRegion align(const DisplayRegion &region) {
+    const int16_t x = region.x / TileWidth * TileWidth;
+    const int16_t y = region.y / TileHeight * TileHeight;
+    const int16_t xEnd = (region.x + region.w + TileWidth - 1) / TileWidth * TileWidth;
+    const int16_t yEnd = (region.y + region.h + TileHeight - 1) / TileHeight * TileHeight;
+    return DisplayRegion{ x, y, static_cast<int16_t>(xEnd - x), static_cast<int16_t>(yEnd - y) };
+  }
+
+  /**
+   * @brief Takes the content of the region as pushed, e.g. after it has been refreshed outside of findChanges().
+   *
+   * @param buffer The framebuffer.
+   * @param region The pushed region. Has to be aligned by align().
+   */
+  void takeAsPushed(const uint8_t *buffer, const DisplayRegion &region) {
+    for (int16_t y = region.y; y < region.y + region.h; y += TileHeight) {
+      for (int16_t x = region.x; x < region.x + region.w; x += TileWidth) {
+        hashes[y / TileHeight * nrTileColumns + x / TileWidth] = hashTile(buffer, x / TileWidth, y / TileHeight);
+      }
+    }
+  }
+
+ private:
+  /// FNV-1a
+  static constexpr uint32_t initialHash = 2166136261u;
+  static constexpr uint32_t hashPrime = 16777619u;
+
+  static uint32_t hashTile(const uint8_t *buffer, uint8_t tileColumn, uint8_t tileRow) {
+    uint32_t hash = initialHash;
+    const uint8_t *row = buffer + tileRow * TileHeight * bytesPerRow + tileColumn * bytesPerTileRow;
+    for (int16_t y = 0; y < TileHeight; ++y, row += bytesPerRow) {
+      for (uint8_t x = 0; x < bytesPerTileRow; ++x) {
+        hash = (hash ^ row[x]) * hashPrime;
+      }
+    }
+    return hash;
+  }
+
+  uint32_t hashes[nrTileColumns * nrTileRows];
+};
@@ -0,0 +1,91 @@
+#include <GlyphCache.hpp>
+#include <string.h>
+
+GlyphCache::GlyphCache() : isBuilt{ false }, ascent{ 0 }, glyphHeight{ 0 }, xAdvance{}, bitmaps{} {}
+
+bool GlyphCache::build(const GFXfont &font) {
+  const uint8_t *fontBitmap = static_cast<const uint8_t *>(pgm_read_ptr(&font.bitmap));
+  const GFXglyph *fontGlyphs = static_cast<const GFXglyph *>(pgm_read_ptr(&font.glyph));
+  const uint16_t firstChar = pgm_read_word(&font.first);
+  const uint16_t lastChar = pgm_read_word(&font.last);
+
+  // First pass: The common ascent and height of all cached glyphs.
+  int16_t maxAscent = 0;
+  int16_t maxDescent = 0;
+  for (uint8_t i = 0; i < nrCachedChars; ++i) {
+    const uint8_t character = cachedChars[i];
+    if (character < firstChar || character > lastChar) {
+      return false;
+    }
+    const GFXglyph *glyph = &fontGlyphs[character - firstChar];
+    const int8_t yOffset = pgm_read_byte(&glyph->yOffset);
+    const uint8_t height = pgm_read_byte(&glyph->height);
+    const int8_t xOffset = pgm_read_byte(&glyph->xOffset);
+    const uint8_t width = pgm_read_byte(&glyph->width);
+    if (xOffset < 0 || xOffset + width > maxGlyphWidth) {
+      return false;
+    }
+    if (-yOffset > maxAscent) {
+      maxAscent = -yOffset;
+    }
+    if (yOffset + height > maxDescent) {
+      maxDescent = yOffset + height;
+    }
+  }
+  if (maxAscent + maxDescent > maxGlyphHeight) {
+    return false;
+  }
+  ascent = maxAscent;
+  glyphHeight = maxAscent + maxDescent;
+
+  // Second pass: Unpack the bit stream of each glyph into rows of whole bytes.
+  memset(bitmaps, 0, sizeof(bitmaps));
+  for (uint8_t i = 0; i < nrCachedChars; ++i) {
+    const GFXglyph *glyph = &fontGlyphs[static_cast<uint8_t>(cachedChars[i]) - firstChar];
+    const uint16_t bitmapOffset = pgm_read_word(&glyph->bitmapOffset);
+    const uint8_t width = pgm_read_byte(&glyph->width);
+    const uint8_t height = pgm_read_byte(&glyph->height);
+    const int8_t xOffset = pgm_read_byte(&glyph->xOffset);
+    const int8_t yOffset = pgm_read_byte(&glyph->yOffset);
+    xAdvance[i] = pgm_read_byte(&glyph->xAdvance);
+
+    uint16_t bitIndex = 0;
+    for (uint8_t row = 0; row < height; ++row) {
+      const uint8_t cellRow = ascent + yOffset + row;
+      for (uint8_t column = 0; column < width; ++column, ++bitIndex) {
+        if (pgm_read_byte(&fontBitmap[bitmapOffset + bitIndex / 8]) & (0x80 >> (bitIndex % 8))) {
+          const uint8_t cellColumn = xOffset + column;
+          bitmaps[i][cellRow * bytesPerRow + cellColumn / 8] |= 0x80 >> (cellColumn % 8);
+        }
+      }
+    }
+  }
+  isBuilt = true;
+  return true;
+}
+
+char *GlyphCache::formatNumber(char *buffer, unsigned int value, uint8_t minWidth) {
+  char digits[maxDigits];
+  uint8_t nrDigits = 0;
+  do {
+    digits[nrDigits++] = '0' + value % 10;
+    value /= 10;
+  } while (value != 0);
+
+  for (uint8_t i = nrDigits; i < minWidth; ++i) {
+    *buffer++ = ' ';
+  }
+  while (nrDigits > 0) {
+    *buffer++ = digits[--nrDigits];
+  }
+  *buffer = '\0';
+  return buffer;
+}
+
+int8_t GlyphCache::getCacheIndex(char character) {
+  if (character >= '0' && character <= '9') {
+    return character - '0';
+  }
+  const char *found = strchr(cachedChars + 10, character);
+  return (found != nullptr && character != '\0') ? found - cachedChars : -1;
+}
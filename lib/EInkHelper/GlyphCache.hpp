@@ -0,0 +1,118 @@
+#pragma once
+#include <Adafruit_GFX.h>
+#include <GxEPD2.h>
+#include <stdint.h>
+
+/**
+ * @brief Holds the digits, '/', ' ' and '.' of a font as pre-rendered 1bpp bitmaps.
+ *
+ * The glyphs are rasterized once from the font. Afterwards numbers are drawn by combining those bitmaps byte-wise with
+ * the rows of the frame buffer, which avoids the font rasterization and the per pixel drawing of Adafruit GFX for
+ * every info bar update.
+ */
+class GlyphCache {
+ public:
+  /// The chars, which are cached.
+  static constexpr const char *cachedChars = "0123456789/ .";
+  static constexpr uint8_t nrCachedChars = 13;
+  static constexpr uint8_t maxGlyphWidth = 16;
+  static constexpr uint8_t maxGlyphHeight = 24;
+  /// The maximum number of digits written by formatNumber().
+  static constexpr uint8_t maxDigits = 10;
+
+  GlyphCache();
+
+  /**
+   * @brief Rasterizes all cached chars of the font.
+   *
+   * @return False, if a glyph does not fit into maxGlyphWidth x maxGlyphHeight. Nothing is drawn in that case.
+   */
+  bool build(const GFXfont &font);
+
+  /**
+   * @brief Draws the text. Chars, which are not cached, are skipped.
+   *
+   * @param frameBuffer Where to draw to. Only the rows of its selected page are written.
+   * @param x The left end of the text.
+   * @param baselineY The baseline of the text (same as the cursor of Adafruit GFX).
+   * @param text The null terminated text.
+   * @param color The color of the glyph pixels. Other pixels are left untouched.
+   * @return The width of the drawn text.
+   */
+  template <typename Buffer>
+  int16_t drawText(Buffer &frameBuffer, int16_t x, int16_t baselineY, const char *text, uint16_t color) const {
+    if (!isBuilt) {
+      return 0;
+    }
+    const int16_t xStart = x;
+    for (; *text != '\0'; ++text) {
+      const int8_t index = getCacheIndex(*text);
+      if (index < 0) {
+        continue;
+      }
+      drawGlyph(frameBuffer, x, baselineY - ascent, bitmaps[index], color);
+      x += xAdvance[index];
+    }
+    return x - xStart;
+  }
+
+  /**
+   * @brief Writes the decimal representation of value right aligned into buffer, like sprintf("%*u").
+   *
+   * @param buffer Receives the text. Has to hold max(minWidth, maxDigits) + 1 chars.
+   * @param value The value to format.
+   * @param minWidth The text is padded with leading spaces to this width.
+   * @return Pointer to the terminating '\0', so further text can be appended.
+   */
+  static char *formatNumber(char *buffer, unsigned int value, uint8_t minWidth = 0);
+
+ private:
+  static constexpr uint8_t bytesPerRow = (maxGlyphWidth + 7) / 8;
+  static_assert(bytesPerRow < sizeof(uint32_t), "A shifted glyph row has to fit into 32 bits");
+
+  /**
+   * @brief ORs (white) or ANDs (black) the shifted rows of a glyph into the frame buffer (1 = white).
+   */
+  template <typename Buffer>
+  void drawGlyph(Buffer &frameBuffer, int16_t x, int16_t y, const uint8_t *bitmap, uint16_t color) const {
+    // Arithmetic shifts round down, also for glyphs starting left of the buffer.
+    const int16_t firstByte = x >> 3;
+    const uint8_t shift = x & 7;
+    for (uint8_t row = 0; row < glyphHeight; ++row, bitmap += bytesPerRow) {
+      uint8_t *bufferRow = frameBuffer.getRow(y + row);
+      if (bufferRow == nullptr) {
+        continue;
+      }
+      // The glyph row left aligned in the upper bytes, shifted to the position within the first byte.
+      uint32_t bits = 0;
+      for (uint8_t i = 0; i < bytesPerRow; ++i) {
+        bits |= uint32_t(bitmap[i]) << (24 - 8 * i);
+      }
+      bits >>= shift;
+      for (uint8_t i = 0; i <= bytesPerRow; ++i, bits <<= 8) {
+        const uint8_t glyphByte = bits >> 24;
+        const int16_t byteIndex = firstByte + i;
+        if (glyphByte == 0 || byteIndex < 0 || byteIndex >= Buffer::bytesPerRow) {
+          continue;
+        }
+        if (color == GxEPD_WHITE) {
+          bufferRow[byteIndex] |= glyphByte;
+        } else {
+          bufferRow[byteIndex] &= ~glyphByte;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Returns the index of the char within cachedChars or -1.
+   */
+  static int8_t getCacheIndex(char character);
+
+  bool isBuilt;
+  /// Distance from the top of the glyph bitmaps to the baseline.
+  uint8_t ascent;
+  uint8_t glyphHeight;
+  uint8_t xAdvance[nrCachedChars];
+  uint8_t bitmaps[nrCachedChars][maxGlyphHeight * bytesPerRow];
+};
@@ -0,0 +1,90 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief The minimum and maximum of both temperature traces within one graph column.
+ */
+struct ColumnEnvelope {
+  uint8_t minSteamTemp;
+  uint8_t maxSteamTemp;
+  uint8_t minHXTemp;
+  uint8_t maxHXTemp;
+
+  /**
+   * @brief Whether any sample has been added to this column.
+   */
+  bool hasSamples() const { return minSteamTemp <= maxSteamTemp; }
+};
+
+/**
+ * @brief Per column min/max decimation of the temperature history shown in the graph.
+ *
+ * Each sample only updates the envelope of its column. Hence, redrawing the whole graph costs one vertical span per
+ * column and trace, independent of the number of samples. When the time window of the graph doubles, two neighboring
+ * columns are merged into one.
+ *
+ * @tparam NrColumns The number of graph columns.
+ */
+template <uint16_t NrColumns>
+class GraphEnvelope {
+ public:
+  GraphEnvelope() { clear(); }
+
+  /**
+   * @brief Removes all samples.
+   */
+  void clear() {
+    for (uint16_t column = 0; column < NrColumns; ++column) {
+      columns[column] = emptyColumn;
+    }
+  }
+
+  /**
+   * @brief Adds a sample to the envelope of the column.
+   */
+  void add(uint16_t column, uint8_t steamTemp, uint8_t hxTemp) {
+    if (column >= NrColumns) {
+      return;
+    }
+    merge(columns[column], ColumnEnvelope{ steamTemp, steamTemp, hxTemp, hxTemp });
+  }
+
+  /**
+   * @brief Merges every two neighboring columns, as the represented time doubles.
+   */
+  void mergeColumnPairs() {
+    for (uint16_t column = 0; column < NrColumns; ++column) {
+      ColumnEnvelope merged = emptyColumn;
+      if (2 * column < NrColumns) {
+        merge(merged, columns[2 * column]);
+      }
+      if (2 * column + 1 < NrColumns) {
+        merge(merged, columns[2 * column + 1]);
+      }
+      columns[column] = merged;
+    }
+  }
+
+  uint16_t getNrColumns() const { return NrColumns; }
+
+  const ColumnEnvelope &operator[](uint16_t column) const { return columns[column]; }
+
+ private:
+  /// Minimum above maximum marks a column without samples.
+  static constexpr ColumnEnvelope emptyColumn{ UINT8_MAX, 0, UINT8_MAX, 0 };
+
+  /**
+   * @brief Extends the envelope by another one.
+   */
+  static void merge(ColumnEnvelope &envelope, const ColumnEnvelope &other) {
+    if (!other.hasSamples()) {
+      return;
+    }
+    if (other.minSteamTemp < envelope.minSteamTemp) envelope.minSteamTemp = other.minSteamTemp;
+    if (other.maxSteamTemp > envelope.maxSteamTemp) envelope.maxSteamTemp = other.maxSteamTemp;
+    if (other.minHXTemp < envelope.minHXTemp) envelope.minHXTemp = other.minHXTemp;
+    if (other.maxHXTemp > envelope.maxHXTemp) envelope.maxHXTemp = other.maxHXTemp;
+  }
+
+  ColumnEnvelope columns[NrColumns];
+};
@@ -0,0 +1,47 @@
+#include <GraphMapper.hpp>
+
+GraphMapper::GraphMapper(int16_t x0, int16_t y0, int16_t width, int16_t height, unsigned int maxTimeInS,
+                         unsigned int minTemp, unsigned int maxTemp)
+    : x0{ x0 },
+      width{ width },
+      maxTimeInS{ 0 },
+      minTemp{ minTemp },
+      maxTemp{ maxTemp > maxSupportedTemp ? maxSupportedTemp : maxTemp },
+      columnsPerSecondQ32{ 0 },
+      yForTemp{} {
+  setMaxTime(maxTimeInS);
+  const int16_t yLast = y0 + height;
+  const unsigned int tempRange = this->maxTemp - minTemp;
+  for (unsigned int temperature = minTemp; temperature <= this->maxTemp; ++temperature) {
+    // Lower end - pixels above the minimum temperature, rounded to the nearest pixel (NOTE: Inverse calculation)
+    yForTemp[temperature] = yLast - ((temperature - minTemp) * height + tempRange / 2) / tempRange;
+  }
+}
+
+int16_t GraphMapper::getYForTemp(unsigned int temperature) const {
+  if (temperature <= minTemp) {
+    return yForTemp[minTemp];
+  } else if (temperature >= maxTemp) {
+    return yForTemp[maxTemp];
+  }
+  return yForTemp[temperature];
+}
+
+int16_t GraphMapper::getXForTime(unsigned int timeInSeconds) const {
+  if (timeInSeconds >= maxTimeInS) {
+    return x0 + width;
+  }
+  return x0 + static_cast<int16_t>((timeInSeconds * columnsPerSecondQ32) >> 32);
+}
+
+uint16_t GraphMapper::getColumnForTime(unsigned int timeInSeconds) const { return getXForTime(timeInSeconds) - x0; }
+
+void GraphMapper::setMaxTime(unsigned int maxTimeInS) {
+  this->maxTimeInS = maxTimeInS;
+  // Rounded up, as truncated time points must not end up one column too early. The error of the rounding stays below
+  // 1 / maxTimeInS, the smallest fraction of a column, as long as maxTimeInS is below 2^16 s. 16 fractional bits were
+  // not enough for the doubled time window.
+  columnsPerSecondQ32 = ((static_cast<uint64_t>(width) << 32) + maxTimeInS - 1) / maxTimeInS;
+}
+
+unsigned int GraphMapper::getMaxTime() const { return maxTimeInS; }
@@ -0,0 +1,59 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief Maps temperatures and time points to pixels of the graph area without floating point math.
+ *
+ * The y position of every integer temperature is precomputed into a lookup table. The x position is evaluated with a
+ * 32.32 fixed-point columns-per-second factor. It is exact for time windows below 2^16 s, i.e. about 18 h.
+ */
+class GraphMapper {
+ public:
+  /// The highest temperature, which can be covered by the lookup table.
+  static constexpr unsigned int maxSupportedTemp = 200;
+
+  /**
+   * @param x0 The left end of the graph area.
+   * @param y0 The upper end of the graph area.
+   * @param width The width of the graph area.
+   * @param height The height of the graph area.
+   * @param maxTimeInS The time represented by the right end of the graph area.
+   * @param minTemp The temperature represented by the lower end of the graph area.
+   * @param maxTemp The temperature represented by the upper end of the graph area. At most maxSupportedTemp.
+   */
+  GraphMapper(int16_t x0, int16_t y0, int16_t width, int16_t height, unsigned int maxTimeInS, unsigned int minTemp,
+              unsigned int maxTemp);
+
+  /**
+   * @brief The y pixel position of a temperature. Temperatures outside of the range are clamped.
+   */
+  int16_t getYForTemp(unsigned int temperature) const;
+
+  /**
+   * @brief The x pixel position of a time point. Time points after the represented time are clamped.
+   */
+  int16_t getXForTime(unsigned int timeInSeconds) const;
+
+  /**
+   * @brief The graph column (x relative to the left end) of a time point.
+   */
+  uint16_t getColumnForTime(unsigned int timeInSeconds) const;
+
+  /**
+   * @brief Changes the time represented by the right end of the graph area.
+   */
+  void setMaxTime(unsigned int maxTimeInS);
+
+  unsigned int getMaxTime() const;
+
+ private:
+  const int16_t x0;
+  const int16_t width;
+  unsigned int maxTimeInS;
+  const unsigned int minTemp;
+  const unsigned int maxTemp;
+  /// Graph columns per second in 32.32 fixed point.
+  uint64_t columnsPerSecondQ32;
+  /// The y position of every temperature from minTemp to maxTemp.
+  int16_t yForTemp[maxSupportedTemp + 1];
+};
@@ -0,0 +1,48 @@
+#include <PackBitsReader.hpp>
+#include <pgmspace.h>
+#include <string.h>
+
+PackBitsReader::PackBitsReader(const uint8_t *data, size_t size)
+    : data{ data }, size{ size }, position{ 0 }, remaining{ 0 }, inRun{ false }, runByte{ 0 } {}
+
+size_t PackBitsReader::read(uint8_t *buffer, size_t length) {
+  size_t decoded = 0;
+  while (decoded < length) {
+    if (remaining == 0) {
+      if (position >= size) {
+        break;
+      }
+      const uint8_t header = pgm_read_byte(&data[position++]);
+      if (header == 128) {
+        continue;
+      }
+      inRun = header > 128;
+      if (inRun) {
+        if (position >= size) {
+          break;
+        }
+        remaining = 257 - header;
+        runByte = pgm_read_byte(&data[position++]);
+      } else {
+        remaining = header + 1;
+      }
+    }
+    size_t chunk = length - decoded < remaining ? length - decoded : remaining;
+    if (inRun) {
+      memset(buffer + decoded, runByte, chunk);
+    } else {
+      // Truncated data ends within the literal.
+      if (chunk > size - position) {
+        chunk = size - position;
+        remaining = chunk;
+      }
+      memcpy_P(buffer + decoded, data + position, chunk);
+      position += chunk;
+    }
+    remaining -= chunk;
+    decoded += chunk;
+  }
+  return decoded;
+}
+
+bool PackBitsReader::isAtEnd() const { return remaining == 0 && position >= size; }
@@ -0,0 +1,39 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Streaming decoder for PackBits compressed data in PROGMEM.
+ *
+ * A header byte n < 128 is followed by n + 1 literal bytes, n > 128 by one byte, which is repeated 257 - n times. 128
+ * is skipped. The data is decoded in chunks of any size, so no decompressed copy of the whole data is needed.
+ * tools/compress_bootscreen.py creates the data.
+ */
+class PackBitsReader {
+ public:
+  /**
+   * @param data The compressed data in PROGMEM.
+   * @param size The size of the compressed data.
+   */
+  PackBitsReader(const uint8_t *data, size_t size);
+
+  /**
+   * @brief Decodes the next bytes.
+   *
+   * @param buffer Where to decode to.
+   * @param length The number of bytes to decode.
+   * @return The number of decoded bytes. Less than length only at the end of the data.
+   */
+  size_t read(uint8_t *buffer, size_t length);
+
+  bool isAtEnd() const;
+
+ private:
+  const uint8_t *const data;
+  const size_t size;
+  size_t position;
+  /// The bytes left of the current literal or run.
+  uint8_t remaining;
+  bool inRun;
+  uint8_t runByte;
+};
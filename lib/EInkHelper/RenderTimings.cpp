@@ -0,0 +1,40 @@
+#include <RenderTimings.hpp>
+
+RenderTimings::RenderTimings() : entries{} {}
+
+void RenderTimings::add(RenderCall call, uint32_t durationInUs) {
+  Entry &entry = entries[static_cast<uint8_t>(call)];
+  entry.nrCalls++;
+  entry.totalInUs += durationInUs;
+  if (durationInUs > entry.maxInUs) {
+    entry.maxInUs = durationInUs;
+  }
+}
+
+void RenderTimings::clear() {
+  for (Entry &entry : entries) {
+    entry = Entry{};
+  }
+}
+
+void RenderTimings::print(Print &output) const {
+  for (uint8_t call = 0; call < static_cast<uint8_t>(RenderCall::Count); ++call) {
+    const Entry &entry = entries[call];
+    output.printf("%-16s calls: %6u, avg: %7u us, max: %7u us\n", toString(static_cast<RenderCall>(call)),
+                  entry.nrCalls, entry.nrCalls == 0 ? 0 : entry.totalInUs / entry.nrCalls, entry.maxInUs);
+  }
+}
+
+const char *RenderTimings::toString(RenderCall call) {
+  switch (call) {
+    case RenderCall::GraphSample: return "GraphSample";
+    case RenderCall::HeatingStatus: return "HeatingStatus";
+    case RenderCall::HXTemperature: return "HXTemperature";
+    case RenderCall::SteamTemperature: return "SteamTemperature";
+    case RenderCall::ShotTimer: return "ShotTimer";
+    case RenderCall::ShotTimerRefresh: return "ShotTimerRefresh";
+    case RenderCall::UpdateWindow: return "UpdateWindow";
+    case RenderCall::Count: break;
+  }
+  return "Unknown";
+}
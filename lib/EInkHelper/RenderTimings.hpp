@@ -0,0 +1,44 @@
+#pragma once
+#include <Print.h>
+#include <stdint.h>
+
+/**
+ * @brief The drawing entry points of EInkHelper, whose duration is measured.
+ */
+enum class RenderCall : uint8_t {
+  GraphSample,
+  HeatingStatus,
+  HXTemperature,
+  SteamTemperature,
+  ShotTimer,
+  ShotTimerRefresh,
+  UpdateWindow,
+  Count,
+};
+
+/**
+ * @brief Number of calls, total and maximum duration of each drawing entry point.
+ */
+class RenderTimings {
+ public:
+  RenderTimings();
+
+  void add(RenderCall call, uint32_t durationInUs);
+
+  void clear();
+
+  /**
+   * @brief Prints one line per entry point.
+   */
+  void print(Print &output) const;
+
+ private:
+  static const char *toString(RenderCall call);
+
+  struct Entry {
+    uint32_t nrCalls;
+    uint32_t totalInUs;
+    uint32_t maxInUs;
+  };
+  Entry entries[static_cast<uint8_t>(RenderCall::Count)];
+};
@@ -1,2381 +1,867 @@
 #pragma once
 
 #include <pgmspace.h>
-// See https://javl.github.io/image2cpp/
+// Generated by tools/compress_bootscreen.py from the output of https://javl.github.io/image2cpp/
+// 400x300, 1 bit per pixel, PackBits compressed. See PackBitsReader.
 
 constexpr unsigned char MrBeanFromBottomRight[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x07,
-  0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x1f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xcf, 0xff, 0xc0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0x31, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xe1, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x8f, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xe0,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf7, 0xfc, 0x0f, 0x80, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf0, 0x3f, 0xb8, 0x1c,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xe7, 0xff, 0xfe, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xbf, 0xcf, 0xff, 0x0f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xbf, 0xc0, 0x00, 0x01, 0xc0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x7f, 0x80, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x40, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff,
-  0x00, 0x00, 0x00, 0x32, 0x40, 0x00, 0x00, 0x00, 0x60, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x70, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfb, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf8, 0x8f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf8, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x01, 0xfc,
-  0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x01, 0xfe, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x67, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd0,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x00, 0x50, 0x00, 0x00, 0x70, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xff,
-  0xc0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x4f, 0xff, 0xfe, 0x00, 0x00, 0x80, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x00,
-  0x01, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x90, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0x80, 0x00, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x07, 0xff, 0xff, 0xff, 0x80, 0x00, 0xf8,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xfc, 0x03, 0xe0, 0x00, 0x3c, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x1f, 0xff,
-  0x80, 0x01, 0xf0, 0x40, 0x1c, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xe0, 0xfe, 0x1f, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x7f, 0xf0, 0xb8, 0x00, 0x44, 0x7f, 0xf9, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xc7, 0xfc, 0x00,
-  0x03, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0x8f, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x01, 0xff, 0x1f, 0xb8, 0x00, 0x00, 0xff, 0xff, 0xf8, 0x08, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x03, 0xfe, 0x7f, 0xe0, 0x00, 0x01, 0xff,
-  0xff, 0xdf, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0xfc, 0x7f, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0xf8,
-  0xfe, 0x07, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xf1, 0xfc, 0x3f, 0xfc, 0x00, 0x7f, 0xff, 0xf8,
-  0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x0f, 0xf3, 0xf8, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xfc, 0xa3, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x1f, 0xe3, 0xe3, 0xff,
-  0xfe, 0x00, 0x3f, 0xff, 0x9e, 0x53, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1f, 0xe7, 0xe7, 0xff, 0xff, 0x00, 0x7f, 0xff, 0xe0, 0x09, 0xff,
-  0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x3f, 0xe7, 0xce, 0x01, 0xff, 0x40, 0xff, 0xff, 0xf8, 0x04, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xe7, 0x9c, 0x00, 0xff, 0x80,
-  0x7f, 0xff, 0xfc, 0x04, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x7f, 0xcf, 0x38, 0x40, 0x7f, 0xc0, 0x7f, 0xff, 0xfe, 0x04, 0xff, 0x9f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x06, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f,
-  0xcf, 0x78, 0xe0, 0x3f, 0xc0, 0xff, 0xff, 0xff, 0x01, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x06, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xca, 0x70, 0xe0, 0x3f, 0x81, 0xff, 0xff,
-  0xff, 0x01, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1e, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x7f, 0xce, 0xf0, 0x40, 0x3f, 0x80, 0xff, 0xff, 0xff, 0x80, 0xdf, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x1e, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0x7f, 0xcc, 0xf0,
-  0x00, 0x3f, 0x00, 0x87, 0xff, 0xff, 0xc0, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xdd, 0xf0, 0x00, 0x3e, 0x10, 0xff, 0xff, 0xfe, 0xe0,
-  0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x05, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0xff, 0x8d, 0xf0, 0x00, 0x7c, 0x31, 0xff, 0xff, 0xff, 0x60, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x7f, 0x8d, 0xf0, 0x60, 0x78,
-  0xff, 0x9f, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0x9f, 0xf8, 0x00, 0xf1, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xa0, 0x00, 0x00, 0x03, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x7f, 0x9f, 0xfc, 0x01, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfe, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x03, 0x9f,
-  0x7f, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0x93, 0xfe, 0x03, 0xef, 0xf9, 0xff,
-  0xff, 0xff, 0xcf, 0x96, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x01, 0x3e, 0x3f, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x03, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xcf, 0xd0, 0xdf, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xd0, 0x00, 0x00, 0x00, 0x3c, 0x3f, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x03,
-  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xcb, 0xd0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x00, 0x38, 0xff, 0x83,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x03, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-  0xf8, 0x38, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x33, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf9, 0xff, 0x03, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xfc, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x00, 0x00, 0x23, 0xfc, 0x3f, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0x07, 0xff, 0xff,
-  0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x23, 0xf8, 0x7f, 0xfc, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0x0f, 0x9f, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xed,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x03, 0xf0, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x7f, 0x1f, 0xbf, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,
-  0x41, 0xc1, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0x8f, 0xff, 0xf0, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x01, 0xc3, 0xfc, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0x8f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x00, 0x01, 0x87, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff,
-  0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc7, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x2f, 0x8f, 0xff, 0xff, 0x00, 0x00, 0x36, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x6f, 0x1f, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff,
-  0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x4e, 0x3f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x00, 0x00, 0x0e, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x0c, 0x60, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x0c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00,
-  0x0c, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x04, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd8, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x8f, 0xfe, 0x01, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0xf0,
-  0x0f, 0xff, 0xe1, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x02, 0xff, 0xf9, 0xc0, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00,
-  0x1f, 0xfb, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x0f, 0xf0, 0x03, 0xf9, 0x83, 0xff, 0xff, 0xff, 0xf3,
-  0xff, 0xf1, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xe7, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0xf0, 0x01, 0xff, 0xf9, 0x80, 0xf9, 0x83, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xe0, 0x70, 0x00, 0x0f, 0xff, 0xff,
-  0xf7, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1f, 0xc0, 0x1f, 0x00, 0x5e, 0x00, 0xfb,
-  0x91, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xf8, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0xf7, 0xce, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x3c, 0x3f, 0xf8, 0x1c, 0xff, 0xdc, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfc,
-  0x7c, 0x3f, 0xff, 0x00, 0x4f, 0xff, 0xef, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x3f, 0x82,
-  0x71, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0xc3, 0xff, 0xff, 0xfb, 0xff, 0xf9, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0x83, 0x87, 0x07, 0xff, 0xf7, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x87, 0xff, 0xbf, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x40, 0x01, 0xff, 0x1d, 0x0c, 0x01,
-  0xff, 0xef, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xfd, 0xff, 0x13, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x38, 0x38, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xf3, 0xfd, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xfe, 0x08, 0x70, 0x38, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xfb, 0xff,
-  0xfb, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0xf0, 0x38, 0x7f, 0xff,
-  0xff, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0xe0, 0x30, 0x7f, 0xff, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x1f, 0xff, 0xfe, 0x77, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe,
-  0x01, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0x7f, 0xe3, 0xff, 0xff,
-  0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x01, 0xe0, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0xfc, 0x01, 0xe0, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x07,
-  0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x01, 0xf0,
-  0x30, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x07, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xff, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x01, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x0f, 0xff, 0xc8, 0x01, 0xff, 0xfe, 0x7f, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x3e, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xdf, 0xd0,
-  0x01, 0xff, 0xff, 0xff, 0xc1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x01, 0xfc, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x00, 0x1a, 0xc9, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x01, 0xff, 0x07, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
-  0x98, 0x00, 0x0f, 0xbe, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xdc, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0xff,
-  0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf3, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x1e, 0xdf, 0x00, 0x00, 0x7f, 0xff, 0xfd, 0xc0, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7f, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x3c, 0xbf, 0x00, 0x00, 0x7f, 0xff, 0xfd, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x19, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0x1c, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x5f, 0x0c, 0x00, 0x06, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x5f, 0xee,
-  0x00, 0x7f, 0xff, 0xff, 0xf4, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xfd, 0xac, 0x00, 0x5f, 0xff, 0xff, 0xe0, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x01, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x1f, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xb8, 0x00, 0xdf,
-  0xff, 0xff, 0x90, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x3f, 0xf1, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xfb, 0xfc, 0x01, 0xff, 0xff, 0xff, 0x32, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xcc, 0x00, 0x00, 0x01, 0xe0, 0x74, 0x00, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x03, 0xfb, 0xfc, 0x01, 0xff, 0xff, 0xff, 0x30, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x08, 0x00, 0x00, 0x00, 0x7f,
-  0x80, 0x3f, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xf8, 0x03, 0xbf, 0xff, 0xfd,
-  0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x38, 0x00, 0x00, 0x10, 0x3f, 0x80, 0x18, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x03, 0xf8, 0x00, 0x03, 0xfe, 0xe0, 0x07, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x0c, 0x00, 0x00, 0x28, 0x3f, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0x70, 0x00, 0x07, 0xf3,
-  0xe0, 0x07, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x30, 0x3f, 0xf0, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x04, 0x3f, 0xff, 0xff, 0x80, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x18, 0x1f, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x0c, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x20,
-  0x00, 0x1c, 0x1f, 0xfc, 0x5f, 0xbf, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x1d,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x80, 0x00, 0x0c, 0x1f, 0xff, 0xbf, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0xc0, 0x1c, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0xc8, 0x00, 0x0c, 0x4b, 0xff, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0x00, 0x00, 0x00,
-  0x00, 0x3f, 0xec, 0x80, 0x36, 0x7b, 0xff, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xca, 0x00, 0x07,
-  0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x80, 0xe0, 0x7f, 0xff,
-  0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0x00, 0x02, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x82, 0xc0, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe8, 0x37, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0x01, 0xf0, 0x7f, 0xff, 0xff, 0xc0, 0x06, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x1e, 0x80, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x0d, 0xe0, 0xff, 0xff, 0xff, 0xc0,
-  0x06, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0xff, 0xfe, 0x3f, 0xe0, 0xff, 0xff, 0xff, 0xc0, 0x07, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x8f, 0xe0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x3f,
-  0xf2, 0x7f, 0xff, 0xff, 0x00, 0x07, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xf8, 0x00, 0x00, 0x7e, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0x80,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xfc, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x80, 0x00, 0x00,
-  0x00, 0x0f, 0xf9, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x80, 0x00, 0x00, 0x00, 0x1f, 0xf1, 0xc7, 0xbf, 0xf5, 0xff,
-  0xff, 0xfe, 0x00, 0x03, 0xc0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x1f, 0xe7, 0x8f, 0xff, 0xf7, 0xdf, 0xff, 0xfe, 0x00, 0x03, 0xe0, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x06, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x80, 0x00, 0x00, 0x01, 0x9f,
-  0xdf, 0x1f, 0xff, 0xfd, 0xff, 0xff, 0xf6, 0x40, 0x03, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x02, 0xef, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x80, 0x00, 0x00, 0x00, 0x3d, 0xfc, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xfe,
-  0x40, 0x03, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xc0, 0x00, 0x02, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x3f,
-  0x80, 0x00, 0x00, 0x00, 0x48, 0x78, 0x7f, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x03, 0xf8, 0x00, 0x00, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff,
-  0xff, 0x7f, 0xff, 0xff, 0xef, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x4f,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x80, 0x00, 0x00, 0x00, 0x01, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x03,
-  0xfc, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x10, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0f, 0xff, 0xfd, 0x7f,
-  0xff, 0xff, 0xf8, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x40, 0x00, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x60, 0x1f, 0xfd, 0xfd, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0x00,
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0x7f, 0xff, 0xff,
-  0xfc, 0x00, 0x01, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x18, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0x80, 0x00, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xdc, 0x0c, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-  0xc7, 0xff, 0xff, 0xff, 0xfe, 0xf0, 0x00, 0x03, 0xff, 0xd8, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x03, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x03, 0xff, 0xdc, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x00, 0x40, 0x00, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xfc, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xee, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x80, 0x20, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf3, 0x3a, 0xff,
-  0xf7, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xe7, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x80, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc7, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x03, 0xff,
-  0xf3, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0e, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x5f, 0xc7, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xf1, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x07, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x07, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x07, 0xff, 0xf9, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x87, 0xc0, 0x00, 0x0e, 0x7f, 0xff,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x08, 0x78, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x07, 0xff, 0xf9, 0xc0,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xf0, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x07, 0xff, 0xfd, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83,
-  0xe0, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x07, 0xff, 0xfc, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xf0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xff, 0xfe, 0xf0, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc1, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xff,
-  0xdf, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x78, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xb0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x7c, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x87, 0xf8, 0xc0, 0x00, 0x00,
-  0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x07, 0xff, 0xc1, 0xa0, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x70, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x3f, 0xff, 0xce, 0xb5, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x0c, 0x1f, 0x00, 0x00, 0x00, 0x08, 0xff, 0xec, 0x7e, 0x04, 0x80, 0xfd,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4,
-  0x0e, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfe, 0x3e, 0x01, 0xc6, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x1f, 0x3c, 0x00, 0x00, 0x00, 0x03, 0xff,
-  0xff, 0x7f, 0x80, 0x4f, 0xad, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xec, 0x02, 0x78, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf9, 0xb9, 0x9f, 0x3f, 0xbf, 0xff, 0xff,
-  0xff, 0xfd, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xf0, 0xf0,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xe6, 0x78, 0x7d, 0x18, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x13, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x7e, 0x6f,
-  0x39, 0xe0, 0xef, 0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0xc0, 0x03, 0xf8, 0x7f, 0x39, 0xf0, 0x25, 0xff, 0xff, 0xff, 0xe2,
-  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x01, 0x60, 0x03, 0xc1, 0xdf, 0x1c, 0x11, 0xc7, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x40, 0xf0, 0x00, 0x24, 0xc1, 0xdc, 0x3d,
-  0xff, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x01, 0xc0, 0x01, 0x37, 0xbd, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xfc,
-  0x00, 0x01, 0x44, 0x01, 0x37, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x07, 0x06, 0x16, 0xff, 0xef,
-  0xff, 0xf4, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x03, 0x04, 0x1c, 0xff, 0x9f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00,
-  0x00, 0x03, 0x1e, 0xff, 0xff, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x20, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x02, 0x02, 0x7f, 0xdf, 0xff, 0x40,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x08, 0x03, 0xf3, 0xa7, 0xd0, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x43, 0x8f, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x77, 0xa5, 0xc8, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x20, 0x00, 0x00, 0x00, 0x11, 0x8f, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x1c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf8, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0xf1,
+  0xff, 0x02, 0xfe, 0x00, 0x01, 0xd2, 0xff, 0x04, 0xe0, 0x00, 0x00, 0x02, 0x7f, 0xd4, 0xff, 0x00, 0x80, 0xfe, 0x00,
+  0x02, 0x07, 0xff, 0x01, 0xd7, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x7f, 0xd9, 0xff, 0x00, 0xf0,
+  0xf8, 0x00, 0xd9, 0xff, 0x00, 0x80, 0xf8, 0x00, 0x00, 0x03, 0xda, 0xff, 0xf6, 0x00, 0x00, 0x7f, 0xdc, 0xff, 0x00,
+  0xfc, 0xf6, 0x00, 0x00, 0x1f, 0xdc, 0xff, 0x00, 0xf0, 0xf6, 0x00, 0x00, 0x03, 0xdc, 0xff, 0x00, 0xc0, 0xf5, 0x00,
+  0x00, 0x1f, 0xdd, 0xff, 0x00, 0x80, 0xf5, 0x00, 0x00, 0x07, 0xde, 0xff, 0x00, 0xfe, 0xf4, 0x00, 0x00, 0x01, 0xde,
+  0xff, 0x00, 0xfe, 0xf3, 0x00, 0xde, 0xff, 0x00, 0xfc, 0xf3, 0x00, 0x00, 0x7f, 0xdf, 0xff, 0x00, 0xf8, 0xf3, 0x00,
+  0x00, 0x3f, 0xdf, 0xff, 0x00, 0xe0, 0xf3, 0x00, 0x00, 0x0f, 0xdf, 0xff, 0x00, 0x80, 0xf3, 0x00, 0x00, 0x07, 0xdf,
+  0xff, 0xf2, 0x00, 0x00, 0x03, 0xe0, 0xff, 0x00, 0xfe, 0xf2, 0x00, 0x00, 0x01, 0xe0, 0xff, 0x00, 0xfc, 0xf1, 0x00,
+  0xe0, 0xff, 0x00, 0xf8, 0xf1, 0x00, 0xe0, 0xff, 0x00, 0xf0, 0xf1, 0x00, 0x00, 0x3f, 0xe1, 0xff, 0x00, 0xe0, 0xf1,
+  0x00, 0x00, 0x1f, 0xe1, 0xff, 0x00, 0xc0, 0xf1, 0x00, 0x00, 0x0f, 0xe1, 0xff, 0x00, 0x80, 0xf1, 0x00, 0x00, 0x0f,
+  0xe1, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xe2, 0xff, 0x00, 0xfe, 0xf0, 0x00, 0x00, 0x03, 0xe2, 0xff, 0x00, 0xfc, 0xf0,
+  0x00, 0x00, 0x01, 0xe2, 0xff, 0x00, 0xf8, 0xef, 0x00, 0xe2, 0xff, 0x00, 0xe0, 0xef, 0x00, 0x00, 0x7f, 0xe3, 0xff,
+  0x00, 0xc0, 0xef, 0x00, 0x00, 0x7f, 0xe3, 0xff, 0x00, 0x80, 0xef, 0x00, 0x00, 0x7f, 0xe3, 0xff, 0xee, 0x00, 0x00,
+  0x3f, 0xe4, 0xff, 0x00, 0xfe, 0xf5, 0x00, 0x00, 0x11, 0xfb, 0x00, 0x00, 0x1f, 0xe4, 0xff, 0x00, 0xfc, 0xf5, 0x00,
+  0x00, 0x30, 0xfb, 0x00, 0x00, 0x0f, 0xe4, 0xff, 0x00, 0xf8, 0xf5, 0x00, 0x01, 0x3f, 0xc0, 0xfc, 0x00, 0x00, 0x0f,
+  0xe4, 0xff, 0x00, 0xf8, 0xf6, 0x00, 0x01, 0x10, 0x3f, 0xfb, 0x00, 0x00, 0x07, 0xe4, 0xff, 0x00, 0xf0, 0xf5, 0x00,
+  0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xe4, 0xff, 0x00, 0xf0, 0xf6, 0x00, 0x03, 0x8f, 0xff, 0xff, 0x80, 0xfd, 0x00,
+  0x00, 0x01, 0xe4, 0xff, 0x00, 0xe0, 0xf6, 0x00, 0xfe, 0xff, 0x00, 0xc0, 0xfc, 0x00, 0xe4, 0xff, 0x00, 0xe0, 0xf7,
+  0x00, 0x00, 0x07, 0xfe, 0xff, 0x00, 0xe0, 0xfc, 0x00, 0x00, 0x7f, 0xe5, 0xff, 0x00, 0xe0, 0xf7, 0x00, 0x00, 0x1f,
+  0xfe, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x00, 0x3f, 0xe5, 0xff, 0x00, 0xc0, 0xf7, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00,
+  0xfc, 0xfc, 0x00, 0x00, 0x3f, 0xe5, 0xff, 0xf7, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x1f,
+  0xe6, 0xff, 0x00, 0xfe, 0xf7, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x00, 0x1f, 0xe6, 0xff, 0x00,
+  0xfc, 0xf7, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x01, 0xf8, 0x20, 0xfd, 0x00, 0x00, 0x0f, 0xe6, 0xff, 0x00, 0xfc, 0xf7,
+  0x00, 0x00, 0x7f, 0xfd, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x00, 0x07, 0xe6, 0xff, 0x00, 0xf8, 0xf7, 0x00, 0xfc, 0xff,
+  0x00, 0xf0, 0xfc, 0x00, 0x00, 0x01, 0xe6, 0xff, 0x00, 0xf0, 0xf8, 0x00, 0x00, 0x01, 0xfb, 0xff, 0xfb, 0x00, 0xe6,
+  0xff, 0x00, 0xf0, 0xf8, 0x00, 0x00, 0x01, 0xfb, 0xff, 0xfb, 0x00, 0xe6, 0xff, 0x00, 0xe0, 0xf8, 0x00, 0x00, 0x07,
+  0xfb, 0xff, 0xfb, 0x00, 0x00, 0x7f, 0xe7, 0xff, 0x00, 0xe0, 0xf8, 0x00, 0x00, 0x0f, 0xfc, 0xff, 0x00, 0xfe, 0xfb,
+  0x00, 0x00, 0x1f, 0xe7, 0xff, 0x00, 0xc0, 0xf8, 0x00, 0x00, 0x0f, 0xfc, 0xff, 0x00, 0xc0, 0xfb, 0x00, 0x00, 0x1f,
+  0xe7, 0xff, 0x00, 0x80, 0xf8, 0x00, 0x00, 0x5f, 0xfd, 0xff, 0x02, 0xfe, 0x3f, 0xc0, 0xfc, 0x00, 0x00, 0x0f, 0xe7,
+  0xff, 0x00, 0x80, 0xf8, 0x00, 0x00, 0xbf, 0xfb, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x00, 0x07, 0xe7, 0xff, 0xf7, 0x00,
+  0x00, 0x7f, 0xfb, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x00, 0x03, 0xe8, 0xff, 0x00, 0xfe, 0xf8, 0x00, 0x00, 0x07, 0xfa,
+  0xff, 0x00, 0xf0, 0xfc, 0x00, 0x00, 0x01, 0xe8, 0xff, 0x00, 0xfe, 0xf8, 0x00, 0x00, 0x03, 0xfb, 0xff, 0x00, 0xf8,
+  0xfa, 0x00, 0xe8, 0xff, 0x00, 0xfc, 0xf8, 0x00, 0x00, 0x0b, 0xfb, 0xff, 0x00, 0x80, 0xfa, 0x00, 0x00, 0x7f, 0xe9,
+  0xff, 0x00, 0xfc, 0xf8, 0x00, 0x00, 0x1f, 0xfc, 0xff, 0x02, 0xfe, 0x1f, 0xfe, 0xfb, 0x00, 0x00, 0x7f, 0xe9, 0xff,
+  0x00, 0xfc, 0xf8, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0x03, 0xf8, 0xff, 0xff, 0xe0, 0xfc, 0x00, 0x00, 0x3f, 0xe9, 0xff,
+  0x00, 0xf8, 0xf8, 0x00, 0xfb, 0xff, 0x03, 0xf3, 0xff, 0xff, 0xf0, 0xfb, 0x00, 0x00, 0x7f, 0xea, 0xff, 0x00, 0xf8,
+  0xf8, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0x03, 0xcf, 0xff, 0xc0, 0x10, 0xfb, 0x00, 0x00, 0x1f, 0xea, 0xff, 0x00, 0xf8,
+  0xf9, 0x00, 0x00, 0x01, 0xfb, 0xff, 0x02, 0x3f, 0xfe, 0x31, 0xfa, 0x00, 0x00, 0x1f, 0xea, 0xff, 0x00, 0xf8, 0xf9,
+  0x00, 0x00, 0x03, 0xfb, 0xff, 0x03, 0x7f, 0xe1, 0xff, 0xe0, 0xfb, 0x00, 0x00, 0x13, 0xea, 0xff, 0x00, 0xf8, 0xf9,
+  0x00, 0x00, 0x07, 0xfa, 0xff, 0x02, 0x8f, 0xff, 0xf0, 0xfb, 0x00, 0x00, 0x07, 0xea, 0xff, 0x00, 0xf8, 0xf9, 0x00,
+  0x00, 0x0f, 0xfa, 0xff, 0x02, 0x3f, 0xff, 0xfc, 0xfb, 0x00, 0x00, 0x03, 0xea, 0xff, 0x00, 0xf8, 0xf9, 0x00, 0x00,
+  0x1f, 0xfb, 0xff, 0x03, 0xfe, 0x7f, 0xff, 0xff, 0xfa, 0x00, 0xea, 0xff, 0x00, 0xf8, 0xf9, 0x00, 0x00, 0x1f, 0xfb,
+  0xff, 0x03, 0xf9, 0xff, 0xe0, 0x07, 0xfa, 0x00, 0x00, 0x7f, 0xeb, 0xff, 0x00, 0xf8, 0xf9, 0x00, 0x00, 0x7f, 0xfb,
+  0xff, 0x04, 0xf3, 0xfe, 0x00, 0x01, 0x80, 0xfb, 0x00, 0x00, 0x7f, 0xeb, 0xff, 0x00, 0xf0, 0xfa, 0x00, 0x00, 0x01,
+  0xfa, 0xff, 0x04, 0xf7, 0xfc, 0x0f, 0x80, 0x71, 0xfb, 0x00, 0x00, 0x3f, 0xeb, 0xff, 0x00, 0xf0, 0xfa, 0x00, 0x00,
+  0x03, 0xfa, 0xff, 0x04, 0xcf, 0xf0, 0x3f, 0xb8, 0x1c, 0xfb, 0x00, 0x00, 0x7f, 0xeb, 0xff, 0x00, 0xf8, 0xfa, 0x00,
+  0x00, 0x03, 0xfa, 0xff, 0x04, 0x9f, 0xe7, 0xff, 0xfe, 0x0e, 0xfb, 0x00, 0x00, 0x3f, 0xeb, 0xff, 0x00, 0xf0, 0xfa,
+  0x00, 0x00, 0x07, 0xfa, 0xff, 0x04, 0xbf, 0xcf, 0xff, 0x0f, 0x07, 0xfb, 0x00, 0x00, 0x3f, 0xeb, 0xff, 0x00, 0xf0,
+  0xfa, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x05, 0x7f, 0xbf, 0xc0, 0x00, 0x01, 0xc0, 0xfc, 0x00, 0x00, 0x1f, 0xeb, 0xff,
+  0x00, 0xf0, 0xfa, 0x00, 0x00, 0x1f, 0xfb, 0xff, 0x06, 0xfe, 0xff, 0x7f, 0x80, 0x00, 0x00, 0x61, 0xfd, 0x00, 0x01,
+  0x40, 0x1f, 0xeb, 0xff, 0x00, 0xe0, 0xfa, 0x00, 0x00, 0x3f, 0xfb, 0xff, 0x02, 0xfd, 0xfe, 0xff, 0xfe, 0x00, 0x01,
+  0x32, 0x40, 0xfe, 0x00, 0x01, 0x60, 0x1f, 0xeb, 0xff, 0x00, 0xe0, 0xfa, 0x00, 0xf9, 0xff, 0x01, 0xfd, 0xfe, 0xfe,
+  0x00, 0x00, 0x02, 0xfd, 0x00, 0x01, 0x70, 0x0f, 0xeb, 0xff, 0x00, 0xe0, 0xfb, 0x00, 0x00, 0x01, 0xfa, 0xff, 0x02,
+  0xfb, 0xff, 0xfc, 0xfd, 0x00, 0x00, 0x60, 0xfe, 0x00, 0x01, 0xf8, 0x8f, 0xeb, 0xff, 0x00, 0xe0, 0xfb, 0x00, 0x00,
+  0x03, 0xf8, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x70, 0xfe, 0x00, 0x01, 0xf8, 0xc7, 0xeb, 0xff, 0x00, 0xc0, 0xfb,
+  0x00, 0x00, 0x07, 0xf8, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x05, 0x98, 0x00, 0x00, 0x01, 0xfc, 0xe7, 0xeb, 0xff, 0x00,
+  0xc0, 0xfb, 0x00, 0x00, 0x0f, 0xf8, 0xff, 0x00, 0xf0, 0xfa, 0x00, 0x02, 0x01, 0xfc, 0xe7, 0xeb, 0xff, 0x00, 0xc0,
+  0xfb, 0x00, 0x00, 0x1f, 0xf8, 0xff, 0x00, 0xe0, 0xfd, 0x00, 0x05, 0x04, 0x00, 0x00, 0x01, 0xfe, 0x67, 0xeb, 0xff,
+  0x00, 0xc0, 0xfb, 0x00, 0x00, 0x3f, 0xf8, 0xff, 0x00, 0xe0, 0xfa, 0x00, 0x02, 0x01, 0xff, 0x67, 0xeb, 0xff, 0x00,
+  0x80, 0xfb, 0x00, 0x00, 0x7f, 0xf8, 0xff, 0x00, 0xc0, 0xfa, 0x00, 0x00, 0x01, 0xe9, 0xff, 0x00, 0x80, 0xfb, 0x00,
+  0x00, 0x7f, 0xf8, 0xff, 0x00, 0x80, 0xfd, 0x00, 0x03, 0x02, 0xd0, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x80, 0xfb, 0x00,
+  0xf7, 0xff, 0xfb, 0x00, 0x02, 0x90, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x80, 0xfc, 0x00, 0x00, 0x01, 0xf7, 0xff, 0x08,
+  0x80, 0x00, 0x00, 0x50, 0x00, 0x00, 0x70, 0x00, 0x00, 0xe9, 0xff, 0x00, 0x80, 0xfc, 0x00, 0x00, 0x03, 0xf7, 0xff,
+  0xfe, 0x00, 0x00, 0x7e, 0xfc, 0x00, 0xe9, 0xff, 0x00, 0x80, 0xfc, 0x00, 0x00, 0x0f, 0xf7, 0xff, 0xfe, 0x00, 0x00,
+  0x7f, 0xfc, 0x00, 0x00, 0x0f, 0xea, 0xff, 0xfb, 0x00, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x00, 0x02, 0x07, 0xff, 0xc0,
+  0xfd, 0x00, 0x00, 0x07, 0xea, 0xff, 0xfb, 0x00, 0x00, 0x1f, 0xf8, 0xff, 0x05, 0xfe, 0x00, 0x00, 0x07, 0xff, 0xfc,
+  0xfd, 0x00, 0x00, 0x07, 0xea, 0xff, 0xfb, 0x00, 0x00, 0x1f, 0xf8, 0xff, 0x0a, 0xfe, 0x00, 0x00, 0x4f, 0xff, 0xfe,
+  0x00, 0x00, 0x80, 0x00, 0x03, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xf7, 0xff, 0x0a, 0xfc, 0x00, 0x00, 0x7f, 0xff,
+  0xff, 0x00, 0x01, 0x80, 0x00, 0x07, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xf7, 0xff, 0x02, 0xf8, 0x00, 0x00, 0xfe,
+  0xff, 0xff, 0x00, 0x02, 0x90, 0x00, 0x03, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xf7, 0xff, 0x02, 0xf0, 0x00, 0x01,
+  0xfe, 0xff, 0x04, 0x80, 0x00, 0xf8, 0x00, 0x03, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xf7, 0xff, 0x02, 0xf8, 0x00,
+  0x07, 0xfe, 0xff, 0x04, 0x80, 0x00, 0xf8, 0x00, 0x03, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xf7, 0xff, 0x0a, 0xf0,
+  0x00, 0x0f, 0xff, 0xfc, 0x03, 0xe0, 0x00, 0x3c, 0x00, 0x00, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xf7, 0xff, 0x0b,
+  0xe0, 0x00, 0x1f, 0xff, 0x80, 0x01, 0xf0, 0x40, 0x1c, 0x00, 0x00, 0x7f, 0xeb, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xf7,
+  0xff, 0x0b, 0xc0, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0xe0, 0xfe, 0x1f, 0x00, 0x00, 0x7f, 0xeb, 0xff, 0xfc, 0x00, 0x00,
+  0x7f, 0xf7, 0xff, 0x0a, 0xc0, 0x00, 0x7f, 0xf0, 0xb8, 0x00, 0x44, 0x7f, 0xf9, 0x00, 0x00, 0xea, 0xff, 0xfc, 0x00,
+  0xf6, 0xff, 0x0a, 0xc0, 0x00, 0xff, 0xc7, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x00, 0xea, 0xff, 0xfd, 0x00, 0x00,
+  0x03, 0xf6, 0xff, 0x0b, 0x80, 0x00, 0xff, 0x8f, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0xeb, 0xff, 0xfd,
+  0x00, 0x00, 0x0f, 0xf6, 0xff, 0x0b, 0x80, 0x01, 0xff, 0x1f, 0xb8, 0x00, 0x00, 0xff, 0xff, 0xf8, 0x08, 0x7f, 0xeb,
+  0xff, 0xfd, 0x00, 0x00, 0x0f, 0xf6, 0xff, 0x0a, 0x00, 0x03, 0xfe, 0x7f, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xdf, 0x02,
+  0xea, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xf6, 0xff, 0x06, 0x00, 0x07, 0xfc, 0x7f, 0x80, 0x00, 0x00, 0xfe, 0xff, 0x00,
+  0x07, 0xea, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x3f, 0xf6, 0xff, 0x06, 0x00, 0x07, 0xf8, 0xfe, 0x07, 0xf0, 0x00,
+  0xfe, 0xff, 0x00, 0xc3, 0xea, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x3f, 0xf6, 0xff, 0x0a, 0x00, 0x0f, 0xf1, 0xfc,
+  0x3f, 0xfc, 0x00, 0x7f, 0xff, 0xf8, 0x83, 0xea, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x3f, 0xf6, 0xff, 0x0c, 0x00,
+  0x0f, 0xf3, 0xf8, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xfc, 0xa3, 0xff, 0xef, 0xec, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00,
+  0x3f, 0xf7, 0xff, 0x0d, 0xfd, 0x00, 0x1f, 0xe3, 0xe3, 0xff, 0xfe, 0x00, 0x3f, 0xff, 0x9e, 0x53, 0xff, 0xef, 0xec,
+  0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x3f, 0xf6, 0xff, 0x0c, 0x00, 0x1f, 0xe7, 0xe7, 0xff, 0xff, 0x00, 0x7f, 0xff,
+  0xe0, 0x09, 0xff, 0xcf, 0xec, 0xff, 0xfd, 0x00, 0x00, 0x3f, 0xf6, 0xff, 0x0c, 0x00, 0x3f, 0xe7, 0xce, 0x01, 0xff,
+  0x40, 0xff, 0xff, 0xf8, 0x04, 0xff, 0xcf, 0xec, 0xff, 0xfd, 0x00, 0x00, 0x3f, 0xf6, 0xff, 0x0c, 0x00, 0x3f, 0xe7,
+  0x9c, 0x00, 0xff, 0x80, 0x7f, 0xff, 0xfc, 0x04, 0xff, 0xdf, 0xec, 0xff, 0xfe, 0x00, 0x01, 0x02, 0x3f, 0xf7, 0xff,
+  0x0d, 0xf9, 0x00, 0x7f, 0xcf, 0x38, 0x40, 0x7f, 0xc0, 0x7f, 0xff, 0xfe, 0x04, 0xff, 0x9f, 0xec, 0xff, 0xfe, 0x00,
+  0x01, 0x06, 0x7f, 0xf7, 0xff, 0x07, 0xfc, 0x00, 0x7f, 0xcf, 0x78, 0xe0, 0x3f, 0xc0, 0xfe, 0xff, 0x02, 0x01, 0xff,
+  0x9f, 0xec, 0xff, 0xfe, 0x00, 0x01, 0x06, 0x3f, 0xf7, 0xff, 0x07, 0xfc, 0x00, 0x7f, 0xca, 0x70, 0xe0, 0x3f, 0x81,
+  0xfe, 0xff, 0x01, 0x01, 0xbf, 0xeb, 0xff, 0xfe, 0x00, 0x01, 0x1e, 0xfb, 0xf7, 0xff, 0x07, 0xf8, 0x00, 0x7f, 0xce,
+  0xf0, 0x40, 0x3f, 0x80, 0xfe, 0xff, 0x01, 0x80, 0xdf, 0xeb, 0xff, 0xfe, 0x00, 0x01, 0x1e, 0xfb, 0xf7, 0xff, 0x0c,
+  0xf8, 0x01, 0x7f, 0xcc, 0xf0, 0x00, 0x3f, 0x00, 0x87, 0xff, 0xff, 0xc0, 0xcf, 0xeb, 0xff, 0xfe, 0x00, 0x01, 0x1f,
+  0xf3, 0xf7, 0xff, 0x0c, 0xfc, 0x00, 0xff, 0xdd, 0xf0, 0x00, 0x3e, 0x10, 0xff, 0xff, 0xfe, 0xe0, 0x4f, 0xeb, 0xff,
+  0xfe, 0x00, 0x01, 0x05, 0xe7, 0xf7, 0xff, 0x07, 0xfe, 0x00, 0xff, 0x8d, 0xf0, 0x00, 0x7c, 0x31, 0xfe, 0xff, 0x01,
+  0x60, 0x07, 0xeb, 0xff, 0xfe, 0x00, 0x00, 0x13, 0xf5, 0xff, 0x0b, 0x02, 0x7f, 0x8d, 0xf0, 0x60, 0x78, 0xff, 0x9f,
+  0xff, 0xff, 0xf8, 0x0f, 0xeb, 0xff, 0x03, 0xa0, 0x00, 0x00, 0x03, 0xf5, 0xff, 0x0b, 0x00, 0x7f, 0x9f, 0xf8, 0x00,
+  0xf1, 0xfe, 0x7f, 0xff, 0xff, 0xf8, 0x0f, 0xeb, 0xff, 0x04, 0xa0, 0x00, 0x00, 0x03, 0xdf, 0xf6, 0xff, 0x06, 0x00,
+  0x7f, 0x9f, 0xfc, 0x01, 0xff, 0xfc, 0xfe, 0xff, 0x01, 0xfe, 0x27, 0xeb, 0xff, 0x07, 0xb0, 0x00, 0x00, 0x03, 0x9f,
+  0x7f, 0xff, 0x1f, 0xf9, 0xff, 0x06, 0xf8, 0x7f, 0x93, 0xfe, 0x03, 0xef, 0xf9, 0xfe, 0xff, 0x02, 0xcf, 0x96, 0x5f,
+  0xec, 0xff, 0x07, 0xd0, 0x00, 0x00, 0x01, 0x3e, 0x3f, 0xf8, 0x7f, 0xf9, 0xff, 0x02, 0xf8, 0xff, 0x03, 0xfe, 0xff,
+  0x00, 0xe7, 0xfe, 0xff, 0x02, 0xcf, 0xd0, 0xdf, 0xec, 0xff, 0x00, 0xd0, 0xfe, 0x00, 0x02, 0x3c, 0x3f, 0xe1, 0xf8,
+  0xff, 0x02, 0xf8, 0xff, 0x03, 0xfe, 0xff, 0x00, 0x0f, 0xfe, 0xff, 0x02, 0xcb, 0xd0, 0xdf, 0xec, 0xff, 0x00, 0xe8,
+  0xfe, 0x00, 0x02, 0x38, 0xff, 0x83, 0xf8, 0xff, 0x02, 0xf8, 0xff, 0x03, 0xfe, 0xff, 0x00, 0x1f, 0xfe, 0xff, 0x02,
+  0xf8, 0x38, 0x3f, 0xec, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x02, 0x33, 0xff, 0x0f, 0xf8, 0xff, 0x06, 0xf9, 0xff, 0x03,
+  0xff, 0xff, 0xfe, 0x3f, 0xfe, 0xff, 0x02, 0xfc, 0x80, 0x7f, 0xec, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x04, 0x23, 0xfc,
+  0x3f, 0xff, 0xe7, 0xfa, 0xff, 0x06, 0xf1, 0xff, 0x07, 0xff, 0xff, 0xf8, 0x7f, 0xfd, 0xff, 0x00, 0xd8, 0xeb, 0xff,
+  0x00, 0xf0, 0xfe, 0x00, 0x04, 0x23, 0xf8, 0x7f, 0xfc, 0x3f, 0xfa, 0xff, 0x05, 0xf1, 0xff, 0x0f, 0x9f, 0xff, 0xf1,
+  0xfd, 0xff, 0x01, 0xfe, 0xed, 0xeb, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x03, 0x03, 0xf0, 0xff, 0xc0, 0xf9, 0xff, 0x05,
+  0xf0, 0x7f, 0x1f, 0xbf, 0xff, 0x87, 0xfd, 0xff, 0x01, 0xfc, 0x6d, 0xeb, 0xff, 0x00, 0xfc, 0xfe, 0x00, 0x03, 0x41,
+  0xc1, 0xff, 0x07, 0xf9, 0xff, 0x05, 0xf0, 0xff, 0x8f, 0xff, 0xf0, 0x3f, 0xfd, 0xff, 0x01, 0xfc, 0xe5, 0xeb, 0xff,
+  0x00, 0xfc, 0xfe, 0x00, 0x03, 0x01, 0xc3, 0xfc, 0x3f, 0xf9, 0xff, 0x04, 0xfb, 0xff, 0x8f, 0xff, 0xf0, 0xfc, 0xff,
+  0x00, 0xef, 0xea, 0xff, 0x00, 0xfe, 0xfe, 0x00, 0x02, 0x01, 0x87, 0xf0, 0xf8, 0xff, 0x00, 0xfb, 0xfe, 0xff, 0x00,
+  0x83, 0xfb, 0xff, 0x00, 0xf3, 0xeb, 0xff, 0x00, 0xfe, 0xfd, 0x00, 0x01, 0x07, 0xc3, 0xf8, 0xff, 0x00, 0xfd, 0xf9,
+  0xff, 0x00, 0xcf, 0xe8, 0xff, 0xfd, 0x00, 0x05, 0x1f, 0xc7, 0xff, 0xff, 0xf8, 0x0f, 0xf3, 0xff, 0x02, 0xc7, 0xff,
+  0xfe, 0xea, 0xff, 0xfd, 0x00, 0x07, 0x2f, 0x8f, 0xff, 0xff, 0x00, 0x00, 0x36, 0x7f, 0xf5, 0xff, 0x03, 0xc7, 0xff,
+  0xff, 0xbf, 0xeb, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x6f, 0x1f, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xf5, 0xff, 0x03,
+  0xc7, 0xff, 0xff, 0xcf, 0xeb, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x02, 0x4e, 0x3f, 0xa0, 0xfc, 0x00, 0xf2, 0xff, 0x00,
+  0x7a, 0xeb, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x01, 0x0e, 0x3e, 0xfb, 0x00, 0x00, 0x3f, 0xf3, 0xff, 0x00, 0x39, 0xeb,
+  0xff, 0x00, 0xc0, 0xfe, 0x00, 0x01, 0x0c, 0x60, 0xfb, 0x00, 0x00, 0x1f, 0xf3, 0xff, 0x00, 0x3d, 0xeb, 0xff, 0x00,
+  0xc0, 0xfe, 0x00, 0x01, 0x0c, 0x40, 0xfb, 0x00, 0x00, 0x1f, 0xf4, 0xff, 0x01, 0xbf, 0xdf, 0xeb, 0xff, 0x00, 0xc0,
+  0xfe, 0x00, 0x01, 0x0c, 0x40, 0xfb, 0x00, 0x00, 0x07, 0xf3, 0xff, 0x00, 0xef, 0xeb, 0xff, 0x00, 0xe0, 0xfe, 0x00,
+  0x01, 0x08, 0x80, 0xfa, 0x00, 0xf3, 0xff, 0x00, 0xc7, 0xeb, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x08, 0xf9, 0x00,
+  0x00, 0x3f, 0xf4, 0xff, 0x00, 0xc5, 0xeb, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x0f, 0xf4,
+  0xff, 0x00, 0xc1, 0xeb, 0xff, 0x00, 0xf0, 0xf5, 0x00, 0x00, 0x03, 0xf4, 0xff, 0x00, 0xf1, 0xeb, 0xff, 0x00, 0xf8,
+  0xf5, 0x00, 0x00, 0x01, 0xf4, 0xff, 0x00, 0xe0, 0xeb, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x00, 0x04, 0xf8, 0x00, 0xf4,
+  0xff, 0x01, 0xe0, 0x7f, 0xec, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x00, 0x04, 0xfc, 0x00, 0x04, 0x01, 0xd8, 0x00, 0x00,
+  0x7f, 0xf5, 0xff, 0x01, 0xe0, 0x7f, 0xec, 0xff, 0x00, 0xf8, 0xf9, 0x00, 0x05, 0xff, 0x8f, 0xfe, 0x01, 0x00, 0x3f,
+  0xf5, 0xff, 0x01, 0xe0, 0x7f, 0xec, 0xff, 0x00, 0xfc, 0xfe, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x06, 0x03, 0xf0, 0x0f,
+  0xff, 0xe1, 0xc0, 0x1f, 0xf5, 0xff, 0x01, 0xe0, 0x7f, 0xec, 0xff, 0x00, 0xfc, 0xfa, 0x00, 0x06, 0x7f, 0x80, 0x02,
+  0xff, 0xf9, 0xc0, 0x0f, 0xfd, 0xff, 0x01, 0xfc, 0x00, 0xfb, 0xff, 0x01, 0xf8, 0x1f, 0xec, 0xff, 0x00, 0xfc, 0xfe,
+  0x00, 0x00, 0x10, 0xfe, 0x00, 0x06, 0xff, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x07, 0xfd, 0xff, 0x00, 0xf7, 0xfa, 0xff,
+  0x01, 0xf8, 0x3f, 0xec, 0xff, 0x00, 0xfc, 0xfb, 0x00, 0x01, 0x03, 0xf8, 0xfe, 0x00, 0x02, 0x1f, 0xfb, 0x07, 0xfb,
+  0xff, 0x00, 0x47, 0xfc, 0xff, 0x01, 0xfc, 0x3f, 0xec, 0xff, 0x00, 0xfc, 0xfb, 0x00, 0x07, 0x03, 0xf8, 0x00, 0x0f,
+  0xf0, 0x03, 0xf9, 0x83, 0xfe, 0xff, 0x04, 0xf3, 0xff, 0xf1, 0x00, 0x0f, 0xfe, 0xff, 0x02, 0xe7, 0xfc, 0x3f, 0xec,
+  0xff, 0x00, 0xfc, 0xfb, 0x00, 0x07, 0x01, 0xf0, 0x01, 0xff, 0xf9, 0x80, 0xf9, 0x83, 0xfe, 0xff, 0x0a, 0xf8, 0xff,
+  0xe0, 0x70, 0x00, 0x0f, 0xff, 0xff, 0xf7, 0xfe, 0x0f, 0xec, 0xff, 0x00, 0xfc, 0xfe, 0x00, 0x18, 0x04, 0x00, 0x00,
+  0x1f, 0xc0, 0x1f, 0x00, 0x5e, 0x00, 0xfb, 0x91, 0xff, 0xff, 0xfb, 0xf8, 0xff, 0xf8, 0xf0, 0x00, 0x00, 0x0f, 0xff,
+  0xf7, 0xce, 0x0f, 0xec, 0xff, 0x00, 0xfe, 0xfb, 0x00, 0x07, 0x1f, 0xc0, 0x3c, 0x3f, 0xf8, 0x1c, 0xff, 0xdc, 0xfe,
+  0xff, 0x0a, 0xfd, 0xff, 0xfc, 0x7c, 0x3f, 0xff, 0x00, 0x4f, 0xff, 0xef, 0x07, 0xec, 0xff, 0x00, 0xfe, 0xfd, 0x00,
+  0x04, 0x80, 0x00, 0x3f, 0x82, 0x71, 0xfd, 0xff, 0x00, 0xf8, 0xfc, 0xff, 0x00, 0xfc, 0xfe, 0xff, 0x04, 0xf0, 0x0f,
+  0xff, 0xff, 0x0f, 0xeb, 0xff, 0xfb, 0x00, 0x07, 0x7f, 0xc0, 0xc3, 0xff, 0xff, 0xfb, 0xff, 0xf9, 0xf8, 0xff, 0x04,
+  0xfe, 0x1f, 0xff, 0xff, 0x0f, 0xeb, 0xff, 0xfb, 0x00, 0x08, 0xff, 0x83, 0x87, 0x07, 0xff, 0xf7, 0xff, 0xfe, 0x7f,
+  0xf8, 0xff, 0x03, 0x87, 0xff, 0xbf, 0x03, 0xeb, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x0a, 0x40, 0x01, 0xff, 0x1d, 0x0c,
+  0x01, 0xff, 0xef, 0xff, 0xff, 0x3f, 0xf8, 0xff, 0x03, 0xc7, 0xfd, 0xff, 0x13, 0xeb, 0xff, 0x00, 0x80, 0xfd, 0x00,
+  0x04, 0x01, 0xff, 0x80, 0x38, 0x38, 0xfd, 0xff, 0x00, 0x3f, 0xfd, 0xff, 0x01, 0xfe, 0x7f, 0xfe, 0xff, 0x03, 0xf3,
+  0xfd, 0xff, 0x81, 0xeb, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0x04, 0x03, 0xfe, 0x08, 0x70, 0x38, 0xfd, 0xff, 0x00, 0x8f,
+  0xfd, 0xff, 0x08, 0xfe, 0x3f, 0xff, 0xfb, 0xff, 0xfb, 0xff, 0xff, 0x81, 0xeb, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0x05,
+  0x01, 0xfe, 0x00, 0xf0, 0x38, 0x7f, 0xfe, 0xff, 0x00, 0x87, 0xfd, 0xff, 0x01, 0xfe, 0x1f, 0xfd, 0xff, 0x02, 0xfd,
+  0xff, 0x80, 0xeb, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0x05, 0x01, 0xfe, 0x00, 0xe0, 0x30, 0x7f, 0xfe, 0xff, 0x00, 0x8b,
+  0xfd, 0xff, 0x04, 0xfe, 0x1f, 0xff, 0xfe, 0x77, 0xfe, 0xff, 0x00, 0x81, 0xeb, 0xff, 0x00, 0xe0, 0xfd, 0x00, 0x05,
+  0x01, 0xfe, 0x01, 0xe0, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0xcb, 0xfd, 0xff, 0x04, 0xf8, 0x0f, 0xff, 0x7f, 0xe3, 0xfe,
+  0xff, 0x00, 0x01, 0xeb, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x05, 0x01, 0xfc, 0x01, 0xe0, 0x00, 0x7f, 0xf9, 0xff, 0x04,
+  0xf0, 0x07, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0x00, 0x41, 0xeb, 0xff, 0x00, 0xf8, 0xfd, 0x00, 0x05, 0x01, 0xfc, 0x01,
+  0xe0, 0x10, 0x7f, 0xfa, 0xff, 0x05, 0xfe, 0xc0, 0x07, 0xff, 0xfe, 0x3f, 0xfe, 0xff, 0x00, 0xc0, 0xeb, 0xff, 0x00,
+  0xfc, 0xfd, 0x00, 0x05, 0x01, 0xfc, 0x01, 0xf0, 0x30, 0x7f, 0xfa, 0xff, 0x05, 0xfe, 0x80, 0x07, 0xff, 0xfc, 0x07,
+  0xfe, 0xff, 0x00, 0x00, 0xea, 0xff, 0xfc, 0x00, 0x03, 0x7e, 0x01, 0xf0, 0x00, 0xf8, 0xff, 0x09, 0x80, 0x0f, 0xff,
+  0xc8, 0x01, 0xff, 0xfe, 0x7f, 0x00, 0x7f, 0xeb, 0xff, 0x00, 0x80, 0xfd, 0x00, 0x03, 0x3e, 0x01, 0xf8, 0x01, 0xf9,
+  0xff, 0x05, 0xfe, 0x00, 0x0f, 0xdf, 0xd0, 0x01, 0xfe, 0xff, 0x01, 0xc1, 0x7f, 0xeb, 0xff, 0x00, 0xc0, 0xfd, 0x00,
+  0x03, 0x3e, 0x01, 0xfc, 0x03, 0xf9, 0xff, 0x05, 0xde, 0x00, 0x1a, 0xc9, 0x00, 0x01, 0xfe, 0xff, 0x00, 0x00, 0xea,
+  0xff, 0x00, 0xe0, 0xfd, 0x00, 0x04, 0x1f, 0x01, 0xff, 0x07, 0x7f, 0xfe, 0xff, 0x00, 0xf7, 0xfe, 0xff, 0x05, 0x98,
+  0x00, 0x0f, 0xbe, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xea, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x01, 0x02, 0x00, 0xfb,
+  0xff, 0x00, 0xf3, 0xfe, 0xff, 0x0a, 0xdc, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xeb, 0xff,
+  0x00, 0xf8, 0xfd, 0x00, 0x02, 0x03, 0x00, 0x7f, 0xfc, 0xff, 0x00, 0xf3, 0xfe, 0xff, 0x0a, 0xfc, 0x00, 0x1e, 0xdf,
+  0x00, 0x00, 0x7f, 0xff, 0xfd, 0xc0, 0x7f, 0xeb, 0xff, 0x03, 0xfc, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x01, 0x7f, 0xe7,
+  0xfd, 0xff, 0x00, 0xf9, 0xfe, 0xff, 0x0a, 0xfc, 0x00, 0x3c, 0xbf, 0x00, 0x00, 0x7f, 0xff, 0xfd, 0x80, 0x7f, 0xeb,
+  0xff, 0x00, 0xfe, 0xfb, 0x00, 0x01, 0x19, 0x8f, 0xfd, 0xff, 0x00, 0xfc, 0xfe, 0xff, 0x05, 0xfc, 0x00, 0x7f, 0x1c,
+  0x00, 0x00, 0xfe, 0xff, 0x01, 0x80, 0x7f, 0xea, 0xff, 0x02, 0x80, 0x00, 0x02, 0xfd, 0x00, 0x00, 0x3f, 0xfd, 0xff,
+  0x00, 0xfc, 0xfe, 0xff, 0x05, 0xf8, 0x00, 0x5f, 0x0c, 0x00, 0x06, 0xfe, 0xff, 0x01, 0x80, 0x7f, 0xea, 0xff, 0x02,
+  0x80, 0x00, 0x03, 0xfd, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x00, 0xfe, 0xfe, 0xff, 0x0a, 0xf8, 0x00, 0x5f, 0xee, 0x00,
+  0x7f, 0xff, 0xff, 0xf4, 0x80, 0x7f, 0xeb, 0xff, 0x07, 0xf8, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x01, 0xf8, 0xff,
+  0x0a, 0xf8, 0x00, 0xfd, 0xac, 0x00, 0x5f, 0xff, 0xff, 0xe0, 0x00, 0x7f, 0xeb, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x03,
+  0xa0, 0x00, 0x00, 0x07, 0xf8, 0xff, 0x0a, 0xf0, 0x01, 0xff, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x00, 0x7f, 0xeb,
+  0xff, 0x00, 0xc0, 0xfe, 0x00, 0x04, 0x40, 0x00, 0x00, 0x1f, 0xfc, 0xfe, 0xff, 0x00, 0xfb, 0xfd, 0xff, 0x0a, 0xf0,
+  0x03, 0xff, 0xb8, 0x00, 0xdf, 0xff, 0xff, 0x90, 0x00, 0x7f, 0xeb, 0xff, 0x08, 0xc8, 0x00, 0x00, 0x01, 0xe0, 0x00,
+  0x00, 0x3f, 0xf1, 0xf9, 0xff, 0x04, 0xe0, 0x03, 0xfb, 0xfc, 0x01, 0xfe, 0xff, 0x02, 0x32, 0x00, 0x7f, 0xeb, 0xff,
+  0x08, 0xcc, 0x00, 0x00, 0x01, 0xe0, 0x74, 0x00, 0xff, 0xe3, 0xf9, 0xff, 0x04, 0xe0, 0x03, 0xfb, 0xfc, 0x01, 0xfe,
+  0xff, 0x01, 0x30, 0x00, 0xea, 0xff, 0x01, 0xf3, 0x08, 0xfe, 0x00, 0x03, 0x7f, 0x80, 0x3f, 0x07, 0xfb, 0xff, 0x0c,
+  0x07, 0xff, 0xc0, 0x03, 0xff, 0xf8, 0x03, 0xbf, 0xff, 0xfd, 0x00, 0x00, 0x3f, 0xeb, 0xff, 0x08, 0xe0, 0x38, 0x00,
+  0x00, 0x10, 0x3f, 0x80, 0x18, 0x7f, 0xfc, 0xff, 0x0d, 0xf8, 0x03, 0xf8, 0x00, 0x03, 0xfe, 0xe0, 0x07, 0x3f, 0xff,
+  0xff, 0x80, 0x00, 0x07, 0xeb, 0xff, 0x07, 0xe0, 0x0c, 0x00, 0x00, 0x28, 0x3f, 0xe0, 0x00, 0xfb, 0xff, 0x0d, 0xf0,
+  0x01, 0x70, 0x00, 0x07, 0xf3, 0xe0, 0x07, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x01, 0xeb, 0xff, 0x00, 0xf0, 0xfe, 0x00,
+  0x03, 0x30, 0x3f, 0xf0, 0x03, 0xfb, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x0a, 0x07, 0xff, 0x00, 0x04, 0x3f, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x7f, 0xec, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x03, 0x18, 0x1f, 0xf8, 0x0f, 0xfd, 0xff, 0x02, 0xf9,
+  0xff, 0xe0, 0xfe, 0x00, 0x0a, 0x07, 0xff, 0x00, 0x0c, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xec, 0xff, 0x08,
+  0xf8, 0x00, 0x20, 0x00, 0x1c, 0x1f, 0xfc, 0x5f, 0xbf, 0xfe, 0xff, 0x02, 0xe0, 0xff, 0xc0, 0xfe, 0x00, 0x03, 0x0f,
+  0xfe, 0x00, 0x1d, 0xfe, 0xff, 0x03, 0x80, 0x00, 0x00, 0x0f, 0xec, 0xff, 0x07, 0xfe, 0x00, 0x80, 0x00, 0x0c, 0x1f,
+  0xff, 0xbf, 0xfd, 0xff, 0x02, 0xe0, 0x7f, 0x80, 0xfe, 0x00, 0x03, 0x1f, 0xfe, 0xc0, 0x1c, 0xfe, 0xff, 0x03, 0xc0,
+  0x00, 0x00, 0x07, 0xeb, 0xff, 0x06, 0x80, 0xc8, 0x00, 0x0c, 0x4b, 0xff, 0xbc, 0xfd, 0xff, 0x01, 0xf0, 0x3f, 0xfd,
+  0x00, 0x0a, 0x3f, 0xec, 0x80, 0x36, 0x7b, 0xff, 0xff, 0x80, 0x00, 0x00, 0x03, 0xeb, 0xff, 0x04, 0xc0, 0xca, 0x00,
+  0x07, 0x1b, 0xfb, 0xff, 0x01, 0xf8, 0x08, 0xfd, 0x00, 0x0a, 0x3f, 0xff, 0x80, 0xe0, 0x7f, 0xff, 0xff, 0x80, 0x00,
+  0x00, 0x01, 0xeb, 0xff, 0x04, 0xc0, 0x3f, 0x00, 0x02, 0x01, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x07, 0x3f, 0xff,
+  0x82, 0xc0, 0x7f, 0xff, 0xff, 0x80, 0xfe, 0x00, 0x00, 0x7f, 0xec, 0xff, 0x04, 0xe8, 0x37, 0x80, 0x00, 0x01, 0xfb,
+  0xff, 0x00, 0xfe, 0xfc, 0x00, 0x0b, 0x3f, 0xff, 0x01, 0xf0, 0x7f, 0xff, 0xff, 0xc0, 0x06, 0x00, 0x00, 0x3f, 0xec,
+  0xff, 0x04, 0xf0, 0x1e, 0x80, 0x00, 0x00, 0xfb, 0xff, 0x00, 0xfe, 0xfd, 0x00, 0x04, 0x01, 0xff, 0xff, 0x0d, 0xe0,
+  0xfe, 0xff, 0x04, 0xc0, 0x06, 0x00, 0x00, 0x1f, 0xec, 0xff, 0x01, 0xfe, 0x0f, 0xfe, 0x00, 0x00, 0x7f, 0xfc, 0xff,
+  0x00, 0xfe, 0xfd, 0x00, 0x04, 0x01, 0xff, 0xfe, 0x3f, 0xe0, 0xfe, 0xff, 0x04, 0xc0, 0x07, 0x00, 0x00, 0x0f, 0xeb,
+  0xff, 0x04, 0x8f, 0xe0, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x0c, 0x03, 0xff, 0xfc, 0x3f, 0xf2,
+  0x7f, 0xff, 0xff, 0x00, 0x07, 0x80, 0x00, 0x07, 0xeb, 0xff, 0x04, 0xc7, 0xf8, 0x00, 0x00, 0x7e, 0xfc, 0xff, 0x00,
+  0xdf, 0xfd, 0x00, 0x03, 0x03, 0xff, 0xf8, 0xcf, 0xfd, 0xff, 0x04, 0x00, 0x07, 0x80, 0x00, 0x03, 0xeb, 0xff, 0x04,
+  0xe3, 0xfc, 0x00, 0x00, 0x0e, 0xfc, 0xff, 0x01, 0x9f, 0x80, 0xfe, 0x00, 0x02, 0x0f, 0xf9, 0xf1, 0xfc, 0xff, 0x04,
+  0x00, 0x07, 0xc0, 0x00, 0x03, 0xea, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x0e, 0xfc, 0xff, 0x01, 0x9f, 0x80, 0xfe, 0x00,
+  0x0c, 0x1f, 0xf1, 0xc7, 0xbf, 0xf5, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xc0, 0x00, 0x01, 0xea, 0xff, 0x03, 0xfe, 0x00,
+  0x00, 0x06, 0xfc, 0xff, 0x01, 0x1f, 0xc0, 0xfe, 0x00, 0x0c, 0x1f, 0xe7, 0x8f, 0xff, 0xf7, 0xdf, 0xff, 0xfe, 0x00,
+  0x03, 0xe0, 0x00, 0x00, 0xe9, 0xff, 0xff, 0x00, 0x01, 0x06, 0xef, 0xfd, 0xff, 0x12, 0xbf, 0x80, 0x00, 0x00, 0x01,
+  0x9f, 0xdf, 0x1f, 0xff, 0xfd, 0xff, 0xff, 0xf6, 0x40, 0x03, 0xf0, 0x00, 0x00, 0x7f, 0xea, 0xff, 0x03, 0x80, 0x00,
+  0x02, 0xef, 0xfd, 0xff, 0x01, 0xbf, 0x80, 0xfe, 0x00, 0x0d, 0x3d, 0xfc, 0x3f, 0xfe, 0x3f, 0xff, 0xff, 0xfe, 0x40,
+  0x03, 0xf0, 0x00, 0x00, 0x3f, 0xeb, 0xff, 0x04, 0xef, 0xc0, 0x00, 0x02, 0x6f, 0xfd, 0xff, 0x01, 0x3f, 0x80, 0xfe,
+  0x00, 0x04, 0x48, 0x78, 0x7f, 0xff, 0x7f, 0xfe, 0xff, 0x05, 0x80, 0x03, 0xf8, 0x00, 0x00, 0x1f, 0xea, 0xff, 0x03,
+  0xc0, 0x00, 0x00, 0x6f, 0xfd, 0xff, 0x01, 0x7f, 0x80, 0xfd, 0x00, 0x0c, 0x70, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xef,
+  0x00, 0x03, 0xf8, 0x00, 0x00, 0x0f, 0xea, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x4f, 0xfd, 0xff, 0x01, 0xfe, 0x80, 0xfe,
+  0x00, 0x01, 0x01, 0xc1, 0xfc, 0xff, 0x06, 0x7f, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x03, 0xea, 0xff, 0x03, 0xf0, 0x10,
+  0x00, 0x07, 0xfd, 0xff, 0x00, 0x7e, 0xfc, 0x00, 0x0c, 0x07, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xfc,
+  0x00, 0x00, 0x01, 0xea, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x00, 0x7e, 0xfd, 0x00, 0x0a, 0x08, 0x0f,
+  0xff, 0xfd, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xfe, 0xfe, 0x00, 0xea, 0xff, 0x03, 0xf0, 0x40, 0x00, 0x03, 0xfd,
+  0xff, 0x00, 0x7f, 0xfd, 0x00, 0x0a, 0x60, 0x1f, 0xfd, 0xfd, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xfe, 0x00,
+  0x00, 0x7f, 0xeb, 0xff, 0x03, 0xf8, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x02, 0x7f, 0xff, 0xfd,
+  0xfe, 0xff, 0x03, 0xf0, 0x00, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x1f, 0xeb, 0xff, 0x03, 0xf8, 0x00, 0x00, 0x01, 0xfe,
+  0xff, 0x01, 0xfe, 0xf6, 0xfc, 0x00, 0x0d, 0xff, 0xf5, 0xff, 0x7f, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0x80, 0x00,
+  0x00, 0x07, 0xeb, 0xff, 0x03, 0xf8, 0x18, 0x00, 0x01, 0xfe, 0xff, 0x01, 0xfe, 0xe0, 0xfd, 0x00, 0x02, 0x03, 0xff,
+  0xe7, 0xfd, 0xff, 0x07, 0xf0, 0x00, 0x03, 0xff, 0x80, 0x00, 0x00, 0x01, 0xeb, 0xff, 0x03, 0xdc, 0x0c, 0x00, 0x01,
+  0xfe, 0xff, 0x01, 0xfc, 0xe0, 0xfd, 0x00, 0x02, 0x0f, 0xff, 0xc7, 0xfe, 0xff, 0x05, 0xfe, 0xf0, 0x00, 0x03, 0xff,
+  0xd8, 0xfe, 0x00, 0xeb, 0xff, 0x03, 0xec, 0x03, 0x00, 0x01, 0xfe, 0xff, 0x01, 0xfc, 0xe0, 0xfd, 0x00, 0x02, 0x1f,
+  0xfe, 0x1b, 0xfd, 0xff, 0x04, 0xf8, 0x00, 0x03, 0xff, 0xdc, 0xfe, 0x00, 0xeb, 0xff, 0x03, 0xf6, 0x00, 0x40, 0x00,
+  0xfe, 0xff, 0x01, 0xfe, 0xc0, 0xfd, 0x00, 0x02, 0x1f, 0xfc, 0x2e, 0xfd, 0xff, 0x04, 0xf8, 0x00, 0x03, 0xff, 0xee,
+  0xfe, 0x00, 0xeb, 0xff, 0x08, 0xfe, 0x80, 0x20, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x80, 0xfd, 0x00, 0x0b, 0x3f, 0xf3,
+  0x3a, 0xff, 0xf7, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xe7, 0xfe, 0x00, 0xeb, 0xff, 0x08, 0xfd, 0x80, 0x00, 0x00,
+  0x3f, 0xff, 0xff, 0xfc, 0x80, 0xfd, 0x00, 0x02, 0x1f, 0xc7, 0xfb, 0xfd, 0xff, 0x07, 0xd0, 0x00, 0x03, 0xff, 0xf3,
+  0x80, 0x00, 0x00, 0xeb, 0xff, 0x07, 0xfc, 0x0e, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0xfc, 0x00, 0x02, 0x5f, 0xc7,
+  0x3f, 0xfd, 0xff, 0x07, 0xc0, 0x00, 0x07, 0xff, 0xf1, 0x80, 0x00, 0x00, 0xeb, 0xff, 0x07, 0xfe, 0x07, 0x00, 0x00,
+  0x0f, 0xff, 0xff, 0xe1, 0xfc, 0x00, 0x02, 0x79, 0x07, 0x7f, 0xfd, 0xff, 0x07, 0xe0, 0x00, 0x07, 0xff, 0xf9, 0x80,
+  0x00, 0x00, 0xeb, 0xff, 0x07, 0xfe, 0x87, 0xc0, 0x00, 0x0e, 0x7f, 0xff, 0xe0, 0xfd, 0x00, 0x02, 0x08, 0x78, 0x03,
+  0xfd, 0xff, 0x08, 0xf7, 0x00, 0x00, 0x07, 0xff, 0xf9, 0xc0, 0x00, 0x00, 0xea, 0xff, 0x05, 0x87, 0xf0, 0x00, 0x00,
+  0x3f, 0xfe, 0xfa, 0x00, 0x00, 0x1f, 0xfc, 0xff, 0x07, 0x80, 0x00, 0x07, 0xff, 0xfd, 0xe0, 0x00, 0x00, 0xea, 0xff,
+  0x05, 0x83, 0xe0, 0x00, 0x00, 0x1f, 0x80, 0xfa, 0x00, 0x01, 0x19, 0xdf, 0xfd, 0xff, 0xff, 0x00, 0x05, 0x07, 0xff,
+  0xfc, 0xf0, 0x00, 0x00, 0xea, 0xff, 0x01, 0xc1, 0xf0, 0xfe, 0x00, 0x00, 0x80, 0xfa, 0x00, 0x01, 0x52, 0x7f, 0xfe,
+  0xff, 0x08, 0xfc, 0x00, 0x00, 0x07, 0xff, 0xfe, 0xf0, 0x00, 0x00, 0xea, 0xff, 0x01, 0xc1, 0xf0, 0xfc, 0x00, 0x00,
+  0x05, 0xfc, 0x00, 0x0d, 0x4b, 0xff, 0xdf, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x78, 0x00, 0x00, 0xea,
+  0xff, 0x01, 0xf0, 0xb0, 0xfc, 0x00, 0x00, 0x0d, 0xfc, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x08, 0xfb, 0x00, 0x00, 0x0f,
+  0xff, 0xff, 0xfc, 0x00, 0x00, 0xea, 0xff, 0x01, 0xf8, 0x18, 0xfc, 0x00, 0x01, 0x0f, 0xc0, 0xfd, 0x00, 0x00, 0x03,
+  0xfd, 0xff, 0x08, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xea, 0xff, 0x01, 0xfe, 0x10, 0xfc, 0x00,
+  0x01, 0x0f, 0xf8, 0xfd, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x08, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x7c, 0x00, 0x00,
+  0xea, 0xff, 0x01, 0xfb, 0x80, 0xfc, 0x00, 0x01, 0x0f, 0xf8, 0xfd, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x08, 0xf8, 0x00,
+  0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xe9, 0xff, 0x02, 0x40, 0x00, 0x08, 0xfe, 0x00, 0x02, 0x87, 0xf8, 0xc0,
+  0xfe, 0x00, 0x00, 0xdf, 0xfd, 0xff, 0x08, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xe9, 0xff, 0x02,
+  0xe0, 0x00, 0x1c, 0xfe, 0x00, 0x06, 0x07, 0xff, 0xc1, 0xa0, 0x00, 0x00, 0xfd, 0xfd, 0xff, 0x08, 0xf8, 0x00, 0x00,
+  0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xea, 0xff, 0x03, 0xfe, 0x70, 0x00, 0x1e, 0xfe, 0x00, 0x05, 0x3f, 0xff, 0xce,
+  0xb5, 0x00, 0x01, 0xfc, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0xff, 0x00, 0xe9, 0xff, 0x02, 0xbc, 0x0c,
+  0x1f, 0xfe, 0x00, 0x06, 0x08, 0xff, 0xec, 0x7e, 0x04, 0x80, 0xfd, 0xfd, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x3f, 0xfe,
+  0xff, 0xff, 0x00, 0xe9, 0xff, 0x02, 0xb4, 0x0e, 0xfe, 0xfe, 0x00, 0x06, 0x01, 0xff, 0xfe, 0x3e, 0x01, 0xc6, 0x9f,
+  0xfd, 0xff, 0x03, 0x60, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x01, 0x80, 0x00, 0xe9, 0xff, 0x02, 0xdf, 0x1f, 0x3c, 0xfe,
+  0x00, 0x06, 0x03, 0xff, 0xff, 0x7f, 0x80, 0x4f, 0xad, 0xfd, 0xff, 0x03, 0x80, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x01,
+  0x80, 0x00, 0xe9, 0xff, 0x02, 0xec, 0x02, 0x78, 0xfe, 0x00, 0x06, 0x01, 0xff, 0xf9, 0xb9, 0x9f, 0x3f, 0xbf, 0xfe,
+  0xff, 0x00, 0xfd, 0xfe, 0x00, 0xfd, 0xff, 0x01, 0x80, 0x00, 0xe9, 0xff, 0x02, 0xf3, 0xf0, 0xf0, 0xfd, 0x00, 0x04,
+  0xff, 0xe6, 0x78, 0x7d, 0x18, 0xfd, 0xff, 0x00, 0xfd, 0xfe, 0x00, 0xfd, 0xff, 0x01, 0xc0, 0x00, 0xe9, 0xff, 0x0c,
+  0xfe, 0x13, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x7e, 0x6f, 0x39, 0xe0, 0xef, 0xfe, 0xff, 0x00, 0xfa, 0xfe, 0x00,
+  0xfd, 0xff, 0x01, 0xc0, 0x00, 0xe7, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x06, 0xc0, 0x03, 0xf8, 0x7f, 0x39, 0xf0, 0x25,
+  0xfe, 0xff, 0x03, 0xe2, 0x00, 0x00, 0x01, 0xfd, 0xff, 0x01, 0xc0, 0x00, 0xe7, 0xff, 0xfe, 0x00, 0x07, 0x01, 0x60,
+  0x03, 0xc1, 0xdf, 0x1c, 0x11, 0xc7, 0xfe, 0xff, 0x03, 0xe8, 0x00, 0x00, 0x01, 0xfd, 0xff, 0x01, 0xe0, 0x00, 0xe8,
+  0xff, 0x00, 0xfe, 0xfe, 0x00, 0x06, 0x40, 0xf0, 0x00, 0x24, 0xc1, 0xdc, 0x3d, 0xfd, 0xff, 0x03, 0xe8, 0x00, 0x00,
+  0x03, 0xfd, 0xff, 0x01, 0xe0, 0x00, 0xe8, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x06, 0xf8, 0x00, 0x01, 0xc0, 0x01, 0x37,
+  0xbd, 0xfe, 0xff, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x01, 0xe0, 0x00, 0xe8, 0xff, 0x00, 0xf8, 0xfe, 0x00,
+  0x06, 0x01, 0xfc, 0x00, 0x01, 0x44, 0x01, 0x37, 0xfd, 0xff, 0x03, 0x40, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x01, 0xe0,
+  0x00, 0xe8, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x0a, 0x01, 0xff, 0x00, 0x00, 0x07, 0x06, 0x16, 0xff, 0xef, 0xff, 0xf4,
+  0xfe, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x01, 0xf0, 0x00, 0xe8, 0xff, 0x00, 0xe0, 0xfd, 0x00, 0x09, 0xff, 0x80, 0x00,
+  0x03, 0x04, 0x1c, 0xff, 0x9f, 0xff, 0xc0, 0xfe, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x01, 0xf0, 0x00, 0xe8, 0xff, 0x00,
+  0xc0, 0xfd, 0x00, 0x05, 0x7f, 0x80, 0x00, 0x00, 0x03, 0x1e, 0xfe, 0xff, 0x00, 0xd8, 0xfe, 0x00, 0x00, 0x1f, 0xfd,
+  0xff, 0x01, 0xf0, 0x20, 0xe8, 0xff, 0x00, 0x80, 0xfd, 0x00, 0x09, 0x7f, 0x80, 0x00, 0x00, 0x02, 0x02, 0x7f, 0xdf,
+  0xff, 0x40, 0xfe, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x01, 0xf0, 0x00, 0xe8, 0xff, 0xfc, 0x00, 0x09, 0x07, 0xc0, 0x00,
+  0x00, 0x08, 0x03, 0xf3, 0xa7, 0xd0, 0xc0, 0xfe, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x01, 0xf0, 0x00, 0xe9, 0xff, 0x00,
+  0xfe, 0xf7, 0x00, 0x03, 0x03, 0x43, 0x8f, 0xd8, 0xfd, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x01, 0xf8, 0x00, 0xe9, 0xff,
+  0x00, 0xfc, 0xf7, 0x00, 0x03, 0x10, 0x77, 0xa5, 0xc8, 0xfd, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x01, 0xf8, 0x80, 0xe9,
+  0xff, 0x00, 0xf0, 0xfb, 0x00, 0x00, 0x20, 0xfe, 0x00, 0x02, 0x11, 0x8f, 0xe4, 0xfc, 0x00, 0xfc, 0xff, 0x01, 0xf8,
+  0x00, 0xe9, 0xff, 0x00, 0xe0, 0xf6, 0x00, 0x01, 0x33, 0x40, 0xfd, 0x00, 0x00, 0x01, 0xfc, 0xff, 0x01, 0xf8, 0x00,
+  0xe9, 0xff, 0x00, 0xc0, 0xf0, 0x00, 0x00, 0x01, 0xfc, 0xff, 0x01, 0xf8, 0x00, 0xe9, 0xff, 0xf5, 0x00, 0x00, 0x04,
+  0xfc, 0x00, 0x00, 0x03, 0xfc, 0xff, 0x01, 0xf8, 0x00, 0xea, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x1c, 0xf5, 0x00,
+  0x00, 0x07, 0xfc, 0xff, 0x01, 0xfc, 0x00, 0xea, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x01, 0x1c, 0xc0, 0xf6, 0x00, 0x00,
+  0x0f, 0xfc, 0xff, 0x01, 0xfc, 0x00, 0xea, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x01, 0x3e, 0xf8, 0xf6, 0x00, 0x00, 0x1f,
+  0xfc, 0xff, 0x01, 0xfc, 0x00, 0xea, 0xff, 0x00, 0xc0, 0xfc, 0x00, 0x01, 0x7e, 0xff, 0xf6, 0x00, 0x00, 0x1f, 0xfc,
+  0xff, 0x01, 0xfc, 0x00, 0xea, 0xff, 0xfb, 0x00, 0x02, 0x7f, 0xff, 0xe0, 0xf7, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0x01,
+  0xfc, 0x00, 0xeb, 0xff, 0x00, 0xfe, 0xfb, 0x00, 0xff, 0xff, 0x00, 0xf8, 0xf7, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0x01,
+  0xfc, 0x00, 0xeb, 0xff, 0x00, 0xf8, 0xfb, 0x00, 0xff, 0xff, 0x00, 0xfc, 0xf7, 0x00, 0xfb, 0xff, 0x01, 0xfc, 0x00,
+  0xeb, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x03, 0x01, 0xff, 0xff, 0xfe, 0xf8, 0x00, 0x00, 0x01, 0xfb, 0xff, 0x01, 0xfc,
+  0x00, 0xeb, 0xff, 0x00, 0xc0, 0xfc, 0x00, 0x00, 0x01, 0xfe, 0xff, 0xf8, 0x00, 0x00, 0x03, 0xfb, 0xff, 0x01, 0xfc,
+  0x00, 0xeb, 0xff, 0xfb, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x00, 0x80, 0xf9, 0x00, 0x00, 0x07, 0xfb, 0xff, 0x01, 0xfc,
+  0x00, 0xec, 0xff, 0x00, 0xfc, 0xfb, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x00, 0xe0, 0xf9, 0x00, 0x00, 0x0f, 0xfb, 0xff,
+  0x01, 0xfc, 0x00, 0xec, 0xff, 0x00, 0xf8, 0xfb, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x00, 0xf0, 0xf9, 0x00, 0x00, 0x1f,
+  0xfb, 0xff, 0x01, 0xfe, 0x00, 0xec, 0xff, 0x00, 0xf0, 0xfb, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x00, 0xfc, 0xf9, 0x00,
+  0x00, 0x3f, 0xfb, 0xff, 0x01, 0xfe, 0x00, 0xec, 0xff, 0x00, 0xc0, 0xfb, 0x00, 0x00, 0x03, 0xfe, 0xff, 0x00, 0xfe,
+  0xf9, 0x00, 0x00, 0x7f, 0xfb, 0xff, 0x01, 0xfc, 0x00, 0xec, 0xff, 0x00, 0x80, 0xfb, 0x00, 0x00, 0x03, 0xfd, 0xff,
+  0xf9, 0x00, 0xfa, 0xff, 0x01, 0xfc, 0x00, 0xed, 0xff, 0x00, 0xfe, 0xfa, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x00, 0xc0,
+  0xfb, 0x00, 0x00, 0x01, 0xfa, 0xff, 0x01, 0xf8, 0x00, 0xed, 0xff, 0x00, 0xfc, 0xfa, 0x00, 0x00, 0x03, 0xfd, 0xff,
+  0x00, 0xf0, 0xfb, 0x00, 0x00, 0x03, 0xfa, 0xff, 0x01, 0xfc, 0x00, 0xed, 0xff, 0x00, 0xf0, 0xfa, 0x00, 0x00, 0x03,
+  0xfd, 0xff, 0x00, 0xfc, 0xfb, 0x00, 0x00, 0x17, 0xfa, 0xff, 0x01, 0xfc, 0x00, 0xed, 0xff, 0x00, 0xe0, 0xfa, 0x00,
+  0x00, 0x03, 0xfd, 0xff, 0x00, 0xfe, 0xfb, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x01, 0xfc, 0x00, 0xed, 0xff, 0x00, 0x80,
+  0xfa, 0x00, 0x00, 0x07, 0xfc, 0xff, 0x00, 0x80, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x01, 0xfe, 0x00, 0xed, 0xff,
+  0xf9, 0x00, 0x00, 0x07, 0xfc, 0xff, 0x00, 0xe0, 0xfc, 0x00, 0x00, 0x1f, 0xfa, 0xff, 0x01, 0xfc, 0x00, 0xfc, 0xff
 };
+
 constexpr unsigned char MrBeanAnticipated[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xa0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xf1,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3e, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xdb, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0x0f, 0xff, 0xff, 0xff, 0xfe, 0x67, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x3c, 0x01, 0xff, 0xff, 0xff, 0xf0, 0x15, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3c, 0x00, 0xff, 0xff,
-  0xff, 0xc0, 0x01, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3c, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x02, 0x80, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x3c, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x38, 0x00, 0x03, 0xff, 0xf8, 0x00,
-  0x00, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x30, 0x00, 0x01, 0xff, 0xd0, 0x00, 0x00, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x70,
-  0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x70, 0xc0, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x40,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x60, 0x70, 0xc7, 0x00, 0x7f, 0xc0, 0x1c, 0x80, 0x40, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0xf1, 0x90, 0x50,
-  0x3f, 0xc2, 0x0e, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0xf1, 0x8f, 0xc0, 0x3f, 0xc0, 0x39, 0x80, 0x20, 0x08, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x30, 0xf1, 0x19, 0x60, 0x1f, 0xc0, 0x68, 0xc0, 0x00, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xf0, 0x19, 0x30, 0x9f, 0xc0,
-  0xe0, 0xc0, 0x10, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xfe, 0x18, 0x39, 0xff, 0xf9, 0xe0, 0xc3, 0x90, 0x39, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8,
-  0xfc, 0x18, 0x7f, 0xff, 0xff, 0xf1, 0xc3, 0x40, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xfe, 0x07,
-  0xf0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf0, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-  0xff, 0xff, 0xdf, 0xf8, 0x1f, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe4, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xe8, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xf8, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0xf9,
-  0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xf8,
-  0x1f, 0xc0, 0x7f, 0xff, 0xf1, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xf8, 0x0f, 0xc0, 0x7f, 0xff, 0xf0, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x1f, 0xff, 0xfc, 0x01, 0x00, 0x7f, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfd, 0xfc, 0x00, 0x00,
-  0x7f, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfb, 0xfc, 0x00, 0x00, 0x7f, 0xbf, 0xe3, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xdf, 0xfc, 0xfd, 0x00, 0x00, 0x7f, 0xdf, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x30, 0x0d, 0x80, 0x01, 0x80, 0xee,
-  0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x78, 0x19, 0xc0, 0x00, 0x00, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3c,
-  0x00, 0x6f, 0x80, 0x00, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x9f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x9e, 0x00, 0x00, 0x00, 0x05, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x80, 0x0f,
-  0x80, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xc6, 0x70, 0x00, 0x1f, 0xfd, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf9, 0xff, 0xe3, 0xff, 0xe0, 0x3f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xf0, 0x7a, 0x00, 0x7f,
-  0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xf8, 0x08, 0xc1, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x7f, 0xfe, 0x27, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x7f, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x08, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x00, 0x40, 0xff, 0xff, 0xff,
-  0xf0, 0x0c, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x06, 0x40, 0x00, 0x60, 0x7f, 0xff, 0xff, 0xe0, 0x0c, 0x00, 0x00, 0x00, 0x78, 0xc0,
-  0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x06, 0x00,
-  0x00, 0x70, 0x3f, 0xff, 0xff, 0x00, 0x18, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x90, 0x00, 0x40, 0x00, 0xf0, 0x1f, 0xff, 0xfe, 0x00, 0x18,
-  0x00, 0x00, 0x00, 0x03, 0x40, 0x00, 0x3c, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x07, 0xff, 0xf0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x50, 0x58, 0x3b,
-  0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf6, 0x04, 0x10, 0x00, 0x00, 0x00, 0xfc,
-  0x01, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x80, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x6e, 0x82, 0xb0, 0x18, 0x40, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x02, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x81, 0xc0, 0x82,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x01, 0xa7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x7b, 0x12, 0x62, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00,
-  0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x02, 0x24, 0x11, 0x03, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x60, 0x07, 0x20, 0xc8, 0x00, 0x01, 0x40, 0x01, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x20, 0x89, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x26, 0x00, 0x10, 0x08, 0x80,
-  0x09, 0x01, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x01, 0x08, 0x00, 0x21, 0x13, 0xa2, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x59, 0x30, 0x30, 0x30, 0x00, 0x01, 0x41, 0xff, 0xfc, 0x00, 0x00, 0x1f,
-  0xfe, 0x00, 0x00, 0x60, 0xa0, 0x02, 0x62, 0x02, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96,
+  0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81,
+  0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0xee, 0xff,
+  0x03, 0x80, 0x00, 0x00, 0x03, 0xd4, 0xff, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x01, 0xd4, 0xff, 0x00, 0xf0, 0xfd, 0x00,
+  0xd4, 0xff, 0x00, 0xe0, 0xfd, 0x00, 0x00, 0x7f, 0xd5, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0x00, 0x3f, 0xd5, 0xff, 0x00,
+  0x80, 0xfd, 0x00, 0x00, 0x1f, 0xd5, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xd6, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x01,
+  0xd6, 0xff, 0x00, 0xfc, 0xfb, 0x00, 0xd6, 0xff, 0x00, 0xf8, 0xfb, 0x00, 0x00, 0x3f, 0xd7, 0xff, 0x00, 0xf0, 0xfb,
+  0x00, 0x00, 0x1f, 0xd7, 0xff, 0x00, 0xf0, 0xfb, 0x00, 0x00, 0x0f, 0xd7, 0xff, 0x00, 0xc0, 0xfb, 0x00, 0x00, 0x07,
+  0xd7, 0xff, 0x00, 0x80, 0xfb, 0x00, 0x00, 0x03, 0xd7, 0xff, 0x00, 0x80, 0xfb, 0x00, 0x00, 0x01, 0xd7, 0xff, 0x00,
+  0x80, 0xfa, 0x00, 0xd7, 0xff, 0xf9, 0x00, 0x00, 0x7f, 0xd9, 0xff, 0x00, 0xfe, 0xf9, 0x00, 0x00, 0x7f, 0xd9, 0xff,
+  0x00, 0xfc, 0xfd, 0x00, 0x04, 0x07, 0xfc, 0x00, 0x00, 0x3f, 0xd9, 0xff, 0x00, 0xfe, 0xfe, 0x00, 0x05, 0x07, 0xff,
+  0xff, 0xa0, 0x00, 0x3f, 0xd9, 0xff, 0x03, 0xfc, 0x00, 0x00, 0x01, 0xfe, 0xff, 0x02, 0xf0, 0x00, 0x1f, 0xd9, 0xff,
+  0x02, 0xf8, 0x00, 0x00, 0xfd, 0xff, 0x02, 0xf0, 0x00, 0x1f, 0xd9, 0xff, 0x01, 0xf8, 0x07, 0xfc, 0xff, 0x02, 0xf8,
+  0x00, 0x1f, 0xd9, 0xff, 0x01, 0xf8, 0x07, 0xfc, 0xff, 0x02, 0xfc, 0x00, 0x0f, 0xd9, 0xff, 0x01, 0xf0, 0x07, 0xfc,
+  0xff, 0x02, 0xfc, 0x00, 0x0f, 0xd9, 0xff, 0x01, 0xf0, 0x0f, 0xfc, 0xff, 0x02, 0xfe, 0x00, 0x0f, 0xd9, 0xff, 0x01,
+  0xf0, 0x07, 0xfc, 0xff, 0x02, 0xfe, 0x00, 0x0f, 0xd9, 0xff, 0x01, 0xf0, 0x07, 0xfc, 0xff, 0x02, 0xfc, 0x00, 0x0f,
+  0xd9, 0xff, 0x01, 0xf0, 0x07, 0xfc, 0xff, 0x02, 0xf8, 0x00, 0x0f, 0xd9, 0xff, 0x01, 0xf0, 0x07, 0xfc, 0xff, 0x02,
+  0xf8, 0x00, 0x0f, 0xd9, 0xff, 0x01, 0xe0, 0x07, 0xfc, 0xff, 0x02, 0xf8, 0x00, 0x0f, 0xd9, 0xff, 0x01, 0xe0, 0x07,
+  0xfc, 0xff, 0x02, 0xf8, 0x00, 0x0f, 0xd9, 0xff, 0x01, 0xe0, 0x0f, 0xfd, 0xff, 0x03, 0xfa, 0xf8, 0x00, 0x0f, 0xd9,
+  0xff, 0x01, 0xc0, 0x1f, 0xfc, 0xff, 0x02, 0xf8, 0x00, 0x0f, 0xd9, 0xff, 0x02, 0xc0, 0x1f, 0xc7, 0xfd, 0xff, 0x02,
+  0xf1, 0x00, 0x0f, 0xd9, 0xff, 0x02, 0xc0, 0x1f, 0x3f, 0xfd, 0xff, 0x02, 0x78, 0x00, 0x0f, 0xd9, 0xff, 0x01, 0xc0,
+  0x3e, 0xfc, 0xff, 0x02, 0xdb, 0x00, 0x0f, 0xd9, 0xff, 0x02, 0xc0, 0x1f, 0x0f, 0xfe, 0xff, 0x03, 0xfe, 0x67, 0x00,
+  0x0f, 0xd9, 0xff, 0x02, 0xc0, 0x3c, 0x01, 0xfe, 0xff, 0x03, 0xf0, 0x15, 0x80, 0x0f, 0xd9, 0xff, 0x02, 0xc0, 0x3c,
+  0x00, 0xfe, 0xff, 0x03, 0xc0, 0x01, 0x80, 0x0f, 0xd9, 0xff, 0x09, 0xc0, 0x3c, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x02,
+  0x80, 0x07, 0xd9, 0xff, 0x09, 0xe0, 0x3c, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x01, 0xc0, 0x07, 0xd9, 0xff, 0x09, 0xe0,
+  0x38, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x80, 0x07, 0xd9, 0xff, 0x09, 0xe0, 0x30, 0x00, 0x01, 0xff, 0xd0, 0x00,
+  0x00, 0xc0, 0x07, 0xd9, 0xff, 0x05, 0xe0, 0x70, 0x00, 0x00, 0xff, 0xc0, 0xfe, 0x00, 0x00, 0x03, 0xd9, 0xff, 0x09,
+  0xe0, 0x70, 0xc0, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x40, 0x03, 0xda, 0xff, 0x0a, 0xfe, 0x60, 0x70, 0xc7, 0x00, 0x7f,
+  0xc0, 0x1c, 0x80, 0x40, 0x01, 0xda, 0xff, 0x07, 0xfe, 0x30, 0xf1, 0x90, 0x50, 0x3f, 0xc2, 0x0e, 0xfe, 0x00, 0xd9,
+  0xff, 0x09, 0x30, 0xf1, 0x8f, 0xc0, 0x3f, 0xc0, 0x39, 0x80, 0x20, 0x08, 0xd9, 0xff, 0x09, 0x30, 0xf1, 0x19, 0x60,
+  0x1f, 0xc0, 0x68, 0xc0, 0x00, 0x19, 0xd9, 0xff, 0x09, 0x38, 0xf0, 0x19, 0x30, 0x9f, 0xc0, 0xe0, 0xc0, 0x10, 0x19,
+  0xd9, 0xff, 0x09, 0xb8, 0xfe, 0x18, 0x39, 0xff, 0xf9, 0xe0, 0xc3, 0x90, 0x39, 0xd9, 0xff, 0x09, 0xb8, 0xfc, 0x18,
+  0x7f, 0xff, 0xff, 0xf1, 0xc3, 0x40, 0x39, 0xd9, 0xff, 0x02, 0xf8, 0xff, 0x8f, 0xfe, 0xff, 0x03, 0xfe, 0x07, 0xf0,
+  0x3b, 0xd9, 0xff, 0x00, 0xf8, 0xfb, 0xff, 0x02, 0xef, 0xf0, 0x3b, 0xd9, 0xff, 0x00, 0xf8, 0xfd, 0xff, 0x04, 0xdf,
+  0xf8, 0x1f, 0xf0, 0x3f, 0xd9, 0xff, 0x00, 0xf8, 0xfa, 0xff, 0x01, 0xc0, 0x3f, 0xd9, 0xff, 0x00, 0xf9, 0xfa, 0xff,
+  0x01, 0xe0, 0x3f, 0xd9, 0xff, 0x00, 0xf9, 0xfa, 0xff, 0x01, 0xe4, 0x3f, 0xd9, 0xff, 0x00, 0xfb, 0xfd, 0xff, 0x04,
+  0xf7, 0xff, 0xff, 0xe8, 0x7f, 0xd4, 0xff, 0x04, 0xf7, 0xff, 0xff, 0xf0, 0x7f, 0xd1, 0xff, 0x01, 0xe0, 0x7f, 0xd3,
+  0xff, 0x02, 0x7f, 0xff, 0xf0, 0xd8, 0xff, 0x00, 0xf7, 0xfc, 0xff, 0x03, 0x7f, 0xff, 0xf8, 0x9f, 0xd9, 0xff, 0x01,
+  0xfe, 0x9f, 0xfd, 0xff, 0x03, 0x5f, 0xff, 0xf9, 0xbf, 0xd9, 0xff, 0x01, 0xfe, 0x9f, 0xfe, 0xff, 0x03, 0xc0, 0x7f,
+  0xff, 0xf9, 0xd7, 0xff, 0x08, 0x1f, 0xff, 0xf8, 0x1f, 0xc0, 0x7f, 0xff, 0xf1, 0x7f, 0xd9, 0xff, 0x08, 0xfe, 0x1f,
+  0xff, 0xf8, 0x0f, 0xc0, 0x7f, 0xff, 0xf0, 0xd7, 0xff, 0x07, 0x1f, 0xff, 0xfc, 0x01, 0x00, 0x7f, 0xff, 0xf3, 0xd7,
+  0xff, 0x07, 0x9f, 0xfd, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xf3, 0xd7, 0xff, 0x07, 0xdf, 0xfb, 0xfc, 0x00, 0x00, 0x7f,
+  0xbf, 0xe3, 0xd7, 0xff, 0x07, 0xdf, 0xfc, 0xfd, 0x00, 0x00, 0x7f, 0xdf, 0xc3, 0xd7, 0xff, 0x07, 0xf8, 0x30, 0x0d,
+  0x80, 0x01, 0x80, 0xee, 0xcf, 0xd7, 0xff, 0x07, 0xf8, 0x78, 0x19, 0xc0, 0x00, 0x00, 0xff, 0xcf, 0xd7, 0xff, 0x07,
+  0xfc, 0x3c, 0x00, 0x6f, 0x80, 0x00, 0xff, 0xcf, 0xd6, 0xff, 0x00, 0xbc, 0xfd, 0x00, 0x01, 0xfd, 0x9f, 0xd6, 0xff,
+  0x00, 0x9e, 0xfe, 0x00, 0x02, 0x05, 0xff, 0x9f, 0xd6, 0xff, 0x06, 0xdf, 0x80, 0x0f, 0x80, 0x0f, 0xff, 0x0f, 0xd7,
+  0xff, 0x07, 0xfb, 0xff, 0xc6, 0x70, 0x00, 0x1f, 0xfd, 0x1f, 0xd7, 0xff, 0x07, 0xf9, 0xff, 0xe3, 0xff, 0xe0, 0x3f,
+  0xf8, 0x1f, 0xd7, 0xff, 0x07, 0xf9, 0xff, 0xf0, 0x7a, 0x00, 0x7f, 0xf0, 0x1f, 0xd7, 0xff, 0x07, 0xe0, 0xff, 0xf8,
+  0x08, 0xc1, 0xff, 0xc0, 0x07, 0xd7, 0xff, 0x07, 0x80, 0x7f, 0xfe, 0x27, 0xff, 0xff, 0xc0, 0x01, 0xd7, 0xff, 0x01,
+  0x00, 0x3f, 0xfd, 0xff, 0x02, 0x80, 0x00, 0x7f, 0xd9, 0xff, 0x02, 0xfc, 0x00, 0x0f, 0xfd, 0xff, 0x02, 0x80, 0x00,
+  0x0f, 0xd9, 0xff, 0x02, 0xf8, 0x00, 0x03, 0xfd, 0xff, 0xfe, 0x00, 0xd9, 0xff, 0x02, 0xe0, 0x00, 0x01, 0xfd, 0xff,
+  0xfe, 0x00, 0x00, 0x1f, 0xdc, 0xff, 0x04, 0xfe, 0x7f, 0x80, 0x00, 0x01, 0xfe, 0xff, 0x04, 0xfc, 0x00, 0x00, 0x08,
+  0x1f, 0xdb, 0xff, 0x03, 0x03, 0x80, 0x00, 0x40, 0xfe, 0xff, 0x01, 0xf0, 0x0c, 0xfe, 0x00, 0xdc, 0xff, 0x09, 0xe0,
+  0x06, 0x40, 0x00, 0x60, 0x7f, 0xff, 0xff, 0xe0, 0x0c, 0xfe, 0x00, 0x02, 0x78, 0xc0, 0xbd, 0xdf, 0xff, 0x09, 0x88,
+  0x06, 0x00, 0x00, 0x70, 0x3f, 0xff, 0xff, 0x00, 0x18, 0xfe, 0x00, 0x03, 0x40, 0x00, 0x01, 0x7f, 0xe1, 0xff, 0x0a,
+  0xfd, 0x90, 0x00, 0x40, 0x00, 0xf0, 0x1f, 0xff, 0xfe, 0x00, 0x18, 0xfe, 0x00, 0x04, 0x03, 0x40, 0x00, 0x3c, 0xf7,
+  0xe2, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x05, 0xf8, 0x07, 0xff, 0xf0, 0x00, 0x38, 0xfd, 0x00, 0x03, 0x50, 0x58, 0x3b,
+  0xb7, 0xe4, 0xff, 0x03, 0xde, 0xf6, 0x04, 0x10, 0xfe, 0x00, 0x05, 0xfc, 0x01, 0x78, 0x00, 0x00, 0x78, 0xfd, 0x00,
+  0x03, 0x80, 0x10, 0x80, 0x8f, 0xe4, 0xff, 0x07, 0x00, 0x6e, 0x82, 0xb0, 0x18, 0x40, 0x00, 0xfe, 0xfd, 0x00, 0x00,
+  0x78, 0xfc, 0x00, 0x02, 0x08, 0x02, 0xa3, 0xe5, 0xff, 0x03, 0xf8, 0x81, 0xc0, 0x82, 0xfd, 0x00, 0x00, 0xff, 0xfd,
+  0x00, 0x00, 0xf8, 0xfd, 0x00, 0x03, 0x08, 0x40, 0x01, 0xa7, 0xe5, 0xff, 0x03, 0xc5, 0x7b, 0x12, 0x62, 0xfd, 0x00,
+  0x05, 0xff, 0x80, 0x00, 0x00, 0x01, 0xf8, 0xfe, 0x00, 0x04, 0x02, 0x24, 0x11, 0x03, 0x97, 0xe5, 0xff, 0x0d, 0x60,
+  0x07, 0x20, 0xc8, 0x00, 0x01, 0x40, 0x01, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xfc, 0xfd, 0x00, 0x03, 0x02, 0x20, 0x89,
+  0xf9, 0xe6, 0xff, 0x16, 0xfe, 0x30, 0x26, 0x00, 0x10, 0x08, 0x80, 0x09, 0x01, 0xff, 0xf0, 0x00, 0x00, 0x0f, 0xfe,
+  0x00, 0x00, 0x01, 0x08, 0x00, 0x21, 0x13, 0xa2, 0xe5, 0xff, 0x01, 0xa2, 0x59, 0xfe, 0x30, 0x11, 0x00, 0x01, 0x41,
+  0xff, 0xfc, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x60, 0xa0, 0x02, 0x62, 0x02, 0x1f, 0x7f, 0xe6, 0xff, 0x15, 0x96,
   0x31, 0x22, 0x64, 0x03, 0x80, 0x00, 0x03, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x01, 0x00, 0x00, 0x80, 0x81,
-  0x11, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x60, 0x2c, 0x00, 0x07, 0x00, 0x01, 0x03,
-  0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x00, 0x04, 0x40, 0x06, 0x98, 0x10, 0x29, 0xa3, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfb, 0xc6, 0xe2, 0xdc, 0x1a, 0x22, 0x77, 0x52, 0x07, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0x00,
-  0x08, 0x20, 0x04, 0x19, 0x30, 0xc1, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x9c, 0xc1, 0x92,
-  0x34, 0x5c, 0x55, 0x40, 0x07, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x88, 0x14, 0x02, 0x12, 0x00, 0x28,
-  0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x83, 0x02, 0x0c, 0x52, 0xb2, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x08, 0x00, 0x01, 0x40, 0x06, 0x22, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xd2, 0xc8, 0x96, 0x88, 0x88, 0x01, 0xdc, 0x46, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x24,
-  0x08, 0x00, 0x20, 0xc9, 0x12, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xc9, 0x44, 0xd0, 0x21, 0x03,
-  0x78, 0xc8, 0x07, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0x21, 0x05, 0x93, 0xc0, 0x00, 0x99, 0x91, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x58, 0x27, 0x91, 0xe6, 0x49, 0xb9, 0x11, 0x07, 0xff, 0xff, 0xf0, 0x0f,
-  0xff, 0xff, 0x80, 0x81, 0x49, 0xc0, 0x10, 0x83, 0x21, 0x48, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
-  0x0e, 0x70, 0x82, 0xe0, 0x3c, 0xa3, 0x7a, 0x0f, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0x04, 0x04, 0x76, 0x00, 0x02,
-  0x60, 0x20, 0x00, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x80, 0x4b, 0x04, 0xc8, 0x1d, 0xbe, 0x78,
-  0x0f, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0x10, 0x04, 0xe3, 0x10, 0x06, 0x90, 0x10, 0x10, 0x5f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0xcc, 0x70, 0x69, 0x98, 0x22, 0xcc, 0x83, 0xef, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff,
-  0x80, 0x83, 0x08, 0xd0, 0x04, 0x40, 0x04, 0xc1, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xc1, 0x70,
-  0x39, 0x82, 0x01, 0x03, 0xf8, 0x0f, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0x8c, 0xc9, 0x37, 0x01, 0x40, 0x40, 0x44,
-  0x20, 0x64, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe6, 0x8f, 0x68, 0x93, 0x4a, 0x03, 0x13, 0xf4, 0x2f, 0xff,
-  0xff, 0xe0, 0x03, 0xff, 0xff, 0xd8, 0x1c, 0x83, 0xf0, 0x24, 0xe2, 0x06, 0x40, 0xdc, 0x4f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x6b, 0x85, 0xc0, 0xbe, 0xe6, 0x08, 0x04, 0xd2, 0xbf, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xb8, 0x03,
-  0x38, 0x30, 0x27, 0x82, 0x00, 0x40, 0x28, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x53, 0x85, 0xbb, 0x2f, 0x64,
-  0x07, 0xee, 0x0a, 0x1f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xad, 0x5c, 0x36, 0x40, 0x01, 0x89, 0x81, 0x60, 0x29,
-  0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x01, 0x0d, 0x04, 0xbd, 0xcd, 0x03, 0xdd, 0xb5, 0x9f, 0xff, 0xff, 0xf0,
-  0x1f, 0xff, 0xff, 0x90, 0x7c, 0x61, 0x80, 0x02, 0x2c, 0xdc, 0x60, 0x10, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec,
-  0x07, 0x19, 0x64, 0x4d, 0x80, 0x40, 0x88, 0xca, 0x9f, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xa8, 0x64, 0x24, 0x80,
-  0x50, 0x64, 0x08, 0x08, 0x12, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x5b, 0x90, 0xcb, 0x57, 0x67, 0x73, 0xc5,
-  0x25, 0x3f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xc4, 0xda, 0xbb, 0x00, 0x48, 0x9b, 0x20, 0x40, 0x12, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x29, 0x18, 0x02, 0x8b, 0x16, 0x37, 0x30, 0x1e, 0x4a, 0xbf, 0xff, 0xff, 0xf0, 0x3f, 0xff,
-  0xff, 0xa5, 0xa3, 0x60, 0x00, 0x01, 0xbb, 0xa6, 0x41, 0x82, 0x20, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0x00, 0x21,
-  0xd6, 0xc8, 0xa0, 0x00, 0xb7, 0x19, 0x3f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x90, 0x00, 0x90, 0x00, 0x01, 0xc1,
-  0x86, 0x03, 0x00, 0xc2, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xc3, 0x28, 0x59, 0x52, 0xcc, 0xcc, 0x33, 0x50, 0x42, 0x7f,
-  0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x90, 0x42, 0x40, 0x00, 0x1e, 0x6c, 0x41, 0x20, 0x42, 0x03, 0x2b, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x02, 0xc8, 0x12, 0x29, 0x30, 0x10, 0x29, 0x28, 0x29, 0x7f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xbc,
-  0xa3, 0x48, 0x11, 0x32, 0xd0, 0x00, 0x21, 0x46, 0xc4, 0x49, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x07, 0x6e, 0xad, 0x89, 0x52,
-  0x39, 0x14, 0xd7, 0x57, 0x7f, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0x8a, 0x14, 0xce, 0x1c, 0x31, 0x96, 0x30, 0xe1,
-  0xc1, 0x84, 0xbd, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0x41, 0x18, 0x49, 0x32, 0x60, 0x77, 0xea, 0x49, 0x2d, 0xbf, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xc4, 0x86, 0x46, 0xac, 0x00, 0x8c, 0x00, 0x00, 0x84, 0x00, 0x02, 0x9b, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3,
-  0x21, 0x00, 0x52, 0x32, 0x44, 0x29, 0x14, 0x14, 0x10, 0x7f, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xd2, 0x05, 0x41,
-  0x00, 0x03, 0x80, 0x86, 0x40, 0x00, 0x01, 0x9c, 0x37, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x60, 0x02, 0x00, 0x92, 0x20, 0x49, 0xd8, 0xea,
-  0x58, 0x01, 0x7f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xf4, 0x99, 0x3c, 0x58, 0x06, 0x24, 0x01, 0x30, 0x00, 0x09,
-  0x78, 0x3b, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf5, 0xc4, 0x12, 0x00, 0x47, 0x5c, 0x08, 0x6b, 0xd4, 0x36, 0x34, 0x7f, 0xff, 0xff, 0x80, 0x1f,
-  0xff, 0xff, 0xc1, 0x4a, 0xef, 0xd0, 0x01, 0x99, 0x88, 0x25, 0x48, 0x28, 0x61, 0xad, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x18, 0xc3, 0x09,
-  0x65, 0x93, 0x12, 0x4e, 0xeb, 0xc9, 0xcf, 0x7f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xf4, 0xcd, 0xc7, 0x64, 0x01,
-  0xd9, 0x80, 0x06, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x76, 0x80, 0x18, 0x58, 0xb1, 0x02, 0x6d, 0xb4, 0x1f, 0x29,
-  0x7f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xca, 0xb0, 0x81, 0xa3, 0x00, 0x21, 0x81, 0x82, 0x00, 0x09, 0x8e, 0x46,
-  0x03, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xda, 0xf4, 0x0e, 0x00, 0xa1, 0x36, 0x00, 0x41, 0x63, 0xf9, 0x4b, 0x7f, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff,
-  0xc1, 0x71, 0xc1, 0x28, 0x06, 0x20, 0x00, 0x00, 0x20, 0xa6, 0x38, 0x45, 0xc0, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xd4, 0xc9, 0x00, 0x01, 0x22, 0x69,
-  0x0c, 0x3a, 0xbd, 0x1e, 0x8d, 0x7f, 0xff, 0xff, 0x02, 0x0f, 0xff, 0xff, 0xf4, 0x82, 0x64, 0xc2, 0x04, 0x32, 0x01,
-  0x05, 0x00, 0x00, 0x00, 0x84, 0x0d, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x88, 0x11, 0x58, 0x40, 0x4c, 0x4d, 0x9e, 0x74, 0xdb, 0x6b, 0x44, 0xff, 0xff,
-  0xff, 0x00, 0x0f, 0xff, 0xff, 0xc8, 0x01, 0xcd, 0x22, 0x00, 0x91, 0x00, 0x6c, 0x28, 0x00, 0x21, 0x80, 0x00, 0x2d,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x20,
-  0x82, 0x10, 0x40, 0x85, 0x20, 0x18, 0xd9, 0xa9, 0x9e, 0xad, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0xd8,
-  0xa6, 0x0d, 0x00, 0x09, 0xa1, 0xe0, 0x00, 0xb8, 0xc4, 0x07, 0x71, 0xb9, 0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x30, 0x00, 0x00, 0x00, 0x08, 0xba, 0x42, 0x26,
-  0xd1, 0x2b, 0x50, 0xff, 0xff, 0xff, 0x20, 0x0f, 0xff, 0xff, 0xcc, 0x2a, 0xac, 0xd2, 0x03, 0x84, 0x01, 0x10, 0x40,
-  0x51, 0x10, 0x84, 0xfd, 0x23, 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x90, 0x20, 0x06, 0x00, 0x00, 0x0b, 0x64, 0x04, 0x6d, 0xe2, 0x85, 0x21, 0xff, 0xff, 0xff, 0x00,
-  0x0f, 0xff, 0xff, 0xd0, 0x15, 0xfb, 0x70, 0x03, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x18, 0x06, 0x35, 0xc7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x80, 0x20, 0x00, 0x00,
-  0x00, 0x20, 0x60, 0x00, 0x32, 0x90, 0x8b, 0xd0, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xc5, 0xcb, 0x4f, 0x28,
-  0x00, 0x58, 0x00, 0x50, 0x00, 0x42, 0x50, 0x00, 0x01, 0x84, 0x0d, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x34, 0x60, 0x04, 0x80, 0x01, 0xa2, 0x88, 0x4c, 0x4d, 0xe0, 0x85,
-  0x09, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xda, 0x22, 0x8a, 0xf4, 0x01, 0x80, 0xa1, 0x00, 0x03, 0x64, 0xe0,
-  0x43, 0x21, 0x11, 0xaa, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf9, 0x12, 0x22, 0x1c, 0x03, 0x10, 0xa9, 0x00, 0x18, 0x34, 0x9b, 0x4a, 0xa6, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff,
-  0xff, 0xd2, 0x41, 0x6e, 0x5a, 0x00, 0x06, 0x10, 0x21, 0x02, 0xe3, 0x20, 0x01, 0x22, 0x97, 0xbf, 0xfb, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x04, 0x03, 0x00, 0x42, 0x00, 0x31,
-  0x24, 0xd2, 0x39, 0x65, 0xac, 0x5d, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xc5, 0x06, 0xc1, 0xa6, 0x07, 0x30,
-  0x00, 0x30, 0x00, 0x18, 0x80, 0x00, 0x00, 0x1e, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x33, 0x50, 0x20, 0x08, 0x00, 0x12, 0xc0, 0x22, 0x14, 0x8b, 0x5b, 0xc2, 0xff,
+  0x11, 0x03, 0xe5, 0xff, 0x16, 0x86, 0x60, 0x2c, 0x00, 0x07, 0x00, 0x01, 0x03, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff,
+  0x00, 0x04, 0x40, 0x06, 0x98, 0x10, 0x29, 0xa3, 0x3f, 0xe7, 0xff, 0x16, 0xfb, 0xc6, 0xe2, 0xdc, 0x1a, 0x22, 0x77,
+  0x52, 0x07, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0x00, 0x08, 0x20, 0x04, 0x19, 0x30, 0xc1, 0xe4, 0xe6, 0xff, 0x17,
+  0xe9, 0x9c, 0xc1, 0x92, 0x34, 0x5c, 0x55, 0x40, 0x07, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x88, 0x14,
+  0x02, 0x12, 0x00, 0x28, 0x5f, 0xe7, 0xff, 0x08, 0xf3, 0x00, 0x83, 0x02, 0x0c, 0x52, 0xb2, 0x00, 0x07, 0xfb, 0xff,
+  0xff, 0x00, 0x06, 0x08, 0x00, 0x01, 0x40, 0x06, 0x22, 0x0f, 0xe7, 0xff, 0x08, 0xd2, 0xc8, 0x96, 0x88, 0x88, 0x01,
+  0xdc, 0x46, 0x07, 0xfb, 0xff, 0x08, 0x00, 0x01, 0x24, 0x08, 0x00, 0x20, 0xc9, 0x12, 0x0f, 0xe7, 0xff, 0x08, 0xf0,
+  0xc9, 0x44, 0xd0, 0x21, 0x03, 0x78, 0xc8, 0x07, 0xfe, 0xff, 0x0b, 0x1f, 0xff, 0xff, 0x21, 0x05, 0x93, 0xc0, 0x00,
+  0x99, 0x91, 0x00, 0x07, 0xe7, 0xff, 0x17, 0xd2, 0x58, 0x27, 0x91, 0xe6, 0x49, 0xb9, 0x11, 0x07, 0xff, 0xff, 0xf0,
+  0x0f, 0xff, 0xff, 0x80, 0x81, 0x49, 0xc0, 0x10, 0x83, 0x21, 0x48, 0x2d, 0xe7, 0xff, 0x17, 0xe3, 0x0e, 0x70, 0x82,
+  0xe0, 0x3c, 0xa3, 0x7a, 0x0f, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0x04, 0x04, 0x76, 0x00, 0x02, 0x60, 0x20, 0x00,
+  0x13, 0xe7, 0xff, 0x17, 0xaa, 0x80, 0x4b, 0x04, 0xc8, 0x1d, 0xbe, 0x78, 0x0f, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff,
+  0x10, 0x04, 0xe3, 0x10, 0x06, 0x90, 0x10, 0x10, 0x5f, 0xe7, 0xff, 0x17, 0xf8, 0xcc, 0x70, 0x69, 0x98, 0x22, 0xcc,
+  0x83, 0xef, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0x80, 0x83, 0x08, 0xd0, 0x04, 0x40, 0x04, 0xc1, 0x16, 0xe7, 0xff,
+  0x18, 0xf1, 0xc1, 0x70, 0x39, 0x82, 0x01, 0x03, 0xf8, 0x0f, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0x8c, 0xc9, 0x37,
+  0x01, 0x40, 0x40, 0x44, 0x20, 0x64, 0x7f, 0xe9, 0xff, 0x19, 0xfd, 0xe6, 0x8f, 0x68, 0x93, 0x4a, 0x03, 0x13, 0xf4,
+  0x2f, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xd8, 0x1c, 0x83, 0xf0, 0x24, 0xe2, 0x06, 0x40, 0xdc, 0x4f, 0xe8, 0xff,
+  0x18, 0x6b, 0x85, 0xc0, 0xbe, 0xe6, 0x08, 0x04, 0xd2, 0xbf, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xb8, 0x03, 0x38,
+  0x30, 0x27, 0x82, 0x00, 0x40, 0x28, 0x5f, 0xe9, 0xff, 0x19, 0xfc, 0x53, 0x85, 0xbb, 0x2f, 0x64, 0x07, 0xee, 0x0a,
+  0x1f, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xad, 0x5c, 0x36, 0x40, 0x01, 0x89, 0x81, 0x60, 0x29, 0xb7, 0xe9, 0xff,
+  0x19, 0xf1, 0x01, 0x0d, 0x04, 0xbd, 0xcd, 0x03, 0xdd, 0xb5, 0x9f, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0x90, 0x7c,
+  0x61, 0x80, 0x02, 0x2c, 0xdc, 0x60, 0x10, 0x07, 0xe9, 0xff, 0x19, 0xec, 0x07, 0x19, 0x64, 0x4d, 0x80, 0x40, 0x88,
+  0xca, 0x9f, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xa8, 0x64, 0x24, 0x80, 0x50, 0x64, 0x08, 0x08, 0x12, 0x43, 0xe9,
+  0xff, 0x19, 0x77, 0x5b, 0x90, 0xcb, 0x57, 0x67, 0x73, 0xc5, 0x25, 0x3f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xc4,
+  0xda, 0xbb, 0x00, 0x48, 0x9b, 0x20, 0x40, 0x12, 0x00, 0xe9, 0xff, 0x1a, 0x29, 0x18, 0x02, 0x8b, 0x16, 0x37, 0x30,
+  0x1e, 0x4a, 0xbf, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xa5, 0xa3, 0x60, 0x00, 0x01, 0xbb, 0xa6, 0x41, 0x82, 0x20,
+  0x7f, 0xeb, 0xff, 0x1b, 0xfe, 0x4f, 0x00, 0x21, 0xd6, 0xc8, 0xa0, 0x00, 0xb7, 0x19, 0x3f, 0xff, 0xff, 0xe0, 0x3f,
+  0xff, 0xff, 0x90, 0x00, 0x90, 0x00, 0x01, 0xc1, 0x86, 0x03, 0x00, 0xc2, 0x7f, 0xeb, 0xff, 0x1c, 0xf8, 0xc3, 0x28,
+  0x59, 0x52, 0xcc, 0xcc, 0x33, 0x50, 0x42, 0x7f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0x90, 0x42, 0x40, 0x00, 0x1e,
+  0x6c, 0x41, 0x20, 0x42, 0x03, 0x2b, 0x7f, 0xec, 0xff, 0x1c, 0xfc, 0x02, 0xc8, 0x12, 0x29, 0x30, 0x10, 0x29, 0x28,
+  0x29, 0x7f, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xbc, 0xa3, 0x48, 0x11, 0x32, 0xd0, 0x00, 0x21, 0x46, 0xc4, 0x49,
+  0x5f, 0xec, 0xff, 0x1c, 0xf3, 0x07, 0x6e, 0xad, 0x89, 0x52, 0x39, 0x14, 0xd7, 0x57, 0x7f, 0xff, 0xff, 0xc0, 0x3f,
+  0xff, 0xff, 0x8a, 0x14, 0xce, 0x1c, 0x31, 0x96, 0x30, 0xe1, 0xc1, 0x84, 0xbd, 0x0f, 0xec, 0xff, 0x1c, 0x21, 0x41,
+  0x18, 0x49, 0x32, 0x60, 0x77, 0xea, 0x49, 0x2d, 0xbf, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xc4, 0x86, 0x46, 0xac,
+  0x00, 0x8c, 0x00, 0x00, 0x84, 0x00, 0x02, 0x9b, 0xec, 0xff, 0x1c, 0xc3, 0x21, 0x00, 0x52, 0x32, 0x44, 0x29, 0x14,
+  0x14, 0x10, 0x7f, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xd2, 0x05, 0x41, 0x00, 0x03, 0x80, 0x86, 0x40, 0x00, 0x01,
+  0x9c, 0x37, 0xed, 0xff, 0x1e, 0xfc, 0x60, 0x02, 0x00, 0x92, 0x20, 0x49, 0xd8, 0xea, 0x58, 0x01, 0x7f, 0xff, 0xff,
+  0x80, 0x1f, 0xff, 0xff, 0xf4, 0x99, 0x3c, 0x58, 0x06, 0x24, 0x01, 0x30, 0x00, 0x09, 0x78, 0x3b, 0xf1, 0xee, 0xff,
+  0x1e, 0xf5, 0xc4, 0x12, 0x00, 0x47, 0x5c, 0x08, 0x6b, 0xd4, 0x36, 0x34, 0x7f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff,
+  0xc1, 0x4a, 0xef, 0xd0, 0x01, 0x99, 0x88, 0x25, 0x48, 0x28, 0x61, 0xad, 0x00, 0xee, 0xff, 0x1f, 0xf8, 0x18, 0xc3,
+  0x09, 0x65, 0x93, 0x12, 0x4e, 0xeb, 0xc9, 0xcf, 0x7f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xf4, 0xcd, 0xc7, 0x64,
+  0x01, 0xd9, 0x80, 0x06, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x1f, 0xef, 0xff, 0x1f, 0xf8, 0x76, 0x80, 0x18, 0x58, 0xb1,
+  0x02, 0x6d, 0xb4, 0x1f, 0x29, 0x7f, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xca, 0xb0, 0x81, 0xa3, 0x00, 0x21, 0x81,
+  0x82, 0x00, 0x09, 0x8e, 0x46, 0x03, 0x17, 0xef, 0xff, 0x1f, 0xda, 0xf4, 0x0e, 0x00, 0xa1, 0x36, 0x00, 0x41, 0x63,
+  0xf9, 0x4b, 0x7f, 0xff, 0xff, 0x00, 0x1f, 0xff, 0xff, 0xc1, 0x71, 0xc1, 0x28, 0x06, 0x20, 0x00, 0x00, 0x20, 0xa6,
+  0x38, 0x45, 0xc0, 0x23, 0xf0, 0xff, 0x1a, 0xdf, 0xd4, 0xc9, 0x00, 0x01, 0x22, 0x69, 0x0c, 0x3a, 0xbd, 0x1e, 0x8d,
+  0x7f, 0xff, 0xff, 0x02, 0x0f, 0xff, 0xff, 0xf4, 0x82, 0x64, 0xc2, 0x04, 0x32, 0x01, 0x05, 0xfe, 0x00, 0x02, 0x84,
+  0x0d, 0x8f, 0xf0, 0xff, 0x0b, 0x80, 0x88, 0x11, 0x58, 0x40, 0x4c, 0x4d, 0x9e, 0x74, 0xdb, 0x6b, 0x44, 0xfe, 0xff,
+  0x12, 0x00, 0x0f, 0xff, 0xff, 0xc8, 0x01, 0xcd, 0x22, 0x00, 0x91, 0x00, 0x6c, 0x28, 0x00, 0x21, 0x80, 0x00, 0x2d,
+  0x7f, 0xf2, 0xff, 0x0c, 0xfe, 0xc0, 0x20, 0x82, 0x10, 0x40, 0x85, 0x20, 0x18, 0xd9, 0xa9, 0x9e, 0xad, 0xfe, 0xff,
+  0x12, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0xd8, 0xa6, 0x0d, 0x00, 0x09, 0xa1, 0xe0, 0x00, 0xb8, 0xc4, 0x07, 0x71, 0xb9,
+  0x2b, 0xf2, 0xff, 0x02, 0xfe, 0x20, 0x30, 0xfe, 0x00, 0x06, 0x08, 0xba, 0x42, 0x26, 0xd1, 0x2b, 0x50, 0xfe, 0xff,
+  0x12, 0x20, 0x0f, 0xff, 0xff, 0xcc, 0x2a, 0xac, 0xd2, 0x03, 0x84, 0x01, 0x10, 0x40, 0x51, 0x10, 0x84, 0xfd, 0x23,
+  0x3b, 0xf1, 0xff, 0x0b, 0x90, 0x20, 0x06, 0x00, 0x00, 0x0b, 0x64, 0x04, 0x6d, 0xe2, 0x85, 0x21, 0xfe, 0xff, 0x08,
+  0x00, 0x0f, 0xff, 0xff, 0xd0, 0x15, 0xfb, 0x70, 0x03, 0xfd, 0x00, 0x05, 0x02, 0x04, 0x18, 0x06, 0x35, 0xc7, 0xf2,
+  0xff, 0x02, 0xf2, 0x80, 0x20, 0xfe, 0x00, 0x06, 0x20, 0x60, 0x00, 0x32, 0x90, 0x8b, 0xd0, 0xfe, 0xff, 0x13, 0x00,
+  0x07, 0xff, 0xff, 0xc5, 0xcb, 0x4f, 0x28, 0x00, 0x58, 0x00, 0x50, 0x00, 0x42, 0x50, 0x00, 0x01, 0x84, 0x0d, 0x3f,
+  0xf3, 0xff, 0x0c, 0xfd, 0x34, 0x60, 0x04, 0x80, 0x01, 0xa2, 0x88, 0x4c, 0x4d, 0xe0, 0x85, 0x09, 0xfe, 0xff, 0x13,
+  0x00, 0x07, 0xff, 0xff, 0xda, 0x22, 0x8a, 0xf4, 0x01, 0x80, 0xa1, 0x00, 0x03, 0x64, 0xe0, 0x43, 0x21, 0x11, 0xaa,
+  0x5b, 0xf3, 0xff, 0x23, 0xf9, 0x12, 0x22, 0x1c, 0x03, 0x10, 0xa9, 0x00, 0x18, 0x34, 0x9b, 0x4a, 0xa6, 0xff, 0xff,
+  0xfe, 0x00, 0x07, 0xff, 0xff, 0xd2, 0x41, 0x6e, 0x5a, 0x00, 0x06, 0x10, 0x21, 0x02, 0xe3, 0x20, 0x01, 0x22, 0x97,
+  0xbf, 0xfb, 0xf3, 0xff, 0x22, 0x80, 0x04, 0x03, 0x00, 0x42, 0x00, 0x31, 0x24, 0xd2, 0x39, 0x65, 0xac, 0x5d, 0xff,
+  0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xc5, 0x06, 0xc1, 0xa6, 0x07, 0x30, 0x00, 0x30, 0x00, 0x18, 0x80, 0x00, 0x00,
+  0x1e, 0xcf, 0xf2, 0xff, 0x23, 0xc8, 0x33, 0x50, 0x20, 0x08, 0x00, 0x12, 0xc0, 0x22, 0x14, 0x8b, 0x5b, 0xc2, 0xff,
   0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xc8, 0x69, 0x62, 0x78, 0x02, 0x30, 0x00, 0x00, 0x09, 0x10, 0x00, 0x00, 0x30,
-  0x79, 0xff, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x1a, 0xc0,
-  0x26, 0x60, 0x80, 0x08, 0x00, 0x44, 0x24, 0x20, 0x35, 0x63, 0x61, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xc4,
-  0x98, 0xe4, 0x10, 0x00, 0x40, 0x00, 0x20, 0x00, 0x23, 0x00, 0x80, 0x2e, 0xb3, 0x7e, 0x53, 0x4f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x23, 0x80, 0xea, 0x00, 0x00, 0x01, 0x89, 0x21, 0x80,
+  0x79, 0xff, 0xcd, 0xf4, 0xff, 0x25, 0xfb, 0x1a, 0xc0, 0x26, 0x60, 0x80, 0x08, 0x00, 0x44, 0x24, 0x20, 0x35, 0x63,
+  0x61, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xc4, 0x98, 0xe4, 0x10, 0x00, 0x40, 0x00, 0x20, 0x00, 0x23, 0x00,
+  0x80, 0x2e, 0xb3, 0x7e, 0x53, 0x4f, 0xf5, 0xff, 0x25, 0xc6, 0x23, 0x80, 0xea, 0x00, 0x00, 0x01, 0x89, 0x21, 0x80,
   0x2c, 0x1a, 0xd7, 0x93, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0xc7, 0x4c, 0x11, 0x60, 0x00, 0x40, 0x00, 0x20,
-  0x04, 0x04, 0x0b, 0x56, 0x29, 0x1d, 0x85, 0x80, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe4, 0x00, 0x04, 0x60, 0x20, 0x00, 0x00, 0xd0, 0x30, 0x09, 0x3d, 0xa5, 0x69, 0xe9, 0xff, 0xff, 0xfe,
-  0x00, 0x03, 0xff, 0xff, 0xf4, 0xb3, 0x2d, 0xbc, 0x03, 0x00, 0x00, 0x60, 0x06, 0x44, 0x07, 0x11, 0xd1, 0x40, 0xe1,
-  0x20, 0x02, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x40, 0x08,
-  0x00, 0x10, 0x02, 0x71, 0x53, 0x22, 0xfa, 0x8d, 0x53, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x36, 0x4b,
-  0x08, 0x03, 0x00, 0x20, 0x00, 0x02, 0x30, 0x08, 0x06, 0x63, 0x09, 0x08, 0x00, 0x01, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x74, 0x02, 0x09, 0x69,
-  0x12, 0x2f, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xe5, 0x0c, 0x30, 0x30, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20,
-  0x00, 0x01, 0x04, 0xdc, 0x00, 0x00, 0x05, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x08, 0x80, 0x00, 0x26, 0xb4, 0xc0, 0xb3, 0xff, 0xff, 0xfe, 0x00, 0x03,
-  0xff, 0xff, 0xf7, 0x9a, 0xd9, 0x28, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x41, 0xe7, 0x29, 0x00, 0x80, 0x00, 0xc0,
-  0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x06, 0x20, 0x00, 0x00, 0xa0, 0x12, 0x01,
-  0x88, 0x50, 0x05, 0x9b, 0x0e, 0x33, 0x43, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xe8, 0x24, 0xba, 0x20, 0x02,
-  0xe8, 0x20, 0x00, 0x2c, 0x00, 0x43, 0x86, 0xc7, 0x00, 0x00, 0x15, 0xea, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xeb, 0x10, 0x00, 0x02, 0x00, 0x00, 0x22, 0x02, 0x21, 0x29, 0x18, 0x99, 0xa7, 0x66, 0xb3,
-  0xff, 0xff, 0xfe, 0x00, 0x83, 0xff, 0xff, 0xe6, 0xe7, 0x78, 0x80, 0x15, 0x81, 0x04, 0x00, 0x05, 0x00, 0x19, 0x04,
-  0x8b, 0x00, 0x00, 0xdd, 0xc6, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x00,
-  0x00, 0x11, 0x1c, 0x00, 0x00, 0x01, 0x22, 0x8a, 0x97, 0x44, 0x09, 0x43, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff,
-  0xe5, 0xb4, 0x08, 0xa8, 0x04, 0x98, 0x10, 0x20, 0x30, 0x03, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x08, 0x05, 0x5e, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x7c, 0x60, 0x00, 0x30, 0x04, 0xc8, 0x00, 0xa0, 0x90,
-  0x40, 0x0a, 0x74, 0x45, 0x2f, 0xff, 0xff, 0xfe, 0x80, 0x01, 0xff, 0xff, 0xe0, 0x0c, 0x36, 0xc0, 0x20, 0x89, 0x00,
-  0x00, 0x80, 0x00, 0x36, 0x30, 0x00, 0x40, 0x01, 0xe6, 0x09, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xd8, 0x3d, 0xad, 0xa8, 0x81, 0x10, 0xc1, 0x80, 0x02, 0x3c, 0xc0, 0x44, 0x1f, 0x4d, 0x82, 0x37, 0xff, 0xff,
-  0xfe, 0x00, 0x01, 0xff, 0xff, 0xf2, 0xbb, 0x08, 0xb0, 0x26, 0x48, 0x10, 0x00, 0xa0, 0x00, 0x30, 0x20, 0x00, 0x00,
-  0x02, 0x23, 0x80, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x23, 0x20, 0x2d, 0xf3, 0x00,
-  0x60, 0x40, 0x13, 0x2d, 0xc4, 0x84, 0x1e, 0x8e, 0xa6, 0xef, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xf1, 0x24,
-  0x12, 0x51, 0x37, 0x65, 0x58, 0x00, 0x00, 0x02, 0x40, 0x40, 0x06, 0x00, 0xc3, 0x20, 0x00, 0x82, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0x01, 0x00, 0x8a, 0x01, 0xc2, 0x60, 0x20, 0x04, 0x04, 0x8a, 0xe8, 0x10,
-  0x68, 0x5a, 0x97, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xf8, 0x40, 0x6d, 0x23, 0xc6, 0x71, 0x20, 0x04, 0x10,
-  0x04, 0x05, 0x00, 0x1e, 0x01, 0xa3, 0xc4, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60,
-  0x02, 0x04, 0x0c, 0xe9, 0x84, 0x4c, 0x40, 0x04, 0x16, 0x91, 0x6c, 0x82, 0x01, 0x29, 0x57, 0xff, 0xff, 0xfe, 0x00,
-  0x01, 0xff, 0xff, 0xe6, 0xb6, 0x41, 0x21, 0xc9, 0x9a, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x38, 0x00, 0x72, 0x40,
-  0x00, 0x00, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x14, 0x40, 0x88, 0x01, 0x40, 0x40,
-  0x00, 0x44, 0x15, 0x80, 0x0c, 0x16, 0xf4, 0x97, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff, 0xe3, 0x61, 0xa4, 0xa0,
-  0xdd, 0x98, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x28, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x80, 0x00, 0x48, 0xb1, 0x00, 0x00, 0x12, 0xaf, 0xa2, 0x49, 0x07, 0x0b, 0x69,
+  0x04, 0x04, 0x0b, 0x56, 0x29, 0x1d, 0x85, 0x80, 0x28, 0xf5, 0xff, 0x26, 0xe4, 0x00, 0x04, 0x60, 0x20, 0x00, 0x00,
+  0xd0, 0x30, 0x09, 0x3d, 0xa5, 0x69, 0xe9, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xf4, 0xb3, 0x2d, 0xbc, 0x03,
+  0x00, 0x00, 0x60, 0x06, 0x44, 0x07, 0x11, 0xd1, 0x40, 0xe1, 0x20, 0x02, 0x7f, 0xf6, 0xff, 0xfe, 0x00, 0x23, 0x40,
+  0x08, 0x00, 0x10, 0x02, 0x71, 0x53, 0x22, 0xfa, 0x8d, 0x53, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x36,
+  0x4b, 0x08, 0x03, 0x00, 0x20, 0x00, 0x02, 0x30, 0x08, 0x06, 0x63, 0x09, 0x08, 0x00, 0x01, 0x1f, 0xf7, 0xff, 0x01,
+  0xfe, 0xa0, 0xfb, 0x00, 0x13, 0x05, 0x74, 0x02, 0x09, 0x69, 0x12, 0x2f, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff,
+  0xe5, 0x0c, 0x30, 0x30, 0x00, 0x10, 0xfe, 0x00, 0x08, 0x20, 0x00, 0x01, 0x04, 0xdc, 0x00, 0x00, 0x05, 0x1f, 0xf7,
+  0xff, 0x01, 0xf5, 0x04, 0xfe, 0x00, 0x16, 0x80, 0x02, 0x00, 0x08, 0x80, 0x00, 0x26, 0xb4, 0xc0, 0xb3, 0xff, 0xff,
+  0xfe, 0x00, 0x03, 0xff, 0xff, 0xf7, 0x9a, 0xd9, 0x28, 0x00, 0x9c, 0xfd, 0x00, 0x07, 0x41, 0xe7, 0x29, 0x00, 0x80,
+  0x00, 0xc0, 0xeb, 0xf7, 0xff, 0x27, 0xfb, 0x06, 0x20, 0x00, 0x00, 0xa0, 0x12, 0x01, 0x88, 0x50, 0x05, 0x9b, 0x0e,
+  0x33, 0x43, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xe8, 0x24, 0xba, 0x20, 0x02, 0xe8, 0x20, 0x00, 0x2c, 0x00,
+  0x43, 0x86, 0xc7, 0x00, 0x00, 0x15, 0xea, 0x13, 0xf7, 0xff, 0x27, 0xeb, 0x10, 0x00, 0x02, 0x00, 0x00, 0x22, 0x02,
+  0x21, 0x29, 0x18, 0x99, 0xa7, 0x66, 0xb3, 0xff, 0xff, 0xfe, 0x00, 0x83, 0xff, 0xff, 0xe6, 0xe7, 0x78, 0x80, 0x15,
+  0x81, 0x04, 0x00, 0x05, 0x00, 0x19, 0x04, 0x8b, 0x00, 0x00, 0xdd, 0xc6, 0x16, 0xf6, 0xff, 0x1f, 0xa9, 0x00, 0x00,
+  0x11, 0x1c, 0x00, 0x00, 0x01, 0x22, 0x8a, 0x97, 0x44, 0x09, 0x43, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xe5,
+  0xb4, 0x08, 0xa8, 0x04, 0x98, 0x10, 0x20, 0x30, 0x03, 0x0c, 0xfe, 0x00, 0x03, 0x01, 0x08, 0x05, 0x5e, 0xf7, 0xff,
+  0x27, 0xa2, 0x7c, 0x60, 0x00, 0x30, 0x04, 0xc8, 0x00, 0xa0, 0x90, 0x40, 0x0a, 0x74, 0x45, 0x2f, 0xff, 0xff, 0xfe,
+  0x80, 0x01, 0xff, 0xff, 0xe0, 0x0c, 0x36, 0xc0, 0x20, 0x89, 0x00, 0x00, 0x80, 0x00, 0x36, 0x30, 0x00, 0x40, 0x01,
+  0xe6, 0x09, 0xb3, 0xf8, 0xff, 0x28, 0xd8, 0x3d, 0xad, 0xa8, 0x81, 0x10, 0xc1, 0x80, 0x02, 0x3c, 0xc0, 0x44, 0x1f,
+  0x4d, 0x82, 0x37, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xf2, 0xbb, 0x08, 0xb0, 0x26, 0x48, 0x10, 0x00, 0xa0,
+  0x00, 0x30, 0x20, 0x00, 0x00, 0x02, 0x23, 0x80, 0x83, 0xf8, 0xff, 0x29, 0x99, 0x23, 0x20, 0x2d, 0xf3, 0x00, 0x60,
+  0x40, 0x13, 0x2d, 0xc4, 0x84, 0x1e, 0x8e, 0xa6, 0xef, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xf1, 0x24, 0x12,
+  0x51, 0x37, 0x65, 0x58, 0x00, 0x00, 0x02, 0x40, 0x40, 0x06, 0x00, 0xc3, 0x20, 0x00, 0x82, 0x7f, 0xf9, 0xff, 0x29,
+  0x83, 0x01, 0x00, 0x8a, 0x01, 0xc2, 0x60, 0x20, 0x04, 0x04, 0x8a, 0xe8, 0x10, 0x68, 0x5a, 0x97, 0xff, 0xff, 0xfe,
+  0x00, 0x01, 0xff, 0xff, 0xf8, 0x40, 0x6d, 0x23, 0xc6, 0x71, 0x20, 0x04, 0x10, 0x04, 0x05, 0x00, 0x1e, 0x01, 0xa3,
+  0xc4, 0x00, 0x00, 0x9f, 0xf9, 0xff, 0x1c, 0x60, 0x02, 0x04, 0x0c, 0xe9, 0x84, 0x4c, 0x40, 0x04, 0x16, 0x91, 0x6c,
+  0x82, 0x01, 0x29, 0x57, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xe6, 0xb6, 0x41, 0x21, 0xc9, 0x9a, 0xfe, 0x00,
+  0x09, 0x28, 0x02, 0x00, 0x38, 0x00, 0x72, 0x40, 0x00, 0x00, 0x47, 0xfa, 0xff, 0x10, 0xf5, 0x00, 0x00, 0x14, 0x40,
+  0x88, 0x01, 0x40, 0x40, 0x00, 0x44, 0x15, 0x80, 0x0c, 0x16, 0xf4, 0x97, 0xfe, 0xff, 0x09, 0x00, 0x01, 0xff, 0xff,
+  0xe3, 0x61, 0xa4, 0xa0, 0xdd, 0x98, 0xfe, 0x00, 0x05, 0x44, 0x00, 0x00, 0x28, 0x00, 0x06, 0xfe, 0x00, 0x00, 0x01,
+  0xfa, 0xff, 0x2a, 0xf3, 0x00, 0x00, 0x80, 0x00, 0x48, 0xb1, 0x00, 0x00, 0x12, 0xaf, 0xa2, 0x49, 0x07, 0x0b, 0x69,
   0x4f, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xff, 0xf4, 0x80, 0x43, 0x4c, 0xe6, 0x40, 0x08, 0x00, 0x00, 0x08, 0x10,
-  0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x01, 0x09, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x10, 0x00, 0x00,
-  0x00, 0x6c, 0x88, 0x00, 0x00, 0x32, 0x84, 0x44, 0x40, 0x08, 0x24, 0xa5, 0x2f, 0xff, 0xff, 0xfe, 0x02, 0x01, 0xff,
-  0xff, 0xe0, 0x27, 0xd5, 0x40, 0xee, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x88, 0x00, 0x88, 0x52,
-  0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc2, 0x60, 0x10, 0x00, 0x30, 0x06, 0x80, 0x00, 0x00, 0x01, 0x5c,
-  0x48, 0x74, 0x87, 0x4d, 0x5b, 0x4f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf8, 0x88, 0xa4, 0x01, 0x01, 0x12,
-  0x00, 0x00, 0x00, 0xc2, 0x00, 0x03, 0x80, 0x12, 0x00, 0x02, 0x30, 0xa1, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x08, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x04, 0x1a, 0xcd, 0x20, 0xa5, 0x3f, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf4, 0xd2, 0x42, 0x94, 0x11, 0x73, 0x04, 0x00, 0x04, 0x80, 0x00, 0x03, 0x00,
-  0xc8, 0x00, 0x4d, 0x83, 0x02, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x04, 0xe0, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0e, 0x20, 0x84, 0x88, 0x07, 0x56, 0x5b, 0x9f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf8,
-  0xa5, 0xb3, 0x18, 0x00, 0x88, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x05, 0x21, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x7e, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x74, 0x41, 0x09,
-  0xc9, 0x25, 0x3d, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf8, 0x4e, 0x6d, 0x0e, 0x0c, 0xd5, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf,
-  0xda, 0xfe, 0xe6, 0x32, 0x20, 0x00, 0x00, 0x00, 0x02, 0x53, 0x6c, 0x00, 0x02, 0x56, 0xd6, 0x9f, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0xff, 0xff, 0xf0, 0xd6, 0x4e, 0x03, 0x33, 0x04, 0x06, 0x00, 0x84, 0x00, 0x00, 0x03, 0x02, 0x00, 0x12,
-  0x20, 0x66, 0x51, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x01, 0xca, 0xfc, 0x7a, 0x73, 0x03, 0x80, 0x00,
-  0x00, 0x02, 0x5b, 0x24, 0xca, 0x05, 0x27, 0x29, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x42, 0x20,
-  0x02, 0x03, 0x26, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd0, 0x00, 0x25, 0x4a, 0xa8, 0x6b, 0x24, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf1, 0x80, 0x00, 0x1d, 0x81, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x31, 0xcc, 0x40, 0x44, 0x41, 0x90,
-  0xa4, 0x9f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfb, 0x44, 0xc3, 0x04, 0x11, 0x8c, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0x34, 0x00, 0x0a, 0xd5, 0x40, 0x84, 0x49, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x46, 0x01,
-  0xe4, 0x9d, 0x90, 0x00, 0x00, 0x00, 0x63, 0x84, 0x08, 0x24, 0x46, 0x08, 0x59, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0xff, 0xff, 0xf6, 0xbe, 0x56, 0x10, 0x10, 0x99, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xd4, 0xeb, 0xc4,
-  0x22, 0x40, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x10, 0x82, 0x32, 0x01, 0xd8, 0x00, 0x00, 0x01, 0xfa,
-  0x5a, 0x08, 0x82, 0x01, 0xa4, 0xbc, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf9, 0x7d, 0x04, 0x00, 0xef,
-  0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb1, 0x40, 0x8c, 0xf2, 0xa0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xa0, 0x00, 0x00, 0x10, 0x40, 0x20, 0x08, 0x01, 0x00, 0x02, 0x8c, 0x02, 0x36, 0x49, 0xa6, 0x5a, 0x52, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x40, 0xff, 0xff, 0xfa, 0xda, 0x1a, 0x04, 0x4e, 0x64, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x40, 0x0f, 0x64, 0x94, 0x00, 0xe6, 0x48, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x10, 0x03, 0x04,
-  0x88, 0x80, 0x00, 0x06, 0x14, 0x66, 0xd3, 0x25, 0x43, 0xad, 0x2d, 0xbf, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
-  0xf6, 0xb6, 0xbe, 0x08, 0xa2, 0x14, 0x42, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x2c, 0xb7, 0x24, 0x55, 0x08, 0x44,
-  0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xe0, 0x00, 0x00, 0x50, 0x10, 0x00, 0x00, 0x00, 0x0e, 0x48, 0xc6, 0x6e,
-  0x22, 0x06, 0xda, 0x56, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xf9, 0x3d, 0x28, 0x1a, 0xb0, 0xba, 0x80,
-  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x09, 0x13, 0xa8, 0x40, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x86,
-  0x98, 0x00, 0x01, 0x08, 0x30, 0x0c, 0x00, 0x00, 0x3c, 0x03, 0xc1, 0x62, 0x42, 0x67, 0x25, 0x2d, 0x7f, 0xff, 0xff,
-  0xff, 0x01, 0x00, 0xff, 0xff, 0xfa, 0xdf, 0x18, 0x14, 0x84, 0x04, 0x80, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xd8,
-  0x00, 0x06, 0x10, 0x25, 0x40, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x8a, 0x20, 0x80, 0x00, 0x01, 0xa0, 0x04, 0x00,
-  0x00, 0x78, 0x47, 0x51, 0x18, 0x44, 0x20, 0x93, 0x94, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xfd, 0xb0,
-  0x18, 0x0c, 0xcc, 0x44, 0x80, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x01, 0x9c, 0x0b, 0xf8, 0xa1, 0x43, 0x00, 0x5f, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x08, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x96, 0x22, 0x3b, 0xbe, 0x41,
-  0xc3, 0x49, 0x3f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xfc, 0x39, 0x28, 0x0c, 0xd5, 0x00, 0x00, 0x5f, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x4c, 0x16, 0xb4, 0xa1, 0x46, 0x82, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x80, 0xb2,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x56, 0x32, 0x51, 0xb0, 0xeb, 0x90, 0x94, 0xbf, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x7f, 0xff, 0xf8, 0xb3, 0x50, 0x13, 0x37, 0x62, 0x40, 0x7f, 0xff, 0xe0, 0x80, 0x00, 0x29, 0xac, 0x16, 0x40,
-  0x40, 0x51, 0x08, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfb,
-  0xbc, 0x59, 0x37, 0x70, 0x00, 0xdb, 0x58, 0xff, 0xff, 0xff, 0xff, 0x00, 0x40, 0x7f, 0xff, 0xfd, 0xb5, 0x30, 0x13,
-  0x05, 0x56, 0x01, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x28, 0x00, 0x04, 0x00, 0x00, 0x80, 0x0c, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf2, 0xab, 0x48, 0x82, 0x31, 0x03, 0x21, 0x04,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xff, 0xf9, 0x49, 0xc0, 0x08, 0x00, 0x88, 0x91, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x82, 0x00, 0x40, 0x00, 0x01, 0x02, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0xff, 0xf3, 0x4b, 0x18, 0xc0, 0x64, 0x00, 0xd3, 0x50, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x7f,
-  0xff, 0xfc, 0xb4, 0xf0, 0x19, 0x8f, 0x81, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x01, 0xa0, 0x0a,
-  0x08, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf1, 0xd7, 0x09,
-  0x10, 0x58, 0x43, 0x4b, 0x4c, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0x7f, 0xff, 0xf9, 0x6c, 0xb0, 0x3a, 0x43, 0x20,
-  0x40, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd2, 0x08, 0xc0, 0x40, 0x88, 0x04, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x21, 0xc8, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfa, 0x81, 0xed, 0x98, 0x45, 0x81, 0xb6, 0xb7, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xf8, 0xe2, 0x50, 0x04, 0xcc, 0x64, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f,
-  0x39, 0x4b, 0x42, 0x10, 0x04, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x82, 0x41, 0x3b, 0x80, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xf3, 0x4d, 0xee, 0x8b, 0xb0, 0x93, 0xca, 0x4a, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xfc,
-  0xd3, 0x80, 0xc4, 0x1d, 0x80, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x38, 0x96, 0x09, 0x10, 0x96, 0x6a, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x82, 0xa5, 0x80, 0x5a, 0x40, 0x00, 0x01, 0xff, 0xff, 0xec, 0x75, 0xdf, 0xc0, 0x03,
-  0x02, 0xa1, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xf9, 0x3b, 0xe0, 0x09, 0x18, 0x10, 0x43, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x65, 0x96, 0x04, 0x00, 0x25, 0x50, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x41, 0xe7,
-  0x0e, 0x20, 0x20, 0x00, 0x0f, 0xff, 0xff, 0xf6, 0xa9, 0x09, 0x84, 0x40, 0x21, 0x92, 0x5a, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x3f, 0xff, 0xff, 0xdb, 0xc3, 0x32, 0x03, 0x80, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x08,
-  0x00, 0x0e, 0x60, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x08, 0x09, 0x2d, 0x50, 0x00, 0x0f, 0xff, 0xff,
-  0xe3, 0x82, 0x74, 0x88, 0x4c, 0x81, 0x45, 0x6c, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xf9, 0x86, 0xc0,
-  0x04, 0x8a, 0x6c, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x88, 0x0c, 0x08, 0x10, 0x5c, 0xe0, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x58, 0x04, 0x01, 0x69, 0xe6, 0x00, 0x1f, 0xff, 0xff, 0xe3, 0x44, 0x86, 0x49, 0x00, 0xc1, 0x90,
-  0xd9, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xf9, 0x59, 0x01, 0x80, 0xb9, 0x80, 0x1f, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0xa0, 0x00, 0x40, 0x50, 0xbc, 0x20, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x46,
-  0x91, 0x80, 0x1f, 0xff, 0xff, 0xfa, 0x8b, 0x8f, 0x25, 0x18, 0x40, 0x68, 0x2b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x3f, 0xff, 0xfa, 0x12, 0x80, 0x01, 0x33, 0xba, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x40, 0x20, 0x00, 0x15, 0x28,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x08, 0x70, 0xb0, 0x44, 0x90, 0x3f, 0xff, 0xff, 0x94, 0x90,
-  0xac, 0xa0, 0x08, 0x20, 0xa0, 0xcb, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xfd, 0x86, 0x80, 0x22, 0x03,
-  0x18, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x00, 0xd0, 0x00, 0x00, 0x79, 0x20, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x08, 0x40, 0x49, 0x07, 0x0c, 0x3f, 0xff, 0xff, 0x87, 0x00, 0x04, 0x44, 0x24, 0xe1, 0xb8, 0x93, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xfe, 0x61, 0x00, 0x04, 0x1c, 0xcd, 0x03, 0xff, 0xff, 0xff, 0xfe, 0x08,
-  0x23, 0x00, 0x63, 0x02, 0x10, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x0e, 0x01, 0x4a, 0x4b, 0x42,
-  0x09, 0xff, 0xff, 0xfa, 0x89, 0x91, 0x04, 0x06, 0x48, 0x49, 0x2d, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff,
-  0xfc, 0x93, 0x01, 0x91, 0x11, 0x10, 0x13, 0xff, 0xff, 0xff, 0xf8, 0x80, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x30, 0xa6, 0x12, 0x0a, 0x00, 0x03, 0xff, 0xff, 0x9e, 0x86, 0x98, 0xa4,
-  0x0c, 0x68, 0xb0, 0xb7, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xfe, 0x24, 0x00, 0x00, 0x61, 0x10, 0x03,
-  0xff, 0xff, 0xff, 0xfb, 0xfe, 0xcb, 0xa1, 0xde, 0x90, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30,
-  0x10, 0x22, 0xa0, 0x00, 0x11, 0x00, 0xff, 0xff, 0x25, 0x43, 0x00, 0x89, 0x6c, 0x20, 0x98, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x00, 0x3f, 0xff, 0xfc, 0x45, 0x04, 0x46, 0x77, 0x74, 0x03, 0xff, 0xff, 0xff, 0xff, 0x56, 0xc0, 0x24,
-  0xc6, 0x10, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0b, 0x03, 0x40, 0x90, 0x20, 0x00, 0x80, 0x7f,
-  0xff, 0xaa, 0xe1, 0x03, 0x49, 0x10, 0x10, 0xc5, 0x87, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xfc, 0x8c,
-  0x02, 0x04, 0x22, 0x11, 0x23, 0xff, 0xff, 0xff, 0xfc, 0x06, 0x00, 0x28, 0x20, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x81, 0x02, 0x20, 0x00, 0x52, 0x00, 0x40, 0x3f, 0xff, 0x21, 0x40, 0x11, 0x22, 0x20, 0x00,
-  0xf2, 0x87, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xfe, 0x12, 0x00, 0xb8, 0x80, 0x1d, 0x85, 0xff, 0xff,
-  0xf4, 0x2e, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x60, 0xa1,
-  0x76, 0xd1, 0x80, 0x08, 0x3f, 0xff, 0x95, 0x10, 0x00, 0x80, 0x43, 0x00, 0x4a, 0x27, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x00, 0x1f, 0xff, 0xff, 0xc8, 0x01, 0xdb, 0x10, 0x00, 0x03, 0xff, 0xff, 0xf1, 0x4a, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0e, 0x0c, 0xd4, 0x20, 0x05, 0x4c, 0x1f, 0xff, 0x1f,
-  0xa2, 0x24, 0x40, 0x01, 0xa0, 0x80, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x20, 0x1f, 0xff, 0xff, 0x3c, 0x41, 0xf6,
-  0x62, 0x64, 0x0d, 0xff, 0xff, 0xb5, 0x58, 0x00, 0x01, 0x00, 0x00, 0x02, 0x44, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x01, 0x6b, 0x41, 0x42, 0x61, 0x04, 0x1f, 0xfe, 0x06, 0x4a, 0x24, 0x40, 0x20, 0x80, 0x30, 0x53,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xfc, 0x58, 0x04, 0x0e, 0xee, 0x42, 0x19, 0xff, 0xff, 0xe9, 0x64,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x06, 0x30, 0x0b, 0x94,
-  0x10, 0x68, 0x81, 0xa6, 0x50, 0x49, 0x08, 0x08, 0x02, 0x10, 0x45, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f,
-  0xff, 0xfd, 0x00, 0x00, 0x40, 0x80, 0x10, 0xc3, 0xff, 0xff, 0x6f, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0x00, 0xc9, 0x03, 0x64, 0x00, 0x03, 0x40, 0x80, 0x08,
-  0x89, 0x81, 0x20, 0x22, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xfe, 0x38, 0x00, 0xf1, 0x00, 0x04,
-  0x87, 0xff, 0xfd, 0x16, 0xe8, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x04, 0x05, 0xe0, 0x80, 0x60, 0x00, 0x02, 0x0b, 0x33, 0x12, 0x09, 0x21, 0x24, 0x49, 0x27, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xfe, 0x18, 0x0c, 0x3a, 0x2c, 0x40, 0x21, 0xff, 0xfa, 0x04, 0x4c, 0x78, 0x09,
-  0x00, 0x00, 0x24, 0x06, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x08, 0x80, 0x80, 0x20,
-  0x00, 0x30, 0x21, 0x11, 0x10, 0x2c, 0xa0, 0x90, 0x20, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xfe,
-  0xb0, 0x00, 0x2c, 0xc4, 0x53, 0x01, 0xff, 0xf6, 0xa4, 0x0c, 0x11, 0x01, 0x14, 0x63, 0x20, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xbc, 0xa0, 0x10, 0x60, 0x04,
-  0xc8, 0x0a, 0x17, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xfe, 0x68, 0x03, 0x21, 0x9b, 0xb0, 0x89, 0xff,
-  0xfd, 0xa0, 0x6c, 0xc1, 0x59, 0x00, 0x06, 0x00, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x80, 0x02, 0x26, 0x80, 0x05, 0x81, 0x1c, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x10, 0x1f, 0xff, 0xff, 0x30, 0x21, 0x01, 0x22, 0x00, 0x03, 0xff, 0xf3, 0x69, 0xd5, 0xdb, 0xa4, 0x40, 0x00,
-  0x40, 0x03, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08,
-  0xb8, 0x10, 0x54, 0x40, 0x01, 0x81, 0x28, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0x60, 0x11,
-  0x11, 0x1c, 0x42, 0x01, 0xff, 0xa0, 0xdc, 0x41, 0x9a, 0x40, 0x80, 0x04, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x21, 0x80, 0x00, 0x00, 0x00, 0x02, 0x64, 0xca, 0xa2, 0x50, 0x99, 0xc0, 0xb1, 0x02, 0x15,
-  0xef, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0x20, 0x11, 0x0e, 0xe8, 0x20, 0x01, 0xff, 0xa6, 0x09,
-  0xa3, 0x02, 0x40, 0x20, 0x04, 0x00, 0x41, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xa0, 0x00,
-  0xa2, 0x00, 0x38, 0x64, 0x0a, 0x21, 0x34, 0xb9, 0x17, 0x92, 0x02, 0x28, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x0f, 0xff, 0xff, 0x50, 0x13, 0x06, 0x49, 0x12, 0x01, 0xfe, 0x0b, 0x28, 0x11, 0x37, 0x47, 0x20, 0x01, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0xed, 0xc0, 0x01, 0xc0, 0x18, 0x26, 0x40, 0x09, 0x33,
-  0x54, 0x06, 0x00, 0x04, 0x12, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0x60, 0x67, 0x70, 0x8b,
-  0x30, 0x03, 0xfe, 0x00, 0x0c, 0x92, 0x02, 0x87, 0x20, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xec, 0x48, 0x21, 0x40, 0x00, 0x09, 0x17, 0x44, 0x01, 0x50, 0x02, 0xe8, 0x01, 0x80, 0x0c, 0x4f, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0x40, 0x3b, 0x88, 0x3f, 0x80, 0x15, 0xfc, 0x01, 0x1d, 0xd0, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x34, 0x83, 0x8c, 0x00,
-  0x88, 0x82, 0x4a, 0x80, 0x28, 0xf8, 0x64, 0x1c, 0x90, 0x1a, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff,
-  0xff, 0x00, 0xbb, 0x08, 0x00, 0x01, 0x03, 0xfc, 0x00, 0x33, 0x98, 0x0d, 0x10, 0x00, 0x00, 0x04, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1c, 0x58, 0x06, 0x04, 0x20, 0xba, 0xfa, 0xe5, 0x80, 0x4c, 0x01,
-  0x98, 0x83, 0x0d, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x84, 0x44, 0x00, 0x2b, 0x8d,
-  0xfc, 0x02, 0x1b, 0xf0, 0x44, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x9f, 0x08, 0x0e, 0x06, 0xc0, 0x30, 0x6e, 0x0d, 0x99, 0xb4, 0x00, 0x59, 0x44, 0x12, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xa0, 0x26, 0xe0, 0xc5, 0xb0, 0x47, 0xf6, 0x00, 0x41, 0x74, 0x60, 0x20, 0x40,
-  0x06, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x01, 0x09, 0xfa, 0xff, 0x01, 0xc0, 0x10, 0xfe, 0x00, 0x18, 0x6c, 0x88, 0x00,
+  0x00, 0x32, 0x84, 0x44, 0x40, 0x08, 0x24, 0xa5, 0x2f, 0xff, 0xff, 0xfe, 0x02, 0x01, 0xff, 0xff, 0xe0, 0x27, 0xd5,
+  0x40, 0xee, 0xe0, 0xfc, 0x00, 0x07, 0x01, 0xe0, 0x00, 0x88, 0x00, 0x88, 0x52, 0x20, 0xfb, 0xff, 0x11, 0xfe, 0xc2,
+  0x60, 0x10, 0x00, 0x30, 0x06, 0x80, 0x00, 0x00, 0x01, 0x5c, 0x48, 0x74, 0x87, 0x4d, 0x5b, 0x4f, 0xfe, 0xff, 0xff,
+  0x00, 0xff, 0xff, 0x05, 0xf8, 0x88, 0xa4, 0x01, 0x01, 0x12, 0xfe, 0x00, 0x09, 0xc2, 0x00, 0x03, 0x80, 0x12, 0x00,
+  0x02, 0x30, 0xa1, 0x49, 0xfa, 0xff, 0x03, 0xc0, 0x08, 0x18, 0x0c, 0xfb, 0x00, 0x06, 0x18, 0x04, 0x1a, 0xcd, 0x20,
+  0xa5, 0x3f, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0x12, 0xf4, 0xd2, 0x42, 0x94, 0x11, 0x73, 0x04, 0x00, 0x04, 0x80,
+  0x00, 0x03, 0x00, 0xc8, 0x00, 0x4d, 0x83, 0x02, 0x20, 0xfb, 0xff, 0x04, 0xfe, 0xc0, 0x04, 0xe0, 0x08, 0xfc, 0x00,
+  0x07, 0x0e, 0x20, 0x84, 0x88, 0x07, 0x56, 0x5b, 0x9f, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0x12, 0xf8, 0xa5, 0xb3,
+  0x18, 0x00, 0x88, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x05, 0x21, 0x00, 0xfa, 0xff, 0x02,
+  0xec, 0x7e, 0xc3, 0xfb, 0x00, 0x07, 0x04, 0x74, 0x41, 0x09, 0xc9, 0x25, 0x3d, 0x7f, 0xfe, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x05, 0xf8, 0x4e, 0x6d, 0x0e, 0x0c, 0xd5, 0xf9, 0x00, 0x04, 0x02, 0x00, 0x20, 0x02, 0x00, 0xfa, 0xff, 0x05,
+  0xaf, 0xda, 0xfe, 0xe6, 0x32, 0x20, 0xfe, 0x00, 0x07, 0x02, 0x53, 0x6c, 0x00, 0x02, 0x56, 0xd6, 0x9f, 0xfe, 0xff,
+  0xff, 0x00, 0xff, 0xff, 0x12, 0xf0, 0xd6, 0x4e, 0x03, 0x33, 0x04, 0x06, 0x00, 0x84, 0x00, 0x00, 0x03, 0x02, 0x00,
+  0x12, 0x20, 0x66, 0x51, 0x89, 0xfb, 0xff, 0x11, 0xf2, 0x01, 0xca, 0xfc, 0x7a, 0x73, 0x03, 0x80, 0x00, 0x00, 0x02,
+  0x5b, 0x24, 0xca, 0x05, 0x27, 0x29, 0x7f, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0x06, 0xfb, 0x42, 0x20, 0x02, 0x03,
+  0x26, 0x80, 0xfd, 0x00, 0x07, 0x02, 0xd0, 0x00, 0x25, 0x4a, 0xa8, 0x6b, 0x24, 0xfb, 0xff, 0x05, 0xf1, 0x80, 0x00,
+  0x1d, 0x81, 0x7d, 0xfd, 0x00, 0x07, 0x31, 0xcc, 0x40, 0x44, 0x41, 0x90, 0xa4, 0x9f, 0xfe, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x05, 0xfb, 0x44, 0xc3, 0x04, 0x11, 0x8c, 0xfc, 0x00, 0x07, 0x03, 0x34, 0x00, 0x0a, 0xd5, 0x40, 0x84, 0x49,
+  0xfb, 0xff, 0x06, 0xc0, 0x00, 0x46, 0x01, 0xe4, 0x9d, 0x90, 0xfe, 0x00, 0x07, 0x63, 0x84, 0x08, 0x24, 0x46, 0x08,
+  0x59, 0x7f, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0x06, 0xf6, 0xbe, 0x56, 0x10, 0x10, 0x99, 0x80, 0xfd, 0x00, 0x08,
+  0x04, 0x00, 0x00, 0xd4, 0xeb, 0xc4, 0x22, 0x40, 0x3f, 0xfc, 0xff, 0x11, 0x90, 0x00, 0x10, 0x82, 0x32, 0x01, 0xd8,
+  0x00, 0x00, 0x01, 0xfa, 0x5a, 0x08, 0x82, 0x01, 0xa4, 0xbc, 0x3f, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0x06, 0xf9,
+  0x7d, 0x04, 0x00, 0xef, 0x20, 0x80, 0xfb, 0x00, 0x06, 0x03, 0xb1, 0x40, 0x8c, 0xf2, 0xa0, 0x1f, 0xfc, 0xff, 0x10,
+  0xa0, 0x00, 0x00, 0x10, 0x40, 0x20, 0x08, 0x01, 0x00, 0x02, 0x8c, 0x02, 0x36, 0x49, 0xa6, 0x5a, 0x52, 0xfd, 0xff,
+  0x0a, 0x00, 0x40, 0xff, 0xff, 0xfa, 0xda, 0x1a, 0x04, 0x4e, 0x64, 0x02, 0xfc, 0x00, 0x07, 0x40, 0x0f, 0x64, 0x94,
+  0x00, 0xe6, 0x48, 0x5f, 0xfc, 0xff, 0x11, 0x01, 0x00, 0x00, 0x10, 0x03, 0x04, 0x88, 0x80, 0x00, 0x06, 0x14, 0x66,
+  0xd3, 0x25, 0x43, 0xad, 0x2d, 0xbf, 0xfe, 0xff, 0xff, 0x00, 0xff, 0xff, 0x06, 0xf6, 0xb6, 0xbe, 0x08, 0xa2, 0x14,
+  0x42, 0xfd, 0x00, 0x08, 0x40, 0x00, 0x2c, 0xb7, 0x24, 0x55, 0x08, 0x44, 0x5f, 0xfc, 0xff, 0x05, 0x13, 0xe0, 0x00,
+  0x00, 0x50, 0x10, 0xfe, 0x00, 0x08, 0x0e, 0x48, 0xc6, 0x6e, 0x22, 0x06, 0xda, 0x56, 0x7f, 0xfe, 0xff, 0xff, 0x00,
+  0xff, 0xff, 0x07, 0xf9, 0x3d, 0x28, 0x1a, 0xb0, 0xba, 0x80, 0x07, 0xfc, 0x00, 0x06, 0xa5, 0x09, 0x13, 0xa8, 0x40,
+  0x00, 0x1f, 0xfd, 0xff, 0x12, 0xfe, 0x86, 0x98, 0x00, 0x01, 0x08, 0x30, 0x0c, 0x00, 0x00, 0x3c, 0x03, 0xc1, 0x62,
+  0x42, 0x67, 0x25, 0x2d, 0x7f, 0xfe, 0xff, 0x0c, 0x01, 0x00, 0xff, 0xff, 0xfa, 0xdf, 0x18, 0x14, 0x84, 0x04, 0x80,
+  0x0f, 0xc0, 0xfd, 0x00, 0x06, 0xd8, 0x00, 0x06, 0x10, 0x25, 0x40, 0x1f, 0xfd, 0xff, 0x11, 0xf8, 0x8a, 0x20, 0x80,
+  0x00, 0x01, 0xa0, 0x04, 0x00, 0x00, 0x78, 0x47, 0x51, 0x18, 0x44, 0x20, 0x93, 0x94, 0xfd, 0xff, 0xff, 0x00, 0xff,
+  0xff, 0x08, 0xfd, 0xb0, 0x18, 0x0c, 0xcc, 0x44, 0x80, 0x1f, 0xf8, 0xfe, 0x00, 0x07, 0x01, 0x9c, 0x0b, 0xf8, 0xa1,
+  0x43, 0x00, 0x5f, 0xfd, 0xff, 0x02, 0xfc, 0x08, 0x92, 0xfb, 0x00, 0x09, 0x01, 0xfe, 0x96, 0x22, 0x3b, 0xbe, 0x41,
+  0xc3, 0x49, 0x3f, 0xfe, 0xff, 0xff, 0x00, 0x0a, 0x7f, 0xff, 0xfc, 0x39, 0x28, 0x0c, 0xd5, 0x00, 0x00, 0x5f, 0xfe,
+  0xfd, 0x00, 0x06, 0x4c, 0x16, 0xb4, 0xa1, 0x46, 0x82, 0x5f, 0xfd, 0xff, 0x03, 0xfc, 0x00, 0x80, 0xb2, 0xfc, 0x00,
+  0x09, 0x03, 0xfc, 0x56, 0x32, 0x51, 0xb0, 0xeb, 0x90, 0x94, 0xbf, 0xfe, 0xff, 0xff, 0x00, 0x15, 0x7f, 0xff, 0xf8,
+  0xb3, 0x50, 0x13, 0x37, 0x62, 0x40, 0x7f, 0xff, 0xe0, 0x80, 0x00, 0x29, 0xac, 0x16, 0x40, 0x40, 0x51, 0x08, 0x1f,
+  0xfd, 0xff, 0x03, 0xf0, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x08, 0x0f, 0xfb, 0xbc, 0x59, 0x37, 0x70, 0x00, 0xdb, 0x58,
+  0xfd, 0xff, 0x17, 0x00, 0x40, 0x7f, 0xff, 0xfd, 0xb5, 0x30, 0x13, 0x05, 0x56, 0x01, 0x7f, 0xff, 0xff, 0x80, 0x00,
+  0x28, 0x00, 0x04, 0x00, 0x00, 0x80, 0x0c, 0x1f, 0xfd, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x04, 0xfd, 0x00, 0x08,
+  0x7f, 0xf2, 0xab, 0x48, 0x82, 0x31, 0x03, 0x21, 0x04, 0xfd, 0xff, 0xff, 0x00, 0x08, 0x7f, 0xff, 0xf9, 0x49, 0xc0,
+  0x08, 0x00, 0x88, 0x91, 0xfc, 0xff, 0x07, 0x82, 0x00, 0x40, 0x00, 0x01, 0x02, 0x00, 0x1f, 0xfd, 0xff, 0x00, 0xf0,
+  0xfa, 0x00, 0x0a, 0x01, 0xff, 0xf3, 0x4b, 0x18, 0xc0, 0x64, 0x00, 0xd3, 0x50, 0x7f, 0xfe, 0xff, 0xff, 0x00, 0x08,
+  0x7f, 0xff, 0xfc, 0xb4, 0xf0, 0x19, 0x8f, 0x81, 0xd1, 0xfc, 0xff, 0x07, 0x0c, 0x00, 0x00, 0x01, 0xa0, 0x0a, 0x08,
+  0x1f, 0xfd, 0xff, 0x03, 0xf8, 0x00, 0x00, 0x40, 0xfd, 0x00, 0x09, 0x03, 0xff, 0xf1, 0xd7, 0x09, 0x10, 0x58, 0x43,
+  0x4b, 0x4c, 0xfd, 0xff, 0x0a, 0x81, 0x00, 0x7f, 0xff, 0xf9, 0x6c, 0xb0, 0x3a, 0x43, 0x20, 0x40, 0xfd, 0xff, 0x08,
+  0xfe, 0xd2, 0x08, 0xc0, 0x40, 0x88, 0x04, 0x00, 0x3f, 0xfd, 0xff, 0x03, 0xfc, 0x21, 0xc8, 0xa4, 0xfd, 0x00, 0x09,
+  0x0f, 0xff, 0xfa, 0x81, 0xed, 0x98, 0x45, 0x81, 0xb6, 0xb7, 0xfd, 0xff, 0x0a, 0x80, 0x00, 0x7f, 0xff, 0xf8, 0xe2,
+  0x50, 0x04, 0xcc, 0x64, 0x8b, 0xfc, 0xff, 0x07, 0x1f, 0x39, 0x4b, 0x42, 0x10, 0x04, 0x00, 0x3f, 0xfd, 0xff, 0x04,
+  0xfc, 0x82, 0x41, 0x3b, 0x80, 0xfe, 0x00, 0x09, 0x7f, 0xff, 0xf3, 0x4d, 0xee, 0x8b, 0xb0, 0x93, 0xca, 0x4a, 0xfd,
+  0xff, 0x0a, 0x80, 0x00, 0x7f, 0xff, 0xfc, 0xd3, 0x80, 0xc4, 0x1d, 0x80, 0x01, 0xfd, 0xff, 0x08, 0xfc, 0x38, 0x96,
+  0x09, 0x10, 0x96, 0x6a, 0x00, 0x3f, 0xfd, 0xff, 0x11, 0xfc, 0x82, 0xa5, 0x80, 0x5a, 0x40, 0x00, 0x01, 0xff, 0xff,
+  0xec, 0x75, 0xdf, 0xc0, 0x03, 0x02, 0xa1, 0x00, 0xfd, 0xff, 0x0a, 0x80, 0x00, 0x7f, 0xff, 0xf9, 0x3b, 0xe0, 0x09,
+  0x18, 0x10, 0x43, 0xfd, 0xff, 0x08, 0xfc, 0x65, 0x96, 0x04, 0x00, 0x25, 0x50, 0x00, 0x7f, 0xfd, 0xff, 0x11, 0xfe,
+  0x41, 0xe7, 0x0e, 0x20, 0x20, 0x00, 0x0f, 0xff, 0xff, 0xf6, 0xa9, 0x09, 0x84, 0x40, 0x21, 0x92, 0x5a, 0xfd, 0xff,
+  0x0a, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xdb, 0xc3, 0x32, 0x03, 0x80, 0x8b, 0xfc, 0xff, 0x06, 0x00, 0x01, 0x08, 0x00,
+  0x0e, 0x60, 0x00, 0xfc, 0xff, 0x11, 0xfe, 0x40, 0x08, 0x09, 0x2d, 0x50, 0x00, 0x0f, 0xff, 0xff, 0xe3, 0x82, 0x74,
+  0x88, 0x4c, 0x81, 0x45, 0x6c, 0xfd, 0xff, 0x0a, 0x80, 0x00, 0x3f, 0xff, 0xf9, 0x86, 0xc0, 0x04, 0x8a, 0x6c, 0x1f,
+  0xfd, 0xff, 0x07, 0xfe, 0x88, 0x0c, 0x08, 0x10, 0x5c, 0xe0, 0x00, 0xfb, 0xff, 0x10, 0x58, 0x04, 0x01, 0x69, 0xe6,
+  0x00, 0x1f, 0xff, 0xff, 0xe3, 0x44, 0x86, 0x49, 0x00, 0xc1, 0x90, 0xd9, 0xfd, 0xff, 0x0a, 0x80, 0x00, 0x3f, 0xff,
+  0xf9, 0x59, 0x01, 0x80, 0xb9, 0x80, 0x1f, 0xfd, 0xff, 0x07, 0xfe, 0xa0, 0x00, 0x40, 0x50, 0xbc, 0x20, 0x01, 0xfb,
+  0xff, 0x10, 0x20, 0x00, 0x00, 0x46, 0x91, 0x80, 0x1f, 0xff, 0xff, 0xfa, 0x8b, 0x8f, 0x25, 0x18, 0x40, 0x68, 0x2b,
+  0xfd, 0xff, 0x0a, 0x80, 0x00, 0x3f, 0xff, 0xfa, 0x12, 0x80, 0x01, 0x33, 0xba, 0x1f, 0xfd, 0xff, 0x07, 0x9c, 0x40,
+  0x20, 0x00, 0x15, 0x28, 0x00, 0x03, 0xfb, 0xff, 0x10, 0x00, 0x08, 0x70, 0xb0, 0x44, 0x90, 0x3f, 0xff, 0xff, 0x94,
+  0x90, 0xac, 0xa0, 0x08, 0x20, 0xa0, 0xcb, 0xfd, 0xff, 0x0a, 0x80, 0x00, 0x3f, 0xff, 0xfd, 0x86, 0x80, 0x22, 0x03,
+  0x18, 0xe7, 0xfd, 0xff, 0x07, 0x00, 0xd0, 0x00, 0x00, 0x79, 0x20, 0x00, 0x03, 0xfb, 0xff, 0x10, 0x80, 0x08, 0x40,
+  0x49, 0x07, 0x0c, 0x3f, 0xff, 0xff, 0x87, 0x00, 0x04, 0x44, 0x24, 0xe1, 0xb8, 0x93, 0xfd, 0xff, 0x0a, 0x80, 0x00,
+  0x3f, 0xff, 0xfe, 0x61, 0x00, 0x04, 0x1c, 0xcd, 0x03, 0xfe, 0xff, 0x08, 0xfe, 0x08, 0x23, 0x00, 0x63, 0x02, 0x10,
+  0x00, 0x07, 0xfb, 0xff, 0x10, 0xd0, 0x0e, 0x01, 0x4a, 0x4b, 0x42, 0x09, 0xff, 0xff, 0xfa, 0x89, 0x91, 0x04, 0x06,
+  0x48, 0x49, 0x2d, 0xfd, 0xff, 0x0a, 0x80, 0x00, 0x3f, 0xff, 0xfc, 0x93, 0x01, 0x91, 0x11, 0x10, 0x13, 0xfe, 0xff,
+  0x04, 0xf8, 0x80, 0x00, 0x00, 0xf2, 0xfe, 0x00, 0x00, 0x0f, 0xfb, 0xff, 0x10, 0xf2, 0x30, 0xa6, 0x12, 0x0a, 0x00,
+  0x03, 0xff, 0xff, 0x9e, 0x86, 0x98, 0xa4, 0x0c, 0x68, 0xb0, 0xb7, 0xfd, 0xff, 0x0a, 0x80, 0x00, 0x3f, 0xff, 0xfe,
+  0x24, 0x00, 0x00, 0x61, 0x10, 0x03, 0xfe, 0xff, 0x08, 0xfb, 0xfe, 0xcb, 0xa1, 0xde, 0x90, 0x00, 0x00, 0x1f, 0xfb,
+  0xff, 0x10, 0x30, 0x10, 0x22, 0xa0, 0x00, 0x11, 0x00, 0xff, 0xff, 0x25, 0x43, 0x00, 0x89, 0x6c, 0x20, 0x98, 0x03,
+  0xfd, 0xff, 0x0a, 0x80, 0x00, 0x3f, 0xff, 0xfc, 0x45, 0x04, 0x46, 0x77, 0x74, 0x03, 0xfd, 0xff, 0x07, 0x56, 0xc0,
+  0x24, 0xc6, 0x10, 0x00, 0x00, 0x1f, 0xfb, 0xff, 0x10, 0x0b, 0x03, 0x40, 0x90, 0x20, 0x00, 0x80, 0x7f, 0xff, 0xaa,
+  0xe1, 0x03, 0x49, 0x10, 0x10, 0xc5, 0x87, 0xfd, 0xff, 0x0a, 0x80, 0x00, 0x3f, 0xff, 0xfc, 0x8c, 0x02, 0x04, 0x22,
+  0x11, 0x23, 0xfe, 0xff, 0x04, 0xfc, 0x06, 0x00, 0x28, 0x20, 0xfe, 0x00, 0x00, 0x3f, 0xfb, 0xff, 0x10, 0x81, 0x02,
+  0x20, 0x00, 0x52, 0x00, 0x40, 0x3f, 0xff, 0x21, 0x40, 0x11, 0x22, 0x20, 0x00, 0xf2, 0x87, 0xfd, 0xff, 0x0f, 0x80,
+  0x00, 0x3f, 0xff, 0xfe, 0x12, 0x00, 0xb8, 0x80, 0x1d, 0x85, 0xff, 0xff, 0xf4, 0x2e, 0x28, 0xfb, 0x00, 0x00, 0x7f,
+  0xfb, 0xff, 0x10, 0x80, 0x60, 0xa1, 0x76, 0xd1, 0x80, 0x08, 0x3f, 0xff, 0x95, 0x10, 0x00, 0x80, 0x43, 0x00, 0x4a,
+  0x27, 0xfd, 0xff, 0x10, 0xc0, 0x00, 0x1f, 0xff, 0xff, 0xc8, 0x01, 0xdb, 0x10, 0x00, 0x03, 0xff, 0xff, 0xf1, 0x4a,
+  0x00, 0x02, 0xfd, 0x00, 0x01, 0x01, 0x7f, 0xfb, 0xff, 0x10, 0x80, 0x0e, 0x0c, 0xd4, 0x20, 0x05, 0x4c, 0x1f, 0xff,
+  0x1f, 0xa2, 0x24, 0x40, 0x01, 0xa0, 0x80, 0x2f, 0xfd, 0xff, 0x16, 0xc0, 0x20, 0x1f, 0xff, 0xff, 0x3c, 0x41, 0xf6,
+  0x62, 0x64, 0x0d, 0xff, 0xff, 0xb5, 0x58, 0x00, 0x01, 0x00, 0x00, 0x02, 0x44, 0x00, 0x7f, 0xfb, 0xff, 0x10, 0xc0,
+  0x01, 0x6b, 0x41, 0x42, 0x61, 0x04, 0x1f, 0xfe, 0x06, 0x4a, 0x24, 0x40, 0x20, 0x80, 0x30, 0x53, 0xfd, 0xff, 0x0f,
+  0xc0, 0x00, 0x1f, 0xff, 0xfc, 0x58, 0x04, 0x0e, 0xee, 0x42, 0x19, 0xff, 0xff, 0xe9, 0x64, 0x80, 0xfc, 0x00, 0x00,
+  0x81, 0xfa, 0xff, 0x10, 0xe0, 0x06, 0x30, 0x0b, 0x94, 0x10, 0x68, 0x81, 0xa6, 0x50, 0x49, 0x08, 0x08, 0x02, 0x10,
+  0x45, 0x2d, 0xfd, 0xff, 0x0e, 0xc0, 0x00, 0x1f, 0xff, 0xfd, 0x00, 0x00, 0x40, 0x80, 0x10, 0xc3, 0xff, 0xff, 0x6f,
+  0xa2, 0xfc, 0x00, 0x01, 0x80, 0x07, 0xfa, 0xff, 0x10, 0xe0, 0x00, 0x01, 0x00, 0xc9, 0x03, 0x64, 0x00, 0x03, 0x40,
+  0x80, 0x08, 0x89, 0x81, 0x20, 0x22, 0xdd, 0xfd, 0xff, 0x0f, 0xc0, 0x00, 0x1f, 0xff, 0xfe, 0x38, 0x00, 0xf1, 0x00,
+  0x04, 0x87, 0xff, 0xfd, 0x16, 0xe8, 0x20, 0xfe, 0x00, 0x02, 0x02, 0x00, 0x0f, 0xfa, 0xff, 0x10, 0xf0, 0x00, 0x04,
+  0x05, 0xe0, 0x80, 0x60, 0x00, 0x02, 0x0b, 0x33, 0x12, 0x09, 0x21, 0x24, 0x49, 0x27, 0xfd, 0xff, 0x15, 0xc0, 0x00,
+  0x1f, 0xff, 0xfe, 0x18, 0x0c, 0x3a, 0x2c, 0x40, 0x21, 0xff, 0xfa, 0x04, 0x4c, 0x78, 0x09, 0x00, 0x00, 0x24, 0x06,
+  0x7f, 0xfa, 0xff, 0x10, 0xf8, 0x00, 0x00, 0x08, 0x80, 0x80, 0x20, 0x00, 0x30, 0x21, 0x11, 0x10, 0x2c, 0xa0, 0x90,
+  0x20, 0xdf, 0xfd, 0xff, 0x15, 0xc0, 0x00, 0x1f, 0xff, 0xfe, 0xb0, 0x00, 0x2c, 0xc4, 0x53, 0x01, 0xff, 0xf6, 0xa4,
+  0x0c, 0x11, 0x01, 0x14, 0x63, 0x20, 0x00, 0x7f, 0xfa, 0xff, 0x00, 0xfc, 0xfa, 0x00, 0x08, 0x11, 0xbc, 0xa0, 0x10,
+  0x60, 0x04, 0xc8, 0x0a, 0x17, 0xfd, 0xff, 0x15, 0xc0, 0x00, 0x1f, 0xff, 0xfe, 0x68, 0x03, 0x21, 0x9b, 0xb0, 0x89,
+  0xff, 0xfd, 0xa0, 0x6c, 0xc1, 0x59, 0x00, 0x06, 0x00, 0x00, 0xdf, 0xfa, 0xff, 0x01, 0xfc, 0x04, 0xfc, 0x00, 0x09,
+  0x01, 0x98, 0x80, 0x02, 0x26, 0x80, 0x05, 0x81, 0x1c, 0x0f, 0xfd, 0xff, 0x15, 0xc0, 0x10, 0x1f, 0xff, 0xff, 0x30,
+  0x21, 0x01, 0x22, 0x00, 0x03, 0xff, 0xf3, 0x69, 0xd5, 0xdb, 0xa4, 0x40, 0x00, 0x40, 0x03, 0xbf, 0xfa, 0xff, 0x01,
+  0xfe, 0x22, 0xfc, 0x00, 0x09, 0x10, 0x08, 0xb8, 0x10, 0x54, 0x40, 0x01, 0x81, 0x28, 0x1f, 0xfd, 0xff, 0x14, 0xc0,
+  0x00, 0x0f, 0xff, 0xff, 0x60, 0x11, 0x11, 0x1c, 0x42, 0x01, 0xff, 0xa0, 0xdc, 0x41, 0x9a, 0x40, 0x80, 0x04, 0x00,
+  0x00, 0xf8, 0xff, 0x01, 0x21, 0x80, 0xfe, 0x00, 0x0a, 0x02, 0x64, 0xca, 0xa2, 0x50, 0x99, 0xc0, 0xb1, 0x02, 0x15,
+  0xef, 0xfd, 0xff, 0x14, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0x20, 0x11, 0x0e, 0xe8, 0x20, 0x01, 0xff, 0xa6, 0x09, 0xa3,
+  0x02, 0x40, 0x20, 0x04, 0x00, 0x41, 0xf8, 0xff, 0x0f, 0xe1, 0xa0, 0x00, 0xa2, 0x00, 0x38, 0x64, 0x0a, 0x21, 0x34,
+  0xb9, 0x17, 0x92, 0x02, 0x28, 0x8f, 0xfd, 0xff, 0x14, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0x50, 0x13, 0x06, 0x49, 0x12,
+  0x01, 0xfe, 0x0b, 0x28, 0x11, 0x37, 0x47, 0x20, 0x01, 0x00, 0x0f, 0xf8, 0xff, 0x0f, 0xa2, 0xed, 0xc0, 0x01, 0xc0,
+  0x18, 0x26, 0x40, 0x09, 0x33, 0x54, 0x06, 0x00, 0x04, 0x12, 0xaf, 0xfd, 0xff, 0x14, 0xc0, 0x00, 0x0f, 0xff, 0xff,
+  0x60, 0x67, 0x70, 0x8b, 0x30, 0x03, 0xfe, 0x00, 0x0c, 0x92, 0x02, 0x87, 0x20, 0x00, 0x00, 0x3f, 0xf8, 0xff, 0x0f,
+  0xec, 0x48, 0x21, 0x40, 0x00, 0x09, 0x17, 0x44, 0x01, 0x50, 0x02, 0xe8, 0x01, 0x80, 0x0c, 0x4f, 0xfd, 0xff, 0x10,
+  0xc0, 0x00, 0x0f, 0xff, 0xff, 0x40, 0x3b, 0x88, 0x3f, 0x80, 0x15, 0xfc, 0x01, 0x1d, 0xd0, 0x00, 0x01, 0xfe, 0x00,
+  0x00, 0x3f, 0xf8, 0xff, 0x0f, 0xf6, 0x34, 0x83, 0x8c, 0x00, 0x88, 0x82, 0x4a, 0x80, 0x28, 0xf8, 0x64, 0x1c, 0x90,
+  0x1a, 0xdf, 0xfd, 0xff, 0x14, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0x00, 0xbb, 0x08, 0x00, 0x01, 0x03, 0xfc, 0x00, 0x33,
+  0x98, 0x0d, 0x10, 0x00, 0x00, 0x04, 0x7f, 0xf8, 0xff, 0x0f, 0xfe, 0x1c, 0x58, 0x06, 0x04, 0x20, 0xba, 0xfa, 0xe5,
+  0x80, 0x4c, 0x01, 0x98, 0x83, 0x0d, 0xdf, 0xfd, 0xff, 0x10, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x84, 0x44, 0x00,
+  0x2b, 0x8d, 0xfc, 0x02, 0x1b, 0xf0, 0x44, 0x02, 0xfe, 0x00, 0xf7, 0xff, 0x0f, 0xfe, 0x9f, 0x08, 0x0e, 0x06, 0xc0,
+  0x30, 0x6e, 0x0d, 0x99, 0xb4, 0x00, 0x59, 0x44, 0x12, 0x3f, 0xfd, 0xff, 0x13, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xa0,
+  0x26, 0xe0, 0xc5, 0xb0, 0x47, 0xf6, 0x00, 0x41, 0x74, 0x60, 0x20, 0x40, 0x06, 0x61, 0x81, 0xff, 0x81, 0xff, 0x81,
+  0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff,
+  0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0xff, 0xff
 };
+
 constexpr unsigned char MrBeanSurprised[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,
-  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x73, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x40, 0x00,
-  0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xc0, 0x00, 0x00, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x01,
-  0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe0, 0x02, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x03, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x80, 0x00,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x06, 0xbf, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x01, 0xf0, 0x38, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0x00, 0x00, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0xc3, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff,
-  0xf8, 0x60, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x78, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0x80,
-  0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x61,
-  0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x03, 0xc0, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x7f, 0xc0, 0xe0, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x30, 0x00, 0x00,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0x10, 0xdf, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x04, 0x10, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x41, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x02, 0x08, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x42, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x88, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x42, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x12, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x04, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x60, 0x00, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xfd, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
-  0xff, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0xa0, 0x07, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x30, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x01, 0xa0, 0x0f,
-  0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xf3, 0x88, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xc0, 0x1f, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xe0,
-  0x00, 0x03, 0xdf, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x80, 0x00, 0xc0, 0x1f, 0xff, 0xff, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x2f, 0x87, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xc0, 0x3f, 0xf0, 0x0f,
-  0xc0, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x7c, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xc0, 0x3f, 0xe0, 0x03, 0xe0, 0x01, 0xff, 0xff, 0xf0, 0x01, 0xf0,
-  0x0f, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x01, 0x00, 0x7f, 0x88, 0x01, 0xf8, 0x01, 0xff, 0xff, 0x70, 0x03, 0xe0, 0x1e, 0x07, 0x80, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xe0, 0xfe, 0x03, 0xf0, 0xff, 0x01,
-  0xff, 0xff, 0xe0, 0x0f, 0xc0, 0xfe, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x40, 0x03, 0xe0, 0xfe, 0x00, 0x18, 0x3f, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0x87, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x03, 0xc1,
-  0xf8, 0x00, 0x03, 0x1f, 0xc0, 0xff, 0xff, 0xf8, 0x3f, 0x8c, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x80, 0x03, 0xc1, 0xf8, 0x03, 0xfc, 0x8f, 0xf0, 0x7f, 0xff,
-  0xf0, 0x3f, 0x33, 0xff, 0x80, 0x20, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe7, 0xc0, 0x03, 0xc0, 0xf0, 0x0f, 0xff, 0x07, 0xf8, 0x7f, 0xff, 0xe0, 0x7e, 0x4f, 0xff, 0xc0, 0x20, 0x00,
-  0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xc0, 0x07, 0xc0, 0xf0, 0x3f,
-  0xff, 0x83, 0xfe, 0x3f, 0xff, 0xc1, 0xfc, 0x9f, 0xff, 0xf0, 0x20, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xe0, 0x07, 0xc0, 0xf0, 0x3f, 0xff, 0xf1, 0xfc, 0x1f, 0xff, 0xc1, 0xf8,
-  0xbf, 0xcf, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-  0xe0, 0x07, 0x81, 0xe0, 0x7e, 0x07, 0xe8, 0xfc, 0x1f, 0xff, 0xc3, 0xf0, 0xff, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0x07, 0x80, 0x60, 0xfc, 0x23, 0xf8,
-  0x6d, 0x9f, 0xff, 0x83, 0xe4, 0xfe, 0x61, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x60, 0x07, 0x80, 0x00, 0xf8, 0x71, 0xf8, 0x6f, 0xdf, 0xff, 0x83, 0xe0, 0xfc, 0x60,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x20, 0x07,
-  0x01, 0x00, 0xf8, 0x21, 0xf8, 0x3f, 0xff, 0xff, 0x87, 0xc1, 0xfc, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x30, 0x06, 0xdb, 0x00, 0xf0, 0x01, 0xff, 0x3f, 0xdf,
-  0xff, 0x87, 0xcb, 0xfc, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfa, 0xf0, 0x06, 0x9f, 0x80, 0xf8, 0x01, 0xff, 0x9f, 0xff, 0xff, 0x07, 0xcf, 0xfc, 0x00, 0xf0, 0x07,
-  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0x0f, 0x7f, 0x80,
-  0x78, 0x21, 0xff, 0xbf, 0xff, 0xff, 0x03, 0xcf, 0xfc, 0x00, 0xf0, 0x06, 0x80, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf0, 0x0f, 0xbf, 0x00, 0x7c, 0x03, 0xf7, 0xff, 0xff, 0xff, 0x83,
-  0xff, 0xfe, 0x01, 0xe0, 0x06, 0xc0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfd, 0xf0, 0x07, 0xff, 0x00, 0x7c, 0x07, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0x83, 0xf0, 0x00, 0xc0, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf8, 0x0f, 0xff, 0xc0, 0x1f, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0xc0, 0x03, 0x60, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0x0f, 0xff, 0xc0, 0x07, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-  0xea, 0x00, 0x01, 0xf0, 0x00, 0x0e, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf8,
-  0x0f, 0xff, 0xef, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xe0, 0x00, 0x09, 0xf0, 0x00, 0x0f, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xf8, 0x8e, 0xf0, 0x00, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xfb, 0xff, 0xe0,
-  0xdf, 0x60, 0x00, 0x0f, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff,
-  0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x80, 0x0f, 0xff, 0xe0, 0x00, 0x1f, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xfc, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x81, 0xff, 0xff, 0x80, 0x03, 0xff, 0xe0, 0x00, 0x1f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xf8, 0x01, 0xff, 0x80,
-  0x00, 0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1e, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0x7f, 0xc0, 0x00, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xfe,
-  0x90, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0x40, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xf9, 0xc0, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xf8, 0x20, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xff,
-  0xff, 0xff, 0xfe, 0x20, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x7f, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xef, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x37, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff,
-  0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xe8, 0x24, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xff,
-  0xc0, 0x3c, 0x0b, 0xff, 0xff, 0xcc, 0x00, 0x00, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x01, 0xff, 0xff, 0x8c, 0x00,
-  0x00, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff,
-  0xfe, 0x23, 0xfc, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff, 0x8c, 0x00, 0x03, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x7f, 0xff, 0xff, 0xfc, 0x79, 0xc0, 0x0f, 0xff, 0xc0, 0x00,
-  0x00, 0xff, 0xff, 0x84, 0x00, 0x01, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x7f, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xdc, 0x00, 0x01, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x3f, 0xff, 0xff, 0xf8, 0x7c,
-  0x00, 0x03, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x01, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff, 0xff, 0xf0, 0xf8, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x1f,
-  0xff, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x3f, 0xff, 0xff, 0xe1, 0xf8, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xc3, 0xfc, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfd, 0x1f, 0xff, 0xff, 0xc3, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xf0,
-  0x00, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x8f, 0xff,
-  0xff, 0x87, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x02, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x9f, 0xff, 0xff, 0x87, 0xfe, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x1b, 0xff, 0xff, 0x04, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x80, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1b, 0xff, 0xfe, 0x00,
-  0x68, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x4a, 0xff, 0xfe, 0x00, 0x06, 0x76, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x08, 0x7f, 0xfc, 0x00, 0x04, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0b, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x5d, 0xf8, 0x00, 0x39, 0x03,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x13, 0x70, 0x00, 0x00, 0x2a, 0x06, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88,
-  0x00, 0x40, 0x00, 0x03, 0x1e, 0x3e, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x31, 0x0f, 0xfe, 0xf3,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x40, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x20, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x40, 0x20, 0x00, 0x00,
-  0x1b, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x00, 0x20, 0x00, 0x00, 0x07, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00,
-  0xd8, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x38, 0x00, 0x00, 0x0f, 0xdf, 0xf9, 0x80, 0x00, 0x00, 0x01, 0xdc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x18, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xb0, 0x00, 0x00, 0x01, 0xdc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x22, 0x19, 0x00, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 0x00, 0x03, 0xd8, 0x00,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x1e, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xd8, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xd8, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x08, 0xcf, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x4f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x07, 0xd0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x47, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x43, 0xe0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x07, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x43, 0xc0, 0xe0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xa0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x80, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x01,
-  0xc0, 0xf4, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x9f, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x70, 0xf9, 0x00, 0x00, 0x3c, 0x00, 0x00,
-  0x0f, 0xce, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x70, 0x7d, 0xc0, 0x00, 0x28, 0x00, 0x00, 0x1c, 0xbb, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x2e, 0xfe,
-  0x60, 0x00, 0x68, 0x00, 0x00, 0x1f, 0x7f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xfe, 0x7a, 0x40, 0x40, 0x00, 0x00, 0xe5, 0xee,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x3f, 0xfd, 0x3f, 0xd2, 0xc8, 0x00, 0x00, 0xbf, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0x08, 0xff,
-  0xf8, 0x00, 0x00, 0xfd, 0xbe, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xf7, 0x98, 0x9e, 0x80, 0x04, 0x05, 0xff, 0xfc, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x00, 0x0f, 0xff, 0x53, 0x20, 0x90, 0x04, 0x0b, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0xf1, 0xa3, 0x80, 0x10,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x17, 0xfd, 0xb3, 0x7b, 0x87, 0xe1, 0xab, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f,
-  0xfb, 0xff, 0x7e, 0x1e, 0xc5, 0x5f, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xb5, 0xb7, 0x83, 0xef, 0xff, 0xef,
-  0xe8, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x8f, 0xf3, 0xfe, 0xf7, 0xef, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x7f, 0xb8, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x10, 0x00, 0x07, 0xbf, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xa8, 0x00,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x30, 0x00, 0x06, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xe0, 0x00, 0x10, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x38, 0x00, 0x02, 0xff, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x10, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x38, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x80, 0x00, 0x38, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x78, 0x00,
-  0x03, 0xff, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x38, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x78, 0x00, 0x01, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-  0xe8, 0x00, 0x00, 0x38, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x00, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x78, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xfc, 0x02, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x7c, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00,
-  0x00, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00,
-  0x1f, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x5f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xa0, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xfe,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x7f, 0xff,
-  0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xff, 0xff, 0xc0, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0xfb, 0xff, 0xff, 0xd0, 0x00,
-  0x00, 0x1f, 0xff, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00,
-  0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x9f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xff, 0x30, 0x00, 0x01, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x07,
-  0xfb, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x38, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0x6e, 0xff, 0x90, 0x00, 0x00, 0x00, 0x7f,
-  0xff, 0x1c, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x1f, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x48, 0x7f,
-  0x80, 0x00, 0x00, 0x01, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x9f,
-  0x80, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff,
-  0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0x9f, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0f, 0xff, 0xff, 0x9f, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xdf, 0xc0, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfc, 0x80,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x08, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xc0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf8, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00,
-  0x00, 0x10, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x02, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x01, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x82, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x40, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0x50, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x10, 0x00, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x04, 0x00, 0x00,
-  0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0c, 0x80, 0x00, 0x00, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0x9f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x80, 0x00,
-  0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x20, 0x01, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x40,
-  0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x10, 0x00, 0x08, 0x00,
-  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x26, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+  0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0x81, 0xff, 0xc9, 0xff, 0x03, 0xf8, 0x00, 0x00, 0x1f,
+  0xd3, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0x00, 0x7f, 0xd5, 0xff, 0x00, 0xfe, 0xfd, 0x00, 0x00, 0x1f, 0xd5, 0xff, 0x00,
+  0xc0, 0xfd, 0x00, 0x00, 0x03, 0xd6, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x01, 0xd6, 0xff, 0x00, 0xf8, 0xfb, 0x00,
+  0x00, 0x7f, 0xd8, 0xff, 0x00, 0xfe, 0xfa, 0x00, 0x00, 0x3f, 0xd8, 0xff, 0x00, 0xf8, 0xfa, 0x00, 0x00, 0x1f, 0xd8,
+  0xff, 0x00, 0xc0, 0xfa, 0x00, 0x00, 0x07, 0xd9, 0xff, 0x00, 0xfc, 0xf9, 0x00, 0x00, 0x07, 0xd9, 0xff, 0x00, 0xf8,
+  0xf9, 0x00, 0x00, 0x03, 0xd9, 0xff, 0x00, 0xf0, 0xf8, 0x00, 0xd9, 0xff, 0x00, 0xe0, 0xf8, 0x00, 0x00, 0x7f, 0xda,
+  0xff, 0x00, 0x80, 0xf8, 0x00, 0x00, 0x3f, 0xdb, 0xff, 0x00, 0xfe, 0xf7, 0x00, 0x00, 0x1f, 0xdb, 0xff, 0x00, 0xfe,
+  0xf7, 0x00, 0x00, 0x1f, 0xdb, 0xff, 0x00, 0xfc, 0xf7, 0x00, 0x00, 0x0f, 0xdb, 0xff, 0x00, 0xfc, 0xf7, 0x00, 0x00,
+  0x07, 0xdb, 0xff, 0x00, 0xfc, 0xf7, 0x00, 0x00, 0x03, 0xdb, 0xff, 0x00, 0xf0, 0xf7, 0x00, 0x00, 0x01, 0xdb, 0xff,
+  0x00, 0xe0, 0xf7, 0x00, 0x00, 0x01, 0xdb, 0xff, 0x00, 0xc0, 0xf7, 0x00, 0x00, 0x01, 0xdb, 0xff, 0xf5, 0x00, 0x00,
+  0x7f, 0xdd, 0xff, 0x00, 0xfe, 0xf5, 0x00, 0x00, 0x0f, 0xdd, 0xff, 0x00, 0xfc, 0xf5, 0x00, 0x00, 0x03, 0xdd, 0xff,
+  0x00, 0xf8, 0xf4, 0x00, 0xdd, 0xff, 0x00, 0xf8, 0xf4, 0x00, 0x00, 0x7f, 0xde, 0xff, 0x00, 0xf0, 0xf4, 0x00, 0x00,
+  0x3f, 0xde, 0xff, 0x00, 0xe0, 0xf4, 0x00, 0x00, 0x1f, 0xde, 0xff, 0x00, 0x80, 0xf4, 0x00, 0x00, 0x0f, 0xde, 0xff,
+  0x00, 0x80, 0xf4, 0x00, 0x00, 0x07, 0xde, 0xff, 0xf3, 0x00, 0x00, 0x01, 0xdf, 0xff, 0x00, 0xfe, 0xf2, 0x00, 0xdf,
+  0xff, 0x00, 0xfe, 0xf2, 0x00, 0x00, 0x7f, 0xe0, 0xff, 0x00, 0xfc, 0xf2, 0x00, 0x00, 0x3f, 0xe0, 0xff, 0x00, 0xfc,
+  0xf2, 0x00, 0x00, 0x1f, 0xe0, 0xff, 0x00, 0xf8, 0xf2, 0x00, 0x00, 0x1f, 0xe0, 0xff, 0x00, 0xf0, 0xf7, 0x00, 0x00,
+  0x18, 0xfd, 0x00, 0x00, 0x0f, 0xe0, 0xff, 0x00, 0xf0, 0xfa, 0x00, 0x03, 0x02, 0x2f, 0xff, 0xfc, 0xfd, 0x00, 0x00,
+  0x07, 0xe0, 0xff, 0x00, 0xe0, 0xfa, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x03, 0xe0, 0xff,
+  0x00, 0xc0, 0xfb, 0x00, 0x00, 0x7f, 0xfd, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x01, 0xe0, 0xff, 0x00, 0x80, 0xfc,
+  0x00, 0x00, 0x3f, 0xfc, 0xff, 0x00, 0xf8, 0xfd, 0x00, 0xe0, 0xff, 0xfc, 0x00, 0x00, 0x05, 0xfb, 0xff, 0x00, 0xf8,
+  0xfd, 0x00, 0x00, 0x7f, 0xe1, 0xff, 0xfd, 0x00, 0x01, 0x0b, 0xbf, 0xfb, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x3f,
+  0xe1, 0xff, 0xfe, 0x00, 0x01, 0x03, 0x7f, 0xf9, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xe2, 0xff, 0x00, 0xfe, 0xfe, 0x00,
+  0x00, 0x3f, 0xf8, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xe2, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x01, 0xf7, 0xff, 0x00, 0x40,
+  0xfe, 0x00, 0x00, 0x0f, 0xe1, 0xff, 0xff, 0x00, 0x00, 0x73, 0xf7, 0xff, 0xfd, 0x00, 0x00, 0x0f, 0xe1, 0xff, 0xff,
+  0x00, 0x00, 0xcf, 0xf7, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x0f, 0xe1, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xf7, 0xff,
+  0x00, 0x80, 0xfe, 0x00, 0x00, 0x07, 0xe2, 0xff, 0x02, 0xfd, 0x00, 0x00, 0xf7, 0xff, 0x01, 0xfe, 0x40, 0xfe, 0x00,
+  0x00, 0x07, 0xe2, 0xff, 0x02, 0xfc, 0x00, 0x03, 0xf7, 0xff, 0x01, 0xfc, 0x40, 0xfe, 0x00, 0x00, 0x07, 0xe2, 0xff,
+  0x02, 0xfc, 0x00, 0x03, 0xf7, 0xff, 0x01, 0xfe, 0x20, 0xfe, 0x00, 0x00, 0x07, 0xe2, 0xff, 0x02, 0xfc, 0x00, 0x03,
+  0xf6, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x07, 0xe2, 0xff, 0x02, 0xfc, 0x00, 0x03, 0xf7, 0xff, 0x01, 0xf1, 0xc0,
+  0xfe, 0x00, 0x00, 0x03, 0xe2, 0xff, 0x02, 0xfc, 0x00, 0x01, 0xf7, 0xff, 0x00, 0xf0, 0xfd, 0x00, 0x00, 0x03, 0xe2,
+  0xff, 0x02, 0xfc, 0x00, 0x03, 0xf7, 0xff, 0x00, 0xfe, 0xfd, 0x00, 0x00, 0x03, 0xe2, 0xff, 0x02, 0xf8, 0x00, 0x03,
+  0xf6, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x03, 0xe2, 0xff, 0x02, 0xf8, 0x00, 0x03, 0xf6, 0xff, 0x00, 0xc0, 0xfe,
+  0x00, 0x00, 0x03, 0xe2, 0xff, 0x03, 0xf8, 0x00, 0x01, 0xfb, 0xf7, 0xff, 0x00, 0xf0, 0xfe, 0x00, 0x00, 0x01, 0xe2,
+  0xff, 0x03, 0xf8, 0x00, 0x01, 0xf9, 0xf9, 0xff, 0x02, 0xfe, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x01, 0xe2, 0xff, 0x03,
+  0xf0, 0x00, 0x03, 0x3f, 0xf8, 0xff, 0x01, 0xe0, 0x02, 0xfe, 0x00, 0x00, 0x01, 0xe2, 0xff, 0x03, 0xf0, 0x00, 0x03,
+  0x3f, 0xf7, 0xff, 0x04, 0xc0, 0x80, 0x00, 0x00, 0x01, 0xe2, 0xff, 0x03, 0xf0, 0x00, 0x06, 0xbf, 0xf7, 0xff, 0x00,
+  0xf8, 0xfe, 0x00, 0x00, 0x01, 0xe2, 0xff, 0x04, 0xf0, 0x00, 0x01, 0xff, 0x03, 0xf8, 0xff, 0x00, 0xfe, 0xfe, 0x00,
+  0x00, 0x01, 0xe2, 0xff, 0x05, 0xf0, 0x00, 0x01, 0xf0, 0x38, 0x7f, 0xfa, 0xff, 0x01, 0xe0, 0x1f, 0xfe, 0x00, 0x00,
+  0x01, 0xe2, 0xff, 0x03, 0xe0, 0x00, 0x01, 0xc3, 0xf9, 0xff, 0x06, 0xfe, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01, 0xe2,
+  0xff, 0x03, 0xe0, 0x00, 0x01, 0x1f, 0xf9, 0xff, 0x06, 0xf0, 0xff, 0xf8, 0x60, 0x00, 0x00, 0x01, 0xe2, 0xff, 0x02,
+  0xe0, 0x00, 0x01, 0xf8, 0xff, 0x02, 0xe7, 0xff, 0xfe, 0xfe, 0x00, 0x00, 0x01, 0xe2, 0xff, 0x03, 0xc0, 0x00, 0x00,
+  0xbf, 0xf6, 0xff, 0xfe, 0x00, 0x00, 0x01, 0xe2, 0xff, 0x04, 0xc0, 0x00, 0x00, 0x78, 0x01, 0xf9, 0xff, 0x05, 0xe0,
+  0x0f, 0x80, 0x00, 0x00, 0x01, 0xe2, 0xff, 0x05, 0x80, 0x00, 0x00, 0x61, 0xfe, 0x3f, 0xfa, 0xff, 0x05, 0x86, 0x03,
+  0xc0, 0x00, 0x00, 0x01, 0xe2, 0xff, 0xfe, 0x00, 0x00, 0xc7, 0xf9, 0xff, 0x06, 0xfc, 0x7f, 0xc0, 0xe0, 0x00, 0x00,
+  0x01, 0xe2, 0xff, 0xfe, 0x00, 0x00, 0x8f, 0xf7, 0xff, 0x04, 0xc0, 0x30, 0x00, 0x00, 0x01, 0xe2, 0xff, 0xff, 0x00,
+  0x02, 0x01, 0x10, 0xdf, 0xf9, 0xff, 0x05, 0xf8, 0x04, 0x10, 0x00, 0x00, 0x01, 0xe2, 0xff, 0xff, 0x00, 0x02, 0x41,
+  0x00, 0x0f, 0xf9, 0xff, 0x05, 0xe0, 0x02, 0x08, 0x00, 0x00, 0x01, 0xe2, 0xff, 0xff, 0x00, 0x02, 0x42, 0x00, 0x03,
+  0xf9, 0xff, 0x02, 0x80, 0x00, 0x88, 0xfe, 0x00, 0xe2, 0xff, 0xff, 0x00, 0x03, 0x42, 0x00, 0x00, 0x7f, 0xfb, 0xff,
+  0x00, 0xfe, 0xfb, 0x00, 0xe2, 0xff, 0xff, 0x00, 0x03, 0x12, 0x00, 0x00, 0x1f, 0xfb, 0xff, 0x00, 0xfc, 0xfb, 0x00,
+  0xe2, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xfb, 0xff, 0x00, 0xf8, 0xfb, 0x00, 0xe3, 0xff, 0x06, 0xfe, 0x00, 0x00, 0x04,
+  0x00, 0x00, 0x03, 0xfb, 0xff, 0x00, 0xc0, 0xfb, 0x00, 0xe3, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x20, 0xfe, 0x00, 0x00,
+  0x3f, 0xfc, 0xff, 0x00, 0x80, 0xfb, 0x00, 0xe3, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x60, 0xfe, 0x00, 0x00, 0x1f, 0xfd,
+  0xff, 0x00, 0xfe, 0xfa, 0x00, 0xe3, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x70, 0xfe, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x00,
+  0xf8, 0xfa, 0x00, 0x00, 0x7f, 0xe4, 0xff, 0x03, 0xfe, 0x00, 0x00, 0x60, 0xfe, 0x00, 0x00, 0x07, 0xfd, 0xff, 0x00,
+  0xe0, 0xfa, 0x00, 0x00, 0x7f, 0xe3, 0xff, 0xff, 0x00, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x00, 0xe0,
+  0xfa, 0x00, 0x00, 0x7f, 0xe3, 0xff, 0xff, 0x00, 0x00, 0x40, 0xfe, 0x00, 0x00, 0x01, 0xfd, 0xff, 0x00, 0xc0, 0xfa,
+  0x00, 0x00, 0x7f, 0xe3, 0xff, 0xff, 0x00, 0x00, 0x60, 0xfd, 0x00, 0x04, 0x7f, 0xff, 0xff, 0xfd, 0xc0, 0xfa, 0x00,
+  0x00, 0x7f, 0xe3, 0xff, 0xff, 0x00, 0x00, 0x60, 0xfd, 0x00, 0x04, 0x1f, 0xff, 0xff, 0xfd, 0x80, 0xfa, 0x00, 0x00,
+  0x7f, 0xe3, 0xff, 0x0d, 0x80, 0x00, 0xa0, 0x07, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xf5, 0x00, 0x00, 0x30, 0xfc,
+  0x00, 0x00, 0x7f, 0xe3, 0xff, 0x0e, 0x80, 0x01, 0xa0, 0x0f, 0xff, 0xe0, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x01,
+  0xf3, 0x88, 0xfd, 0x00, 0x00, 0x3f, 0xe3, 0xff, 0x0f, 0x80, 0x00, 0xc0, 0x1f, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff,
+  0xe0, 0x00, 0x03, 0xdf, 0xff, 0x80, 0xfe, 0x00, 0x00, 0x3f, 0xe3, 0xff, 0x0e, 0x80, 0x00, 0xc0, 0x1f, 0xff, 0xff,
+  0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x2f, 0x87, 0xff, 0xfd, 0x00, 0x00, 0x3f, 0xe3, 0xff, 0x0f, 0x80, 0x00, 0xc0,
+  0x3f, 0xf0, 0x0f, 0xc0, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x7c, 0x00, 0xff, 0x80, 0xfe, 0x00, 0x00, 0x3f, 0xe3, 0xff,
+  0x0f, 0x80, 0x00, 0xc0, 0x3f, 0xe0, 0x03, 0xe0, 0x01, 0xff, 0xff, 0xf0, 0x01, 0xf0, 0x0f, 0x07, 0xc0, 0xfe, 0x00,
+  0x00, 0x3f, 0xe3, 0xff, 0x0f, 0x80, 0x01, 0x00, 0x7f, 0x88, 0x01, 0xf8, 0x01, 0xff, 0xff, 0x70, 0x03, 0xe0, 0x1e,
+  0x07, 0x80, 0xfe, 0x00, 0x00, 0x3f, 0xe3, 0xff, 0x0f, 0xc0, 0x01, 0xe0, 0xfe, 0x03, 0xf0, 0xff, 0x01, 0xff, 0xff,
+  0xe0, 0x0f, 0xc0, 0xfe, 0x01, 0xc0, 0xfe, 0x00, 0x00, 0x0f, 0xe4, 0xff, 0x10, 0xfc, 0x40, 0x03, 0xe0, 0xfe, 0x00,
+  0x18, 0x3f, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0x87, 0x00, 0x00, 0x10, 0xfe, 0x00, 0x00, 0x07, 0xe3, 0xff, 0x0f, 0x80,
+  0x03, 0xc1, 0xf8, 0x00, 0x03, 0x1f, 0xc0, 0xff, 0xff, 0xf8, 0x3f, 0x8c, 0x00, 0x00, 0x20, 0xfe, 0x00, 0x00, 0x07,
+  0xe4, 0xff, 0x10, 0xef, 0x80, 0x03, 0xc1, 0xf8, 0x03, 0xfc, 0x8f, 0xf0, 0x7f, 0xff, 0xf0, 0x3f, 0x33, 0xff, 0x80,
+  0x20, 0xfe, 0x00, 0x00, 0x03, 0xe4, 0xff, 0x10, 0xe7, 0xc0, 0x03, 0xc0, 0xf0, 0x0f, 0xff, 0x07, 0xf8, 0x7f, 0xff,
+  0xe0, 0x7e, 0x4f, 0xff, 0xc0, 0x20, 0xfe, 0x00, 0x00, 0x03, 0xe4, 0xff, 0x10, 0xc3, 0xc0, 0x07, 0xc0, 0xf0, 0x3f,
+  0xff, 0x83, 0xfe, 0x3f, 0xff, 0xc1, 0xfc, 0x9f, 0xff, 0xf0, 0x20, 0xfe, 0x00, 0x00, 0x03, 0xe4, 0xff, 0x0f, 0xc3,
+  0xe0, 0x07, 0xc0, 0xf0, 0x3f, 0xff, 0xf1, 0xfc, 0x1f, 0xff, 0xc1, 0xf8, 0xbf, 0xcf, 0xf0, 0xfd, 0x00, 0x00, 0x03,
+  0xe4, 0xff, 0x0f, 0xe1, 0xe0, 0x07, 0x81, 0xe0, 0x7e, 0x07, 0xe8, 0xfc, 0x1f, 0xff, 0xc3, 0xf0, 0xff, 0x03, 0xf8,
+  0xfd, 0x00, 0x00, 0x03, 0xe4, 0xff, 0xff, 0xe0, 0x0d, 0x07, 0x80, 0x60, 0xfc, 0x23, 0xf8, 0x6d, 0x9f, 0xff, 0x83,
+  0xe4, 0xfe, 0x61, 0xf8, 0xfd, 0x00, 0x00, 0x01, 0xe4, 0xff, 0x0f, 0xe0, 0x60, 0x07, 0x80, 0x00, 0xf8, 0x71, 0xf8,
+  0x6f, 0xdf, 0xff, 0x83, 0xe0, 0xfc, 0x60, 0xf8, 0xfd, 0x00, 0x00, 0x03, 0xe4, 0xff, 0x0f, 0xf4, 0x20, 0x07, 0x01,
+  0x00, 0xf8, 0x21, 0xf8, 0x3f, 0xff, 0xff, 0x87, 0xc1, 0xfc, 0x00, 0xf8, 0xfd, 0x00, 0x00, 0x03, 0xe4, 0xff, 0x0f,
+  0xf0, 0x30, 0x06, 0xdb, 0x00, 0xf0, 0x01, 0xff, 0x3f, 0xdf, 0xff, 0x87, 0xcb, 0xfc, 0x00, 0xf8, 0xfd, 0x00, 0x00,
+  0x03, 0xe4, 0xff, 0x10, 0xfa, 0xf0, 0x06, 0x9f, 0x80, 0xf8, 0x01, 0xff, 0x9f, 0xff, 0xff, 0x07, 0xcf, 0xfc, 0x00,
+  0xf0, 0x07, 0xfe, 0x00, 0x00, 0x03, 0xe4, 0xff, 0x14, 0xfb, 0xf0, 0x0f, 0x7f, 0x80, 0x78, 0x21, 0xff, 0xbf, 0xff,
+  0xff, 0x03, 0xcf, 0xfc, 0x00, 0xf0, 0x06, 0x80, 0x00, 0x00, 0x07, 0xe4, 0xff, 0x07, 0xfb, 0xf0, 0x0f, 0xbf, 0x00,
+  0x7c, 0x03, 0xf7, 0xfe, 0xff, 0x09, 0x83, 0xff, 0xfe, 0x01, 0xe0, 0x06, 0xc0, 0x00, 0x00, 0x07, 0xe4, 0xff, 0x06,
+  0xfd, 0xf0, 0x07, 0xff, 0x00, 0x7c, 0x07, 0xfd, 0xff, 0x09, 0x01, 0xff, 0xff, 0x83, 0xf0, 0x00, 0xc0, 0x00, 0x00,
+  0x07, 0xe4, 0xff, 0x06, 0xfd, 0xf8, 0x0f, 0xff, 0xc0, 0x1f, 0x3f, 0xfd, 0xff, 0x00, 0x81, 0xfe, 0xff, 0x05, 0xc0,
+  0x03, 0x60, 0x00, 0x00, 0x07, 0xe4, 0xff, 0x06, 0xfc, 0xf8, 0x0f, 0xff, 0xc0, 0x07, 0xfd, 0xfd, 0xff, 0x09, 0x83,
+  0xff, 0xff, 0xea, 0x00, 0x01, 0xf0, 0x00, 0x0e, 0x07, 0xe4, 0xff, 0x06, 0xfe, 0xf8, 0x0f, 0xff, 0xef, 0x00, 0x7f,
+  0xfd, 0xff, 0x09, 0x87, 0xff, 0xff, 0xe0, 0x00, 0x09, 0xf0, 0x00, 0x0f, 0x0f, 0xe3, 0xff, 0x03, 0xf8, 0x0f, 0xff,
+  0xef, 0xfb, 0xff, 0x00, 0x83, 0xfe, 0xff, 0x05, 0xf8, 0x8e, 0xf0, 0x00, 0x0f, 0x0f, 0xe3, 0xff, 0x05, 0xf8, 0x0f,
+  0xff, 0xf7, 0xff, 0xfd, 0xfd, 0xff, 0x09, 0x83, 0xff, 0xfb, 0xff, 0xe0, 0xdf, 0x60, 0x00, 0x0f, 0x1f, 0xe3, 0xff,
+  0x01, 0xf8, 0x0f, 0xfe, 0xff, 0x00, 0xcf, 0xfd, 0xff, 0x09, 0x81, 0xff, 0xfe, 0x80, 0x0f, 0xff, 0xe0, 0x00, 0x1f,
+  0x1f, 0xe3, 0xff, 0x04, 0xfc, 0x0f, 0xff, 0xfc, 0x77, 0xfc, 0xff, 0x09, 0x81, 0xff, 0xff, 0x80, 0x03, 0xff, 0xe0,
+  0x00, 0x1f, 0x3f, 0xe3, 0xff, 0x01, 0xfc, 0x0f, 0xf9, 0xff, 0x09, 0x80, 0x7f, 0xff, 0xf8, 0x01, 0xff, 0x80, 0x00,
+  0x1f, 0x7f, 0xe3, 0xff, 0x01, 0xfe, 0x1e, 0xf9, 0xff, 0x01, 0x80, 0x3f, 0xfe, 0xff, 0x04, 0x7f, 0xc0, 0x00, 0x3f,
+  0x7f, 0xe3, 0xff, 0x01, 0xfc, 0x1e, 0xf9, 0xff, 0x01, 0x80, 0x3f, 0xfd, 0xff, 0x03, 0xc0, 0x00, 0x3f, 0x7f, 0xe3,
+  0xff, 0x01, 0xfc, 0x3f, 0xf9, 0xff, 0x01, 0x80, 0x1f, 0xfd, 0xff, 0x03, 0xe0, 0x00, 0x3f, 0x7f, 0xe3, 0xff, 0x01,
+  0xfe, 0x3f, 0xf9, 0xff, 0x01, 0xc0, 0x9f, 0xfd, 0xff, 0x02, 0xc0, 0x00, 0x3f, 0xe2, 0xff, 0x01, 0xfe, 0x3f, 0xf9,
+  0xff, 0x01, 0xe0, 0x7f, 0xfd, 0xff, 0x02, 0xc0, 0x00, 0x3f, 0xe2, 0xff, 0x01, 0xfe, 0x1f, 0xf9, 0xff, 0x01, 0xe0,
+  0x3f, 0xfd, 0xff, 0x02, 0x40, 0x00, 0x3f, 0xe1, 0xff, 0x00, 0x9f, 0xf9, 0xff, 0x01, 0xf0, 0x1f, 0xfd, 0xff, 0x02,
+  0xe0, 0x00, 0x3f, 0xe1, 0xff, 0x00, 0x9f, 0xf9, 0xff, 0x01, 0xf0, 0x0f, 0xfe, 0xff, 0x03, 0xfe, 0x90, 0x00, 0x3f,
+  0xe1, 0xff, 0x00, 0x8f, 0xf9, 0xff, 0x01, 0xf0, 0x07, 0xfd, 0xff, 0x02, 0xd0, 0x00, 0x3f, 0xe1, 0xff, 0x00, 0xdf,
+  0xf9, 0xff, 0x01, 0xf0, 0x03, 0xfd, 0xff, 0x02, 0x40, 0x00, 0x3f, 0xe1, 0xff, 0x00, 0xc7, 0xf9, 0xff, 0x01, 0xf0,
+  0x00, 0xfe, 0xff, 0x03, 0xf9, 0xc0, 0x00, 0x1f, 0xe1, 0xff, 0x01, 0xcf, 0x7f, 0xfa, 0xff, 0x01, 0xf8, 0x00, 0xfe,
+  0xff, 0x03, 0xf8, 0x20, 0x00, 0x1f, 0xe1, 0xff, 0x01, 0xef, 0x7f, 0xfa, 0xff, 0x01, 0xfc, 0x00, 0xfe, 0xff, 0x03,
+  0xfe, 0x20, 0x00, 0x1f, 0xe1, 0xff, 0x00, 0xeb, 0xf9, 0xff, 0x08, 0xfc, 0x10, 0x7f, 0xff, 0xff, 0xfe, 0x20, 0x00,
+  0x0f, 0xe1, 0xff, 0x00, 0xe7, 0xf9, 0xff, 0x08, 0xfc, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x1b, 0xe2, 0xff,
+  0x01, 0xef, 0xf7, 0xf9, 0xff, 0x08, 0xf8, 0x00, 0x37, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x03, 0xe2, 0xff, 0x01, 0xf7,
+  0xfe, 0xfd, 0xff, 0x00, 0xef, 0xfe, 0xff, 0x08, 0xe8, 0x24, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xc3, 0xe1, 0xff,
+  0x00, 0xf6, 0xfd, 0xff, 0x00, 0x87, 0xfe, 0xff, 0x08, 0xc0, 0x3c, 0x0b, 0xff, 0xff, 0xcc, 0x00, 0x00, 0xc7, 0xe1,
+  0xff, 0x00, 0xf2, 0xfd, 0xff, 0x00, 0x03, 0xfe, 0xff, 0x08, 0xc0, 0x1c, 0x01, 0xff, 0xff, 0x8c, 0x00, 0x00, 0xcf,
+  0xe1, 0xff, 0x11, 0xf7, 0x7f, 0xff, 0xff, 0xfe, 0x23, 0xfc, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff, 0x8c, 0x00,
+  0x03, 0x87, 0xe1, 0xff, 0x11, 0xf9, 0x7f, 0xff, 0xff, 0xfc, 0x79, 0xc0, 0x0f, 0xff, 0xc0, 0x00, 0x00, 0xff, 0xff,
+  0x84, 0x00, 0x01, 0x8f, 0xe1, 0xff, 0x11, 0xf8, 0x7f, 0xff, 0xff, 0xfc, 0xfc, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x00,
+  0x7f, 0xff, 0xdc, 0x00, 0x01, 0x3f, 0xe1, 0xff, 0x11, 0xfa, 0x3f, 0xff, 0xff, 0xf8, 0x7c, 0x00, 0x03, 0xff, 0x80,
+  0x00, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x01, 0x7f, 0xe1, 0xff, 0x08, 0xf8, 0x3f, 0xff, 0xff, 0xf0, 0xf8, 0x00, 0x00,
+  0xef, 0xfe, 0x00, 0x05, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0xe1, 0xff, 0x08, 0xf0, 0x3f, 0xff, 0xff, 0xe1, 0xf8,
+  0x00, 0x00, 0x04, 0xfe, 0x00, 0x05, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xe1, 0xff, 0x05, 0xf1, 0x1f, 0xff, 0xff,
+  0xc3, 0xfc, 0xfc, 0x00, 0x05, 0x01, 0x0f, 0xff, 0xf0, 0x00, 0x00, 0xe0, 0xff, 0x05, 0xfd, 0x1f, 0xff, 0xff, 0xc3,
+  0xfc, 0xfb, 0x00, 0x04, 0x07, 0xff, 0xf0, 0x00, 0x02, 0xe0, 0xff, 0x05, 0xfc, 0x8f, 0xff, 0xff, 0x87, 0xff, 0xfb,
+  0x00, 0x05, 0x03, 0xff, 0xf0, 0x00, 0x02, 0x7f, 0xe1, 0xff, 0x06, 0xfe, 0x9f, 0xff, 0xff, 0x87, 0xfe, 0x80, 0xfc,
+  0x00, 0x04, 0x01, 0xff, 0xe0, 0x00, 0x03, 0xe0, 0xff, 0x05, 0xfe, 0x1b, 0xff, 0xff, 0x04, 0xbc, 0xfb, 0x00, 0x04,
+  0x01, 0xff, 0x80, 0x00, 0x03, 0xe0, 0xff, 0x06, 0xfe, 0x1b, 0xff, 0xfe, 0x00, 0x68, 0x0a, 0xfb, 0x00, 0x03, 0x7f,
+  0x00, 0x00, 0x03, 0xe0, 0xff, 0x07, 0xfe, 0x4a, 0xff, 0xfe, 0x00, 0x06, 0x76, 0x80, 0xfc, 0x00, 0x03, 0x7f, 0x00,
+  0x00, 0x03, 0xe0, 0xff, 0x06, 0xfe, 0x08, 0x7f, 0xfc, 0x00, 0x04, 0x3c, 0xfb, 0x00, 0x03, 0x1c, 0x00, 0x00, 0x0b,
+  0xdf, 0xff, 0x06, 0x4c, 0x5d, 0xf8, 0x00, 0x39, 0x03, 0x80, 0xfc, 0x00, 0x03, 0x08, 0x00, 0x00, 0x1f, 0xdf, 0xff,
+  0x07, 0xb4, 0x13, 0x70, 0x00, 0x00, 0x2a, 0x06, 0x10, 0xfa, 0x00, 0x00, 0x87, 0xdf, 0xff, 0x07, 0x88, 0x00, 0x40,
+  0x00, 0x03, 0x1e, 0x3e, 0xb8, 0xfa, 0x00, 0x00, 0xe7, 0xdf, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x03, 0x31, 0x0f, 0xfe,
+  0xf3, 0xfa, 0x00, 0xde, 0xff, 0x00, 0xf8, 0xfd, 0x00, 0x02, 0x0f, 0xff, 0xfe, 0xfb, 0x00, 0x00, 0x01, 0xde, 0xff,
+  0x00, 0xf0, 0xfd, 0x00, 0x02, 0x0f, 0xff, 0xff, 0xfb, 0x00, 0x00, 0x01, 0xde, 0xff, 0x08, 0xd0, 0x00, 0x40, 0x00,
+  0x00, 0x3f, 0xff, 0xff, 0x80, 0xfc, 0x00, 0x00, 0x01, 0xde, 0xff, 0x07, 0xc0, 0x00, 0x20, 0x00, 0x00, 0x7f, 0xff,
+  0xff, 0xfd, 0x00, 0x02, 0x08, 0x00, 0x01, 0xde, 0xff, 0x08, 0xe0, 0x40, 0x20, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x80,
+  0xfe, 0x00, 0x02, 0x1c, 0x00, 0x01, 0xde, 0xff, 0x08, 0xe8, 0x00, 0x20, 0x00, 0x00, 0x07, 0xff, 0xff, 0x80, 0xfe,
+  0x00, 0x02, 0xd8, 0x00, 0x03, 0xde, 0xff, 0x0e, 0xe0, 0x00, 0x38, 0x00, 0x00, 0x0f, 0xdf, 0xf9, 0x80, 0x00, 0x00,
+  0x01, 0xdc, 0x00, 0x03, 0xde, 0xff, 0x0e, 0xf0, 0x00, 0x18, 0x00, 0x00, 0x07, 0xff, 0xff, 0xb0, 0x00, 0x00, 0x01,
+  0xdc, 0x00, 0x03, 0xde, 0xff, 0x02, 0xe0, 0x22, 0x19, 0xfe, 0x00, 0xff, 0xff, 0x06, 0x80, 0x00, 0x00, 0x03, 0xd8,
+  0x00, 0x07, 0xde, 0xff, 0x02, 0xf0, 0x00, 0x1e, 0xfd, 0x00, 0x00, 0xfc, 0xfe, 0x00, 0x03, 0x03, 0xd8, 0x00, 0x07,
+  0xde, 0xff, 0x02, 0xf0, 0x00, 0x8e, 0xf9, 0x00, 0x03, 0x07, 0xd8, 0x00, 0x07, 0xde, 0xff, 0x02, 0xf0, 0x00, 0x0f,
+  0xf9, 0x00, 0x03, 0x07, 0xd0, 0x00, 0x07, 0xde, 0xff, 0x03, 0xf8, 0x08, 0xcf, 0x40, 0xfa, 0x00, 0x03, 0x07, 0xd0,
+  0x00, 0x0f, 0xde, 0xff, 0x03, 0xf8, 0x00, 0x4f, 0x80, 0xfa, 0x00, 0x03, 0x07, 0xd0, 0x00, 0x0f, 0xde, 0xff, 0x03,
+  0xf8, 0x00, 0x47, 0xc0, 0xfa, 0x00, 0x03, 0x0f, 0xf0, 0x00, 0x0f, 0xde, 0xff, 0x03, 0xf8, 0x00, 0x43, 0xe0, 0xfa,
+  0x00, 0x03, 0x1f, 0xe0, 0x00, 0x1f, 0xde, 0xff, 0x03, 0xfc, 0x00, 0x07, 0x20, 0xfa, 0x00, 0x03, 0x0f, 0xc0, 0x00,
+  0x1f, 0xde, 0xff, 0x03, 0xfc, 0x00, 0x07, 0xc0, 0xfa, 0x00, 0x03, 0x07, 0xe0, 0x00, 0x1f, 0xde, 0xff, 0x04, 0xfc,
+  0x00, 0x43, 0xc0, 0xe0, 0xfb, 0x00, 0x03, 0x1f, 0xc0, 0x00, 0x3f, 0xde, 0xff, 0x04, 0xfe, 0x00, 0x03, 0xa0, 0x70,
+  0xfb, 0x00, 0x03, 0x1d, 0x80, 0x00, 0x3f, 0xde, 0xff, 0x07, 0xfe, 0x00, 0x01, 0xc0, 0xf4, 0x00, 0x00, 0x86, 0xfe,
+  0x00, 0x03, 0x9f, 0x80, 0x00, 0x7f, 0xde, 0xff, 0x0e, 0xfe, 0x00, 0x00, 0x70, 0xf9, 0x00, 0x00, 0x3c, 0x00, 0x00,
+  0x0f, 0xce, 0x00, 0x00, 0x7f, 0xdd, 0xff, 0xff, 0x00, 0x0a, 0x70, 0x7d, 0xc0, 0x00, 0x28, 0x00, 0x00, 0x1c, 0xbb,
+  0x00, 0x00, 0xdc, 0xff, 0xff, 0x00, 0x0a, 0x2e, 0xfe, 0x60, 0x00, 0x68, 0x00, 0x00, 0x1f, 0x7f, 0x00, 0x00, 0xdc,
+  0xff, 0xff, 0x00, 0x0a, 0x3f, 0xfe, 0x7a, 0x40, 0x40, 0x00, 0x00, 0xe5, 0xee, 0x00, 0x01, 0xdc, 0xff, 0xff, 0x00,
+  0x0a, 0x3f, 0xfd, 0x3f, 0xd2, 0xc8, 0x00, 0x00, 0xbf, 0xfe, 0x00, 0x03, 0xdd, 0xff, 0x0d, 0xfe, 0x00, 0x00, 0x1f,
+  0xff, 0x08, 0xff, 0xf8, 0x00, 0x00, 0xfd, 0xbe, 0x00, 0x03, 0xdd, 0xff, 0x0d, 0xf8, 0x00, 0x00, 0x1f, 0xf7, 0x98,
+  0x9e, 0x80, 0x04, 0x05, 0xff, 0xfc, 0x00, 0x03, 0xdd, 0xff, 0x0d, 0xf0, 0x00, 0x00, 0x0f, 0xff, 0x53, 0x20, 0x90,
+  0x04, 0x0b, 0xff, 0xf8, 0x00, 0x01, 0xdd, 0xff, 0x0d, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0xf1, 0xa3, 0x80, 0x10, 0xff,
+  0xff, 0xfc, 0x00, 0x00, 0xdd, 0xff, 0x0e, 0x80, 0x00, 0x00, 0x17, 0xfd, 0xb3, 0x7b, 0x87, 0xe1, 0xab, 0xff, 0xfc,
+  0x00, 0x00, 0x3f, 0xde, 0xff, 0xfe, 0x00, 0x0b, 0x0f, 0xfb, 0xff, 0x7e, 0x1e, 0xc5, 0x5f, 0xff, 0xf8, 0x00, 0x00,
+  0x1f, 0xdf, 0xff, 0x00, 0xfe, 0xfe, 0x00, 0x0b, 0x0f, 0xff, 0xb5, 0xb7, 0x83, 0xef, 0xff, 0xef, 0xe8, 0x00, 0x00,
+  0x0f, 0xdf, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x0b, 0x0f, 0xff, 0xfc, 0x8f, 0xf3, 0xfe, 0xf7, 0xef, 0xf0, 0x00, 0x00,
+  0x07, 0xdf, 0xff, 0x00, 0xf8, 0xfe, 0x00, 0x00, 0x0f, 0xfb, 0xff, 0x04, 0x7f, 0xb8, 0x00, 0x00, 0x03, 0xdf, 0xff,
+  0x08, 0xe0, 0x00, 0x10, 0x00, 0x07, 0xbf, 0xff, 0xff, 0xfb, 0xfe, 0xff, 0x03, 0xa8, 0x00, 0x00, 0x01, 0xdf, 0xff,
+  0x04, 0xc0, 0x00, 0x30, 0x00, 0x06, 0xfb, 0xff, 0x04, 0xf3, 0xe0, 0x00, 0x10, 0x00, 0xdf, 0xff, 0x06, 0x80, 0x00,
+  0x38, 0x00, 0x02, 0xff, 0x7f, 0xfc, 0xff, 0x04, 0xc0, 0x00, 0x10, 0x00, 0x7f, 0xe0, 0xff, 0xff, 0x00, 0x02, 0x38,
+  0x00, 0x03, 0xfb, 0xff, 0x05, 0xe3, 0x80, 0x00, 0x38, 0x00, 0x7f, 0xe1, 0xff, 0x08, 0xfe, 0x00, 0x00, 0x78, 0x00,
+  0x03, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0x05, 0xfc, 0x00, 0x00, 0x38, 0x00, 0x3f, 0xe1, 0xff, 0x07, 0xfc, 0x00, 0x00,
+  0x78, 0x00, 0x01, 0xff, 0xfe, 0xfd, 0xff, 0x05, 0xe8, 0x00, 0x00, 0x38, 0x00, 0x1f, 0xe1, 0xff, 0x05, 0xf0, 0x00,
+  0x00, 0xfc, 0x00, 0x01, 0xfb, 0xff, 0x05, 0xf0, 0x00, 0x00, 0x78, 0x00, 0x0f, 0xe1, 0xff, 0x05, 0xe0, 0x00, 0x03,
+  0xfc, 0x02, 0x00, 0xfb, 0xff, 0x05, 0xe0, 0x00, 0x00, 0x7c, 0x00, 0x07, 0xe1, 0xff, 0xff, 0x00, 0x04, 0x07, 0xfc,
+  0x00, 0x00, 0x7f, 0xfc, 0xff, 0x05, 0xe0, 0x00, 0x00, 0xfc, 0x00, 0x07, 0xe2, 0xff, 0x07, 0xfc, 0x00, 0x00, 0x1f,
+  0xfe, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0x05, 0xf0, 0x00, 0x00, 0xfc, 0x00, 0x03, 0xe2, 0xff, 0x07, 0xf0, 0x00, 0x00,
+  0x3f, 0xfe, 0x00, 0x00, 0x5f, 0xfc, 0xff, 0x05, 0xa0, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xe2, 0xff, 0x07, 0xc0, 0x00,
+  0x00, 0x7f, 0xff, 0x00, 0x00, 0x1f, 0xfc, 0xff, 0x05, 0x80, 0x00, 0x01, 0xfe, 0x00, 0x00, 0xe2, 0xff, 0x07, 0x80,
+  0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x07, 0xfc, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x7f, 0xe4,
+  0xff, 0x00, 0xfe, 0xfe, 0x00, 0xff, 0xff, 0x02, 0x80, 0x00, 0x0f, 0xfd, 0xff, 0x07, 0xfc, 0x00, 0x00, 0x07, 0xfe,
+  0x00, 0x00, 0x3f, 0xe4, 0xff, 0x00, 0xfc, 0xfe, 0x00, 0xff, 0xff, 0x02, 0xc0, 0x00, 0x03, 0xfd, 0xff, 0x07, 0xe4,
+  0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x1f, 0xe4, 0xff, 0x08, 0xf8, 0x00, 0x00, 0x01, 0xff, 0xff, 0xc0, 0x00, 0x03,
+  0xfd, 0xff, 0x07, 0xd0, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x0f, 0xe4, 0xff, 0x14, 0xe0, 0x00, 0x00, 0x03, 0xff,
+  0xff, 0xe0, 0x00, 0x00, 0x7f, 0xfb, 0xff, 0xff, 0xd0, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x07, 0xe4, 0xff, 0x09,
+  0xc0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x9f, 0xfe, 0xff, 0x07, 0x80, 0x00, 0x00, 0x3f, 0xff, 0x30,
+  0x00, 0x01, 0xe4, 0xff, 0x0c, 0x80, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xfb, 0x7f, 0xff, 0xfe,
+  0x00, 0x04, 0x3f, 0xff, 0x38, 0x00, 0x00, 0xe5, 0xff, 0x00, 0xfe, 0xfe, 0x00, 0x09, 0x0f, 0xff, 0xff, 0xfc, 0x00,
+  0x00, 0x03, 0x6e, 0xff, 0x90, 0xfe, 0x00, 0x05, 0x7f, 0xff, 0x1c, 0x00, 0x00, 0x3f, 0xe6, 0xff, 0x00, 0xf8, 0xfe,
+  0x00, 0x03, 0x1f, 0xff, 0xff, 0xfc, 0xfe, 0x00, 0x02, 0x01, 0xfe, 0xc0, 0xfe, 0x00, 0xff, 0xff, 0x03, 0x1e, 0x00,
+  0x00, 0x0f, 0xe6, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xfe, 0x00, 0x0b, 0x48, 0x7f, 0x80, 0x00,
+  0x00, 0x01, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x07, 0xe6, 0xff, 0xfd, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0xfe, 0x00, 0x00,
+  0x08, 0xfd, 0x00, 0x06, 0x03, 0xff, 0xff, 0x9f, 0x80, 0x00, 0x03, 0xe7, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x1f,
+  0xfe, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xfd, 0x00, 0x06, 0x07, 0xff, 0xff, 0x9f, 0x80, 0x00, 0x01, 0xe7, 0xff,
+  0x00, 0xf0, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0xe0, 0xfa, 0x00, 0x06, 0x0f, 0xff, 0xff, 0x9f, 0x80, 0x00,
+  0x00, 0xe7, 0xff, 0x00, 0xc0, 0xfd, 0x00, 0x00, 0x3f, 0xfe, 0xff, 0x00, 0xf8, 0xfa, 0x00, 0x07, 0x1f, 0xff, 0xff,
+  0xdf, 0xc0, 0x00, 0x00, 0x7f, 0xe9, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xfe, 0xff, 0x01, 0xfc, 0x80, 0xfb,
+  0x00, 0x00, 0x7f, 0xfe, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x1f, 0xe9, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x00, 0x7f, 0xfe,
+  0xff, 0x00, 0xfd, 0xfa, 0x00, 0xfd, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x0f, 0xe9, 0xff, 0x00, 0xc0, 0xfc, 0x00, 0xfd,
+  0xff, 0x00, 0xfe, 0xfb, 0x00, 0x00, 0x01, 0xfd, 0xff, 0x03, 0xc0, 0x00, 0x00, 0x03, 0xe9, 0xff, 0x00, 0x80, 0xfc,
+  0x00, 0xfc, 0xff, 0xfb, 0x00, 0x00, 0x03, 0xfd, 0xff, 0x00, 0xc0, 0xfe, 0x00, 0xe9, 0xff, 0xfb, 0x00, 0xfc, 0xff,
+  0x00, 0xc0, 0xfc, 0x00, 0x00, 0x0f, 0xfd, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x3f, 0xea, 0xff, 0xfc, 0x00, 0x00,
+  0x01, 0xfc, 0xff, 0x00, 0xe0, 0xfc, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00, 0x1f, 0xea, 0xff,
+  0xfc, 0x00, 0x00, 0x01, 0xfc, 0xff, 0x00, 0xf0, 0xfc, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0x00, 0xe0, 0xfe, 0x00, 0x00,
+  0x07, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x01, 0xfc, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0xfc, 0xff, 0x00, 0xf0, 0xfe, 0x00,
+  0x00, 0x01, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xfc, 0xff, 0x01, 0xfc, 0x08, 0xfe, 0x00, 0x00, 0x01, 0xfc, 0xff,
+  0x00, 0xf0, 0xfd, 0x00, 0xea, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xfb, 0xff, 0x00, 0x80, 0xfe, 0x00, 0x00, 0x07, 0xfc,
+  0xff, 0x00, 0xf8, 0xfd, 0x00, 0x00, 0x3f, 0xeb, 0xff, 0xfd, 0x00, 0x01, 0x02, 0x03, 0xfb, 0xff, 0x00, 0xc0, 0xfe,
+  0x00, 0x00, 0x0f, 0xfc, 0xff, 0x00, 0xf8, 0xfd, 0x00, 0x00, 0x0f, 0xeb, 0xff, 0xfc, 0x00, 0x00, 0x43, 0xfa, 0xff,
+  0xfe, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x07, 0xeb, 0xff, 0x01, 0x00, 0x20, 0xfe, 0x00,
+  0x00, 0x03, 0xfa, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xfc, 0xff, 0x00, 0xfc, 0xfd, 0x00, 0x00, 0x01, 0xeb, 0xff, 0xfc,
+  0x00, 0x00, 0x07, 0xfb, 0xff, 0x03, 0xfe, 0xc0, 0x00, 0x01, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec,
+  0xff, 0xfc, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x02, 0xc0, 0x00, 0x03, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f,
+  0xec, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x02, 0xe0, 0x00, 0x0f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00,
+  0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xf8, 0x00, 0x1f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00,
+  0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xfe, 0x00, 0x7f, 0xfb, 0xff, 0x00, 0xfc, 0xfc,
+  0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xf9, 0xff, 0x00, 0x8f, 0xfa, 0xff, 0x00, 0xfc, 0xfc, 0x00,
+  0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xf1, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc,
+  0x00, 0x00, 0x0f, 0xf1, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xf1, 0xff,
+  0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xf9, 0xff, 0x01, 0xf8, 0x7f, 0xfb, 0xff,
+  0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xf9, 0xff, 0x01, 0xc0, 0x7f, 0xfb, 0xff,
+  0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x8f, 0xf9, 0xff, 0x01, 0x80, 0x3f, 0xfb, 0xff,
+  0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xf9, 0xff, 0x01, 0x10, 0x1f, 0xfa, 0xff,
+  0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xfa, 0xff, 0xfc,
+  0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xe0, 0x00, 0x0f, 0xfb, 0xff, 0x00, 0xfe,
+  0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xc0, 0x00, 0x07, 0xfa, 0xff, 0xfc,
+  0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xc0, 0x00, 0x03, 0xfa, 0xff, 0xfc, 0x00,
+  0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xfa, 0xff, 0x02, 0x80, 0x00, 0x03, 0xfa, 0xff, 0xfc, 0x00, 0x00,
+  0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xfa, 0xff, 0x02, 0x80, 0x00, 0x01, 0xfb, 0xff, 0x00, 0xfe, 0xfc, 0x00,
+  0x00, 0x7f, 0xec, 0xff, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x01, 0xfa, 0xff, 0x00,
+  0x08, 0xfd, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfd, 0x00, 0x01, 0x02, 0x4f, 0xfa, 0xff, 0xfe, 0x00, 0xfa, 0xff, 0x00,
+  0x80, 0xfd, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfd, 0x00, 0x01, 0x10, 0x1f, 0xfa, 0xff, 0x02, 0x00, 0x02, 0x00, 0xfb,
+  0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x03, 0xc0, 0x00, 0x00,
+  0x7f, 0xfc, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x03, 0xe0,
+  0x00, 0x01, 0x7f, 0xfc, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xfa, 0xff,
+  0x03, 0xe0, 0x00, 0x01, 0x7f, 0xfc, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f,
+  0xfa, 0xff, 0x02, 0xe0, 0x00, 0x01, 0xfb, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfd, 0x00, 0x01,
+  0x82, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x03, 0xfb, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc,
+  0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x03, 0xfb, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff,
+  0xfc, 0x00, 0x00, 0xaf, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x07, 0xfb, 0xff, 0x00, 0xfe, 0xfc, 0x00, 0x00, 0x7f, 0xec,
+  0xff, 0xfe, 0x00, 0x02, 0x40, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x07, 0xfb, 0xff, 0x01, 0xfe, 0xa0, 0xfd,
+  0x00, 0x00, 0x7f, 0xec, 0xff, 0xfe, 0x00, 0x02, 0x08, 0x50, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xfb, 0xff,
+  0x01, 0xfc, 0x10, 0xfd, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfd, 0x00, 0x01, 0x10, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x00,
+  0x0f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0x05, 0x00, 0x04, 0x00, 0x00, 0x80, 0x0f, 0xfa,
+  0xff, 0x02, 0xf0, 0x00, 0x0f, 0xfb, 0xff, 0x01, 0xfe, 0x08, 0xfd, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfd, 0x00, 0x01,
+  0x80, 0x1f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x0f, 0xfb, 0xff, 0x02, 0xfe, 0x0c, 0x80, 0xfe, 0x00, 0x00, 0x7f, 0xec,
+  0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x01, 0x9f, 0xfb, 0xff, 0x01, 0xfc, 0x20, 0xfd, 0x00, 0x00,
+  0x7f, 0xec, 0xff, 0xfd, 0x00, 0x01, 0x02, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x1f, 0xfb, 0xff, 0x01, 0xfc, 0x80,
+  0xfd, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfe, 0x00, 0x02, 0x20, 0x01, 0x1f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x1f, 0xfb,
+  0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xf8, 0x00, 0x1f,
+  0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0x00, 0x20, 0xfd, 0x00, 0x00, 0x4f, 0xfa, 0xff, 0x02,
+  0xf8, 0x00, 0x3f, 0xfa, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfe, 0x00, 0x02, 0x10, 0x00, 0x0f, 0xfa, 0xff,
+  0x02, 0xf0, 0x00, 0x3f, 0xfb, 0xff, 0x01, 0xfd, 0x20, 0xfd, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xff, 0x00, 0x03, 0x40,
+  0x00, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x7f, 0xfb, 0xff, 0x01, 0xfe, 0x20, 0xfd, 0x00, 0x00, 0x7f, 0xec,
+  0xff, 0xfe, 0x00, 0x02, 0x01, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xf0, 0x00, 0x3f, 0xfb, 0xff, 0x01, 0xfc, 0x80, 0xfd,
+  0x00, 0x00, 0x7f, 0xec, 0xff, 0xfd, 0x00, 0x01, 0x02, 0x2f, 0xfa, 0xff, 0x02, 0xe0, 0x00, 0x3f, 0xfb, 0xff, 0x01,
+  0xfc, 0x80, 0xfd, 0x00, 0x00, 0x7f, 0xec, 0xff, 0x05, 0x00, 0x10, 0x00, 0x08, 0x00, 0x0f, 0xfa, 0xff, 0x02, 0xc0,
+  0x00, 0x3f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfd, 0x00, 0x01, 0x80, 0x0f, 0xfa, 0xff,
+  0x02, 0xc0, 0x00, 0x3f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa,
+  0xff, 0x02, 0x80, 0x00, 0x3f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfc, 0x00, 0x00, 0x07,
+  0xfa, 0xff, 0x02, 0x80, 0x00, 0x3f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0x01, 0x00, 0x08,
+  0xfe, 0x00, 0x00, 0x07, 0xfa, 0xff, 0x02, 0x80, 0x00, 0x3f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f, 0xec,
+  0xff, 0xfc, 0x00, 0x00, 0x0f, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x7f,
+  0xec, 0xff, 0xfd, 0x00, 0x01, 0x01, 0x0f, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xfb, 0xff, 0x00, 0xfc, 0xfc, 0x00,
+  0x00, 0x7f, 0xec, 0xff, 0x01, 0x00, 0x04, 0xfe, 0x00, 0x00, 0x07, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xfb, 0xff,
+  0x00, 0xf8, 0xfc, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfe, 0x00, 0x02, 0x02, 0x00, 0x07, 0xfb, 0xff, 0x03, 0xfe, 0x00,
+  0x00, 0x1f, 0xfb, 0xff, 0x01, 0xf8, 0x04, 0xfd, 0x00, 0x00, 0x7f, 0xec, 0xff, 0xfd, 0x00, 0x01, 0x26, 0x07, 0xfb,
+  0xff, 0x03, 0xfe, 0x00, 0x00, 0x1f, 0xfb, 0xff, 0x00, 0xf8, 0xfc, 0x00, 0x00, 0x7f, 0xf7, 0xff
 };
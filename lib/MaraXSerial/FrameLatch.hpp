@@ -0,0 +1,56 @@
+#pragma once
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * @brief Hands the latest complete value from a writer to a reader without tearing.
+ *
+ * The writer always fills the slot, which is currently not published, and then swaps the published index. The reader
+ * copies the published slot and retries, if a new value was published meanwhile. Each publish increments a sequence
+ * number, so the reader can skip its work when nothing new has arrived.
+ *
+ * @tparam T The value type. Has to be trivially copyable.
+ */
+template <typename T>
+class FrameLatch {
+ public:
+  FrameLatch() : slots{}, publishedSlot{ 0 }, sequence{ 0 } {}
+
+  /**
+   * @brief Makes value the latest one. Must only be called from one context.
+   */
+  void publish(const T &value) {
+    const uint8_t writeSlot = 1 - publishedSlot.load(std::memory_order_relaxed);
+    slots[writeSlot] = value;
+    publishedSlot.store(writeSlot, std::memory_order_release);
+    sequence.store(sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief The number of values published so far.
+   */
+  uint32_t getSequence() const { return sequence.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Copies the latest published value.
+   *
+   * @param value Receives the value. Untouched, if nothing has been published yet.
+   * @return The sequence number of the copied value. 0, if nothing has been published yet.
+   */
+  uint32_t read(T &value) const {
+    uint32_t sequenceBefore;
+    do {
+      sequenceBefore = sequence.load(std::memory_order_acquire);
+      if (sequenceBefore == 0) {
+        return 0;
+      }
+      value = slots[publishedSlot.load(std::memory_order_acquire)];
+    } while (sequenceBefore != sequence.load(std::memory_order_acquire));
+    return sequenceBefore;
+  }
+
+ private:
+  T slots[2];
+  std::atomic<uint8_t> publishedSlot;
+  std::atomic<uint32_t> sequence;
+};
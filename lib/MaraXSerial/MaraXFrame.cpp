@@ -0,0 +1,84 @@
+#include <MaraXFrame.hpp>
+
+namespace {
+constexpr uint8_t maxTemp = 200;
+constexpr uint16_t maxBoostCountdown = 9999;
+/// More digits than this can not be valid for any field. It also keeps the accumulator from overflowing.
+constexpr uint8_t maxDigits = 5;
+
+/**
+ * @brief Reads the unsigned number starting at position and advances position behind it.
+ *
+ * @return False, if there are no digits or too many of them.
+ */
+bool parseNumber(const char *frame, size_t length, size_t &position, uint32_t &value) {
+  value = 0;
+  const size_t start = position;
+  while (position < length && frame[position] >= '0' && frame[position] <= '9') {
+    if (position - start >= maxDigits) {
+      return false;
+    }
+    value = value * 10 + static_cast<uint32_t>(frame[position] - '0');
+    position++;
+  }
+  return position != start;
+}
+}  // namespace
+
+MaraXDecodeResult decodeMaraXFrame(const char *frame, size_t length, MaraXFrame &decoded) {
+  if (length == 0 || (frame[0] != 'C' && frame[0] != 'V')) {
+    return MaraXDecodeResult::InvalidMode;
+  }
+  decoded.mode = frame[0];
+
+  size_t position = 1;
+  uint32_t major = 0;
+  uint32_t minor = 0;
+  if (!parseNumber(frame, length, position, major) || position >= length || frame[position++] != '.' ||
+      !parseNumber(frame, length, position, minor) || major > UINT8_MAX || minor > UINT8_MAX) {
+    return MaraXDecodeResult::InvalidVersion;
+  }
+  decoded.firmwareMajor = major;
+  decoded.firmwareMinor = minor;
+
+  constexpr uint8_t nrNumberFields = 6;
+  constexpr uint32_t maxValues[nrNumberFields] = { maxTemp, maxTemp, maxTemp, maxBoostCountdown, 1, 1 };
+  uint32_t values[nrNumberFields];
+  for (uint8_t i = 0; i < nrNumberFields; ++i) {
+    if (position >= length) {
+      return MaraXDecodeResult::WrongFieldCount;
+    }
+    if (frame[position++] != ',') {
+      return MaraXDecodeResult::InvalidNumber;
+    }
+    if (!parseNumber(frame, length, position, values[i])) {
+      return MaraXDecodeResult::InvalidNumber;
+    }
+    if (values[i] > maxValues[i]) {
+      return MaraXDecodeResult::OutOfRange;
+    }
+  }
+  if (position != length) {
+    return frame[position] == ',' ? MaraXDecodeResult::WrongFieldCount : MaraXDecodeResult::InvalidNumber;
+  }
+
+  decoded.steamTemp = values[0];
+  decoded.targetSteamTemp = values[1];
+  decoded.hxTemp = values[2];
+  decoded.boostCountdown = values[3];
+  decoded.heatingOn = values[4] != 0;
+  decoded.pumpOn = values[5] != 0;
+  return MaraXDecodeResult::Ok;
+}
+
+const char *toString(MaraXDecodeResult result) {
+  switch (result) {
+    case MaraXDecodeResult::Ok: return "Ok";
+    case MaraXDecodeResult::InvalidMode: return "InvalidMode";
+    case MaraXDecodeResult::InvalidVersion: return "InvalidVersion";
+    case MaraXDecodeResult::InvalidNumber: return "InvalidNumber";
+    case MaraXDecodeResult::OutOfRange: return "OutOfRange";
+    case MaraXDecodeResult::WrongFieldCount: return "WrongFieldCount";
+  }
+  return "Unknown";
+}
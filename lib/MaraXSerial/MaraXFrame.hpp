@@ -0,0 +1,49 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief All values sent by the mara x within one frame.
+ *
+ * Example frame: "C1.19,116,124,093,0840,1,0"
+ */
+struct MaraXFrame {
+  /// 'C' for coffee priority, 'V' for steam priority.
+  char mode;
+  uint8_t firmwareMajor;
+  uint8_t firmwareMinor;
+  /// Steam temp in C.
+  uint8_t steamTemp;
+  /// Target steam temp in C.
+  uint8_t targetSteamTemp;
+  /// HX (heat exchanger) temp in C.
+  uint8_t hxTemp;
+  /// Remaining time of the boost (fast heat up) in s. 0, if not active.
+  uint16_t boostCountdown;
+  bool heatingOn;
+  bool pumpOn;
+};
+
+enum class MaraXDecodeResult : uint8_t {
+  Ok,
+  InvalidMode,
+  InvalidVersion,
+  InvalidNumber,
+  OutOfRange,
+  WrongFieldCount,
+};
+
+/**
+ * @brief Decodes a frame in a single pass without modifying or copying it.
+ *
+ * @param frame The chars of the frame, without the terminating '\n'. Does not have to be null terminated.
+ * @param length The number of chars in frame.
+ * @param decoded Receives the values. Only valid, if MaraXDecodeResult::Ok is returned.
+ * @return MaraXDecodeResult::Ok or the reason, why the frame was rejected.
+ */
+MaraXDecodeResult decodeMaraXFrame(const char *frame, size_t length, MaraXFrame &decoded);
+
+/**
+ * @brief Human readable name of the result, e.g. for logging.
+ */
+const char *toString(MaraXDecodeResult result);
@@ -0,0 +1,82 @@
+#include <MaraXFramer.hpp>
+
+namespace {
+bool isFrameStart(char receivedChar) { return receivedChar == 'C' || receivedChar == 'V'; }
+bool isFrameChar(char receivedChar) { return receivedChar >= ' ' && receivedChar <= '~'; }
+}  // namespace
+
+MaraXFramer::MaraXFramer()
+    : state{ State::WaitingForStart },
+      frame{},
+      frameLength{ 0 },
+      completedFrameCount{ 0 },
+      truncatedFrameCount{ 0 },
+      discardedCharCount{ 0 } {}
+
+bool MaraXFramer::push(char receivedChar) {
+  switch (state) {
+    case State::WaitingForStart:
+      if (isFrameStart(receivedChar)) {
+        startFrame(receivedChar);
+      } else if (receivedChar != '\n' && receivedChar != '\r') {
+        discardedCharCount++;
+      }
+      break;
+    case State::InFrame:
+      if (receivedChar == '\n') {
+        state = State::WaitingForStart;
+        frame[frameLength] = '\0';
+        if (frameLength < minFrameLength) {
+          truncatedFrameCount++;
+          return false;
+        }
+        completedFrameCount++;
+        return true;
+      } else if (receivedChar == '\r') {
+        // The mara x ends its frames with "\r\n". The frame is complete with the '\n', so the '\r' is skipped instead
+        // of being taken as garbage.
+      } else if (isFrameStart(receivedChar)) {
+        // The mode letter only occurs at the start, so the end of this frame was lost. Keep the next one.
+        truncatedFrameCount++;
+        discardedCharCount += frameLength;
+        startFrame(receivedChar);
+      } else if (!isFrameChar(receivedChar)) {
+        // Garbage within the frame. Drop it and look for the next start.
+        truncatedFrameCount++;
+        discardedCharCount += frameLength + 1;
+        state = State::WaitingForStart;
+      } else if (frameLength >= maxFrameLength) {
+        truncatedFrameCount++;
+        state = State::SkippingToEnd;
+      } else {
+        frame[frameLength++] = receivedChar;
+      }
+      break;
+    case State::SkippingToEnd:
+      if (receivedChar == '\n') {
+        state = State::WaitingForStart;
+      } else if (isFrameStart(receivedChar)) {
+        startFrame(receivedChar);
+      } else {
+        discardedCharCount++;
+      }
+      break;
+  }
+  return false;
+}
+
+void MaraXFramer::startFrame(char receivedChar) {
+  frame[0] = receivedChar;
+  frameLength = 1;
+  state = State::InFrame;
+}
+
+const char *MaraXFramer::getFrame() const { return frame; }
+
+size_t MaraXFramer::getFrameLength() const { return frameLength; }
+
+uint32_t MaraXFramer::getCompletedFrameCount() const { return completedFrameCount; }
+
+uint32_t MaraXFramer::getTruncatedFrameCount() const { return truncatedFrameCount; }
+
+uint32_t MaraXFramer::getDiscardedCharCount() const { return discardedCharCount; }
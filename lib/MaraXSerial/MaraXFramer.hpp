@@ -0,0 +1,68 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Assembles the chars received from the mara x into complete frames.
+ *
+ * A frame looks like "C1.19,116,124,093,0840,1,0" and is terminated by '\n'. The framer keeps its state between calls,
+ * so a frame may arrive in any number of chunks. Frames, which are too short or too long, are dropped. After garbage
+ * the framer resynchronizes on the next mode letter ('C' or 'V'). As it only occurs at the start of a frame, a mode
+ * letter within a frame starts a new one, so a lost '\n' only costs the frame before it.
+ */
+class MaraXFramer {
+ public:
+  /// The longest frame (without terminator), which is accepted.
+  static constexpr size_t maxFrameLength = 31;
+  /// The shortest frame, which is accepted. Shorter frames have lost chars.
+  static constexpr size_t minFrameLength = 20;
+
+  MaraXFramer();
+
+  /**
+   * @brief Adds the next received char.
+   *
+   * @param receivedChar The char received from the mara x.
+   * @return True, if a complete frame is available via getFrame(). It stays valid until the next call.
+   */
+  bool push(char receivedChar);
+
+  /**
+   * @brief The last completed, null terminated frame.
+   */
+  const char *getFrame() const;
+
+  size_t getFrameLength() const;
+
+  uint32_t getCompletedFrameCount() const;
+
+  /**
+   * @brief Number of frames dropped, as they were shorter than minFrameLength, longer than maxFrameLength, contained
+   * garbage or their end was lost.
+   */
+  uint32_t getTruncatedFrameCount() const;
+
+  /**
+   * @brief Number of chars skipped while searching for the start of the next frame.
+   */
+  uint32_t getDiscardedCharCount() const;
+
+ private:
+  enum class State {
+    WaitingForStart,
+    InFrame,
+    SkippingToEnd,  // Frame too long. Waiting for its end or the next start to resynchronize.
+  };
+
+  /**
+   * @brief Starts a new frame with its mode letter. Whatever was collected before is dropped.
+   */
+  void startFrame(char receivedChar);
+
+  State state;
+  char frame[maxFrameLength + 1];
+  size_t frameLength;
+  uint32_t completedFrameCount;
+  uint32_t truncatedFrameCount;
+  uint32_t discardedCharCount;
+};
@@ -0,0 +1,29 @@
+#include <MaraXSerialIngest.hpp>
+
+constexpr uint32_t maraXBaudRate = 9600;
+/// Receive buffer of the software serial. Has to cover the time between two ticker calls (~1 byte/ms at 9600 baud).
+constexpr int serialBufferSize = 128;
+constexpr uint32_t drainIntervalInMs = 10;
+
+MaraXSerialIngest::MaraXSerialIngest(uint8_t rxPin, uint8_t txPin)
+    : rxPin{ rxPin }, txPin{ txPin }, maraXSerial(rxPin, txPin), serialOverflowCount{ 0 } {}
+
+void MaraXSerialIngest::begin() {
+  maraXSerial.begin(maraXBaudRate, SWSERIAL_8N1, rxPin, txPin, false, serialBufferSize);
+  drainTicker.attach_ms(drainIntervalInMs, drainSerial, this);
+}
+
+bool MaraXSerialIngest::read(char &receivedChar) { return receivedChars.pop(receivedChar); }
+
+uint32_t MaraXSerialIngest::getRingBufferOverflowCount() const { return receivedChars.getOverflowCount(); }
+
+uint32_t MaraXSerialIngest::getSerialOverflowCount() const { return serialOverflowCount; }
+
+void MaraXSerialIngest::drainSerial(MaraXSerialIngest *ingest) {
+  if (ingest->maraXSerial.overflow()) {
+    ingest->serialOverflowCount = ingest->serialOverflowCount + 1;
+  }
+  while (ingest->maraXSerial.available()) {
+    ingest->receivedChars.push(static_cast<char>(ingest->maraXSerial.read()));
+  }
+}
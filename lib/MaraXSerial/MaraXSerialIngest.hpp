@@ -0,0 +1,59 @@
+#pragma once
+#include <RingBuffer.hpp>
+#include <SoftwareSerial.h>
+#include <Ticker.h>
+
+/**
+ * @brief Captures the bytes sent by the mara x independently of how busy loop() is.
+ *
+ * The software serial receives the bits within its pin interrupt. A ticker moves the received bytes into a lock-free
+ * ring buffer. The ticker callback runs in the system context, which also happens whenever loop() yields, e.g. in the
+ * delay() calls while the e-ink display waits for its BUSY pin. Hence, bytes are not lost while the display refreshes.
+ *
+ * NOTE: The hardware UART can not be used via Serial.swap(), as the swapped pins (D7/D8) are used by the SPI of the
+ * e-ink display.
+ */
+class MaraXSerialIngest {
+ public:
+  /**
+   * @param rxPin The pin connected to the TX of the mara x.
+   * @param txPin The pin connected to the RX of the mara x.
+   */
+  MaraXSerialIngest(uint8_t rxPin, uint8_t txPin);
+
+  /**
+   * @brief Opens up the serial communication to the mara x and starts moving bytes into the ring buffer.
+   */
+  void begin();
+
+  /**
+   * @brief Takes the oldest received byte. Must only be called from loop().
+   *
+   * @return False, if no byte is available.
+   */
+  bool read(char &receivedChar);
+
+  /**
+   * @brief Number of bytes dropped, because loop() did not consume the ring buffer in time.
+   */
+  uint32_t getRingBufferOverflowCount() const;
+
+  /**
+   * @brief Number of times the software serial itself reported an overflow of its receive buffer.
+   */
+  uint32_t getSerialOverflowCount() const;
+
+ private:
+  /**
+   * @brief Moves all bytes from the software serial into the ring buffer. Called by the ticker.
+   */
+  static void drainSerial(MaraXSerialIngest *ingest);
+
+  const uint8_t rxPin;
+  const uint8_t txPin;
+  SoftwareSerial maraXSerial;
+  Ticker drainTicker;
+  /// The mara x sends a frame of ~26 chars about every 400 ms. This covers several seconds without consumption.
+  RingBuffer<char, 512> receivedChars;
+  volatile uint32_t serialOverflowCount;
+};
@@ -0,0 +1,78 @@
+#pragma once
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Fixed-size lock-free single producer / single consumer ring buffer.
+ *
+ * Exactly one context may call push() (e.g. a timer callback or an interrupt) and exactly one other context may call
+ * pop() (e.g. loop()). One slot is kept free to distinguish a full from an empty buffer, so at most Capacity - 1
+ * elements can be stored.
+ *
+ * @tparam T The element type. Has to be trivially copyable.
+ * @tparam Capacity The number of slots. Has to be a power of two.
+ */
+template <typename T, size_t Capacity>
+class RingBuffer {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity has to be a power of two");
+
+ public:
+  RingBuffer() : head{ 0 }, tail{ 0 }, overflowCount{ 0 } {}
+
+  /**
+   * @brief Stores a value. Must only be called from the producer context.
+   *
+   * Always inlined, so that it ends up in IRAM, when it is called from an interrupt handler.
+   *
+   * @return False, if the buffer was full. The value is dropped and the overflow counter is incremented.
+   */
+  __attribute__((always_inline)) bool push(const T &value) {
+    const size_t currentHead = head.load(std::memory_order_relaxed);
+    const size_t nextHead = (currentHead + 1) & mask;
+    if (nextHead == tail.load(std::memory_order_acquire)) {
+      overflowCount.store(overflowCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return false;
+    }
+    buffer[currentHead] = value;
+    head.store(nextHead, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Takes the oldest value. Must only be called from the consumer context.
+   *
+   * @return False, if the buffer was empty.
+   */
+  bool pop(T &value) {
+    const size_t currentTail = tail.load(std::memory_order_relaxed);
+    if (currentTail == head.load(std::memory_order_acquire)) {
+      return false;
+    }
+    value = buffer[currentTail];
+    tail.store((currentTail + 1) & mask, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief The number of stored elements. Only a snapshot, if the other side is active at the same time.
+   */
+  size_t size() const {
+    return (head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire)) & mask;
+  }
+
+  bool isEmpty() const { return size() == 0; }
+
+  /**
+   * @brief How many values have been dropped, because the consumer did not keep up.
+   */
+  uint32_t getOverflowCount() const { return overflowCount.load(std::memory_order_relaxed); }
+
+ private:
+  static constexpr size_t mask = Capacity - 1;
+
+  T buffer[Capacity];
+  std::atomic<size_t> head;  // Written by the producer only.
+  std::atomic<size_t> tail;  // Written by the consumer only.
+  std::atomic<uint32_t> overflowCount;
+};
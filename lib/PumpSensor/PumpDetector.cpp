@@ -0,0 +1,72 @@
+#include <PumpDetector.hpp>
+
+/// The vibration pump runs at the mains frequency of 50 Hz. The period is measured, so 60 Hz works as well.
+constexpr uint32_t nominalPulsePeriodInUs = 20000;
+
+PumpDetector::PumpDetector()
+    : running{ false },
+      firstPulseTime{ 0 },
+      lastPulseTime{ 0 },
+      stopLatency{ 0 },
+      pulsePeriod{ nominalPulsePeriodInUs },
+      pulseCount{ 0 } {}
+
+PumpDetector::Event PumpDetector::addEdge(const ReedEdge &edge) {
+  if (edge.level == LOW) {
+    return addPulse(edge.timeInUs);
+  }
+  return update(edge.timeInUs);
+}
+
+PumpDetector::Event PumpDetector::update(uint32_t currentTimeInUs) {
+  // Negative for edges captured after currentTimeInUs was taken.
+  const int32_t timeSinceLastPulse = static_cast<int32_t>(currentTimeInUs - lastPulseTime);
+  if (!running || timeSinceLastPulse <= static_cast<int32_t>(missingPeriodsToStop * pulsePeriod)) {
+    return Event::None;
+  }
+  running = false;
+  stopLatency = timeSinceLastPulse;
+  pulseCount = 0;
+  return Event::Stopped;
+}
+
+bool PumpDetector::isRunning() const { return running; }
+
+uint32_t PumpDetector::getStartTime() const { return firstPulseTime; }
+
+uint32_t PumpDetector::getStopTime() const { return lastPulseTime; }
+
+uint32_t PumpDetector::getStopLatency() const { return stopLatency; }
+
+uint32_t PumpDetector::getPulsePeriod() const { return pulsePeriod; }
+
+uint32_t PumpDetector::getPulseCount() const { return pulseCount; }
+
+PumpDetector::Event PumpDetector::addPulse(uint32_t timeInUs) {
+  // A pulse after a long gap ends the last run, before it may start the next one.
+  const Event event = update(timeInUs);
+  if (pulseCount > 0) {
+    const uint32_t interval = timeInUs - lastPulseTime;
+    if (interval < minPulsePeriodInUs) {
+      return event;
+    }
+    if (interval > maxPulsePeriodInUs) {
+      if (!running) {
+        pulseCount = 0;
+      }
+    } else if (interval <= pulsePeriod * 3 / 2) {
+      // Intervals with a missed pulse in between do not count for the period.
+      pulsePeriod = pulsePeriod + (static_cast<int32_t>(interval) - static_cast<int32_t>(pulsePeriod)) / 4;
+    }
+  }
+  if (pulseCount == 0) {
+    firstPulseTime = timeInUs;
+  }
+  lastPulseTime = timeInUs;
+  ++pulseCount;
+  if (!running && pulseCount >= pulsesToStart) {
+    running = true;
+    return Event::Started;
+  }
+  return event;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <ReedCapture.hpp>
+
+/**
+ * @brief Detects start and stop of the vibration pump from the pulses of the reed sensor.
+ *
+ * The pump strokes once per period of the mains, which pulls the reed sensor LOW each time. The pump is running, once
+ * pulsesToStart pulses followed each other within maxPulsePeriodInUs. It is stopped, as soon as no pulse arrived for
+ * missingPeriodsToStop of the measured pulse periods, i.e. about 100 ms at 50 Hz. Start and stop are dated to the first
+ * and the last pulse, so the run time does not depend on how fast the stop was detected.
+ *
+ * All times are micros() time points. Only their differences are used, so the wrap around of micros() does no harm.
+ */
+class PumpDetector {
+ public:
+  enum class Event : uint8_t { None, Started, Stopped };
+
+  /// Pulses closer to the previous one are contact bounce.
+  static constexpr uint32_t minPulsePeriodInUs = 8000;
+  /// Pulses further apart do not belong to the same pulse train.
+  static constexpr uint32_t maxPulsePeriodInUs = 40000;
+  /// A single pulse may be a vibration of the machine. A pulse train is not.
+  static constexpr uint8_t pulsesToStart = 3;
+  /// A missed pulse now and then must not stop the pump.
+  static constexpr uint8_t missingPeriodsToStop = 5;
+
+  PumpDetector();
+
+  /**
+   * @brief Takes the next edge captured from the reed sensor.
+   *
+   * @return The event caused by the edge. A stop is also reported, if the edge comes too late for the pulse train.
+   */
+  Event addEdge(const ReedEdge &edge);
+
+  /**
+   * @brief Checks whether the pump has stopped. Has to be called regularly, as a stop does not cause an edge.
+   *
+   * @param currentTimeInUs micros() now.
+   */
+  Event update(uint32_t currentTimeInUs);
+
+  bool isRunning() const;
+
+  /**
+   * @brief The first pulse of the current or last run.
+   */
+  uint32_t getStartTime() const;
+
+  /**
+   * @brief The last pulse of the last run.
+   */
+  uint32_t getStopTime() const;
+
+  /**
+   * @brief The time from the last pulse until the last stop was detected.
+   */
+  uint32_t getStopLatency() const;
+
+  /**
+   * @brief The average time between two pulses.
+   */
+  uint32_t getPulsePeriod() const;
+
+  /**
+   * @brief The number of pulses of the current or last run.
+   */
+  uint32_t getPulseCount() const;
+
+ private:
+  Event addPulse(uint32_t timeInUs);
+
+  bool running;
+  uint32_t firstPulseTime;
+  uint32_t lastPulseTime;
+  uint32_t stopLatency;
+  uint32_t pulsePeriod;
+  /// The pulses of the current pulse train.
+  uint32_t pulseCount;
+};
@@ -0,0 +1,110 @@
+#include <PumpRunClassifier.hpp>
+
+/// Runs shorter than this count as refill, longer ones as shot.
+constexpr unsigned long durationThresholdInMs = 10000;
+/// A run this much shorter or longer than the threshold scores one point.
+constexpr unsigned long msPerDurationPoint = 500;
+constexpr int16_t maxDurationPoints = 10;
+/// A run starting within this time after the previous one is a burst of a refill.
+constexpr unsigned long burstGapInMs = 5000;
+constexpr int16_t burstPoints = -4;
+constexpr int16_t heatingSwitchedOnPoints = -2;
+constexpr int16_t pumpReportedPoints = -2;
+/// Maps the score to the confidence. A score of this size is 75 % sure.
+constexpr int16_t scoreForThreeQuarters = 6;
+
+namespace {
+
+int16_t clamp(int32_t value, int16_t min, int16_t max) { return value < min ? min : (value > max ? max : value); }
+
+}  // namespace
+
+PumpRunClassifier::PumpRunClassifier()
+    : running{ false },
+      hasFrame{ false },
+      lastFrame{},
+      startTime{ 0 },
+      previousStopTime{ 0 },
+      hasPreviousRun{ false },
+      burst{ false },
+      lastShotStartTime{ 0 },
+      lastShotStopTime{ 0 },
+      framesInRun{ 0 },
+      pumpOnFrames{ 0 },
+      heatingOnAtStart{ false },
+      heatingSwitchedOn{ false },
+      hxAtStart{ 0 },
+      minHx{ 0 },
+      steamAtStart{ 0 },
+      minSteam{ 0 } {}
+
+void PumpRunClassifier::addFrame(const MaraXFrame &frame) {
+  if (running) {
+    if (framesInRun == 0 && !hasFrame) {
+      // No frame before the run, so the first one within it is the reference.
+      heatingOnAtStart = frame.heatingOn;
+      hxAtStart = minHx = frame.hxTemp;
+      steamAtStart = minSteam = frame.steamTemp;
+    }
+    ++framesInRun;
+    if (frame.pumpOn) ++pumpOnFrames;
+    if (frame.heatingOn && !heatingOnAtStart) heatingSwitchedOn = true;
+    if (frame.hxTemp < minHx) minHx = frame.hxTemp;
+    if (frame.steamTemp < minSteam) minSteam = frame.steamTemp;
+  }
+  lastFrame = frame;
+  hasFrame = true;
+}
+
+void PumpRunClassifier::startRun(unsigned long startTimeInMs) {
+  running = true;
+  startTime = startTimeInMs;
+  burst = hasPreviousRun && startTimeInMs - previousStopTime < burstGapInMs;
+  framesInRun = 0;
+  pumpOnFrames = 0;
+  heatingSwitchedOn = false;
+  if (hasFrame) {
+    heatingOnAtStart = lastFrame.heatingOn;
+    hxAtStart = minHx = lastFrame.hxTemp;
+    steamAtStart = minSteam = lastFrame.steamTemp;
+  }
+}
+
+PumpRunClassification PumpRunClassifier::stopRun(unsigned long stopTimeInMs) {
+  running = false;
+  previousStopTime = stopTimeInMs;
+  hasPreviousRun = true;
+
+  int16_t score = scoreDuration(stopTimeInMs - startTime) + scoreTemperatures();
+  if (burst) score += burstPoints;
+  if (heatingSwitchedOn) score += heatingSwitchedOnPoints;
+  if (pumpOnFrames * 2 > framesInRun) score += pumpReportedPoints;
+
+  const int16_t evidence = score < 0 ? -score : score;
+  const uint8_t confidence = 50 + 49 * evidence / (evidence + scoreForThreeQuarters);
+  const PumpRunKind kind = score >= 0 ? PumpRunKind::Shot : PumpRunKind::Refill;
+  if (kind == PumpRunKind::Shot) {
+    lastShotStartTime = startTime;
+    lastShotStopTime = stopTimeInMs;
+  }
+  return PumpRunClassification{ kind, confidence, score };
+}
+
+unsigned long PumpRunClassifier::getLastShotStartTime() const { return lastShotStartTime; }
+
+unsigned long PumpRunClassifier::getLastShotStopTime() const { return lastShotStopTime; }
+
+int16_t PumpRunClassifier::scoreDuration(unsigned long durationInMs) const {
+  const int32_t difference = static_cast<int32_t>(durationInMs) - static_cast<int32_t>(durationThresholdInMs);
+  return clamp(difference / static_cast<int32_t>(msPerDurationPoint), -maxDurationPoints, maxDurationPoints);
+}
+
+int16_t PumpRunClassifier::scoreTemperatures() const {
+  if (framesInRun == 0) {
+    return 0;
+  }
+  // A drop of 1 C is within the noise of the sensors. Each further degree is evidence.
+  const int32_t hxDrop = hxAtStart - minHx;
+  const int32_t steamDrop = steamAtStart - minSteam;
+  return clamp(2 * (hxDrop - 1), -2, 6) - clamp(2 * (steamDrop - 1), -2, 6);
+}
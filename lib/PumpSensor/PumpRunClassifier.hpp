@@ -0,0 +1,94 @@
+#pragma once
+#include <MaraXFrame.hpp>
+#include <stdint.h>
+
+enum class PumpRunKind : uint8_t {
+  /// A shot or a flush started by the lever.
+  Shot,
+  /// The machine ran the pump by itself to refill the boiler or exchange the water in the HX.
+  Refill
+};
+
+struct PumpRunClassification {
+  PumpRunKind kind;
+  /// How sure the classification is, from 50 (guess) to 99 %.
+  uint8_t confidence;
+  /// The sum of the evidence. Positive for a shot.
+  int16_t score;
+};
+
+/**
+ * @brief Tells the pump runs of shots from the ones the machine does by itself.
+ *
+ * Each run is scored by its evidence, positive for a shot, negative for a refill:
+ * - Duration: refills take a few seconds, shots 20 s and more.
+ * - Bursts: the machine refills in short runs following each other within seconds.
+ * - HX temperature: a shot draws fresh water through the HX, so its temperature drops.
+ * - Steam temperature: a refill feeds cold water into the boiler, so its temperature drops, and the heating switches
+ *   on.
+ * - Pump field of the frames: the mara x reports the pumps it runs. Weak evidence only, as it is not documented,
+ *   which runs it reports.
+ * The weights are a first guess and may be tuned with the logged scores.
+ *
+ * All updates take constant time, as only the extremes of the values during a run are kept.
+ */
+class PumpRunClassifier {
+ public:
+  PumpRunClassifier();
+
+  /**
+   * @brief Takes every decoded frame, also between the runs.
+   */
+  void addFrame(const MaraXFrame &frame);
+
+  /**
+   * @brief Starts collecting the evidence of a new run.
+   *
+   * @param startTimeInMs The millis() time point of the first pulse.
+   */
+  void startRun(unsigned long startTimeInMs);
+
+  /**
+   * @brief Ends the run and classifies it. A shot becomes the last shot.
+   *
+   * @param stopTimeInMs The millis() time point of the last pulse.
+   */
+  PumpRunClassification stopRun(unsigned long stopTimeInMs);
+
+  /**
+   * @brief The start of the last run classified as shot, shown by the shot timer. 0 before the first shot.
+   *
+   * Runs of the machine itself (e.g. refilling the boiler) do not replace it.
+   */
+  unsigned long getLastShotStartTime() const;
+
+  /**
+   * @brief The end of the last run classified as shot. 0 before the first shot.
+   */
+  unsigned long getLastShotStopTime() const;
+
+ private:
+  int16_t scoreDuration(unsigned long durationInMs) const;
+  int16_t scoreTemperatures() const;
+
+  bool running;
+  bool hasFrame;
+  MaraXFrame lastFrame;
+  unsigned long startTime;
+  /// The end of the previous run. Only valid, if hasPreviousRun.
+  unsigned long previousStopTime;
+  bool hasPreviousRun;
+  bool burst;
+  unsigned long lastShotStartTime;
+  unsigned long lastShotStopTime;
+
+  //----------- Frames during the run -----------
+  uint16_t framesInRun;
+  uint16_t pumpOnFrames;
+  bool heatingOnAtStart;
+  bool heatingSwitchedOn;
+  uint8_t hxAtStart;
+  uint8_t minHx;
+  uint8_t steamAtStart;
+  uint8_t minSteam;
+};
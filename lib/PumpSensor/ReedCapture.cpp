@@ -0,0 +1,41 @@
+#include <ReedCapture.hpp>
+
+/// timer1 counts the 80 MHz APB clock divided by 16.
+constexpr uint32_t timerTicksPerUs = 5;
+
+ReedCapture *ReedCapture::sampledCapture = nullptr;
+
+ReedCapture::ReedCapture(uint8_t pin, Mode mode) : pin{ pin }, mode{ mode }, lastLevel{ HIGH } {}
+
+void ReedCapture::begin() {
+  pinMode(pin, pin == 16 ? INPUT_PULLDOWN_16 : INPUT);
+  lastLevel = digitalRead(pin);
+  if (mode == Mode::PinInterrupt) {
+    attachInterruptArg(digitalPinToInterrupt(pin), onPinChange, this, CHANGE);
+  } else {
+    sampledCapture = this;
+    timer1_isr_init();
+    timer1_attachInterrupt(onTimer);
+    timer1_enable(TIM_DIV16, TIM_EDGE, TIM_LOOP);
+    timer1_write(sampleIntervalInUs * timerTicksPerUs);
+  }
+}
+
+bool ReedCapture::read(ReedEdge &edge) { return edges.pop(edge); }
+
+uint32_t ReedCapture::getOverflowCount() const { return edges.getOverflowCount(); }
+
+void IRAM_ATTR ReedCapture::capture(uint8_t level) {
+  if (level == lastLevel) {
+    return;
+  }
+  lastLevel = level;
+  edges.push(ReedEdge{ static_cast<uint32_t>(micros()), level });
+}
+
+void IRAM_ATTR ReedCapture::onTimer() { sampledCapture->capture(digitalRead(sampledCapture->pin)); }
+
+void IRAM_ATTR ReedCapture::onPinChange(void *capture) {
+  ReedCapture *reedCapture = static_cast<ReedCapture *>(capture);
+  reedCapture->capture(digitalRead(reedCapture->pin));
+}
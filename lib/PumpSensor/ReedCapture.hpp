@@ -0,0 +1,77 @@
+#pragma once
+#include <Arduino.h>
+#include <RingBuffer.hpp>
+
+/**
+ * @brief A change of the reed sensor input.
+ */
+struct ReedEdge {
+  /// micros() of the sample or interrupt, which saw the change.
+  uint32_t timeInUs;
+  /// The input level after the change. The reed sensor reads LOW, while the pump pulls the magnet.
+  uint8_t level;
+};
+
+/**
+ * @brief Captures the edges of the reed sensor independently of how busy loop() is.
+ *
+ * GPIO16 (D0), where the reed sensor is connected by default, can not raise pin interrupts. Hence, the input is
+ * sampled by a timer1 interrupt at a fixed rate. Alternatively, a pin with interrupt support can be used. Either way,
+ * every change of the input is pushed with its time into a lock-free ring buffer, which loop() consumes at its own
+ * pace.
+ *
+ * NOTE: timer1 is also used by analogWrite(), tone() and Servo. None of them may be used together with TimerSampling.
+ */
+class ReedCapture {
+ public:
+  enum class Mode {
+    /// Samples the input every sampleIntervalInUs. Works on every pin, including GPIO16.
+    TimerSampling,
+    /// Takes the time of every edge from a pin interrupt. Exact, but contact bounce is passed on as short pulses.
+    PinInterrupt
+  };
+
+  /// The pump pulses at the mains frequency. Sampling at 2 kHz resolves a pulse to 0.5 ms.
+  static constexpr uint32_t sampleIntervalInUs = 500;
+
+  /**
+   * @param pin The pin of the reed sensor.
+   * @param mode How to capture the edges. PinInterrupt is not possible on GPIO16.
+   */
+  ReedCapture(uint8_t pin, Mode mode);
+
+  /**
+   * @brief Configures the pin and starts capturing.
+   */
+  void begin();
+
+  /**
+   * @brief Takes the oldest edge. Must only be called from loop().
+   *
+   * @return False, if no edge is available.
+   */
+  bool read(ReedEdge &edge);
+
+  /**
+   * @brief Number of edges dropped, because loop() did not consume the ring buffer in time.
+   */
+  uint32_t getOverflowCount() const;
+
+ private:
+  /**
+   * @brief Pushes an edge, if the level differs from the one seen last. Called in interrupt context.
+   */
+  void IRAM_ATTR capture(uint8_t level);
+
+  static void IRAM_ATTR onTimer();
+  static void IRAM_ATTR onPinChange(void *capture);
+
+  /// timer1 only takes a plain function, hence the capture sampled by it.
+  static ReedCapture *sampledCapture;
+
+  const uint8_t pin;
+  const Mode mode;
+  volatile uint8_t lastLevel;
+  /// 50 Hz pulses cause 100 edges per second. This covers more than two seconds without consumption.
+  RingBuffer<ReedEdge, 256> edges;
+};
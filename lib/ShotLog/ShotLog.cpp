@@ -0,0 +1,158 @@
+#include <ShotLog.hpp>
+
+constexpr const char *directory = "/shots";
+constexpr uint8_t formatVersion = 1;
+
+ShotLog::ShotLog()
+    : mounted{ false },
+      firstSegment{ 0 },
+      lastSegment{ 0 },
+      recordsInLastSegment{ 0 },
+      lastSegmentWritable{ false },
+      nextSequence{ 0 },
+      nrRecords{ 0 } {}
+
+bool ShotLog::begin() {
+  mounted = LittleFS.begin();
+  if (!mounted) {
+    return false;
+  }
+  LittleFS.mkdir(directory);
+
+  size_t lastSegmentSize = 0;
+  Dir dir = LittleFS.openDir(directory);
+  while (dir.next()) {
+    const uint32_t segment = dir.fileName().toInt();
+    if (segment == 0) {
+      continue;
+    }
+    if (dir.fileSize() > sizeof(SegmentHeader)) {
+      nrRecords += (dir.fileSize() - sizeof(SegmentHeader)) / sizeof(ShotRecord);
+    }
+    if (firstSegment == 0 || segment < firstSegment) {
+      firstSegment = segment;
+    }
+    if (segment > lastSegment) {
+      lastSegment = segment;
+      lastSegmentSize = dir.fileSize();
+    }
+  }
+  if (lastSegment == 0) {
+    return true;
+  }
+
+  // Continue the sequence of the last record. A segment ending in a torn record is closed.
+  File file = LittleFS.open(getSegmentPath(lastSegment), "r");
+  const size_t recordBytes = lastSegmentSize > sizeof(SegmentHeader) ? lastSegmentSize - sizeof(SegmentHeader) : 0;
+  recordsInLastSegment = recordBytes / sizeof(ShotRecord);
+  lastSegmentWritable = file && readHeader(file) && recordBytes % sizeof(ShotRecord) == 0;
+  ShotRecord record;
+  if (file && recordsInLastSegment > 0 &&
+      file.seek(sizeof(SegmentHeader) + (recordsInLastSegment - 1) * sizeof(ShotRecord)) &&
+      file.read(reinterpret_cast<uint8_t *>(&record), sizeof(record)) == sizeof(record) && isValid(record)) {
+    nextSequence = record.sequence + 1;
+  } else {
+    lastSegmentWritable = false;
+    // The sequence is only used for ordering, so a gap does no harm.
+    nextSequence = (lastSegment + 1) * recordsPerSegment;
+  }
+  return true;
+}
+
+bool ShotLog::append(ShotRecord record) {
+  if (!mounted) {
+    return false;
+  }
+  record.sequence = nextSequence;
+  record.crc = crc16(reinterpret_cast<const uint8_t *>(&record), offsetof(ShotRecord, crc));
+
+  const bool newSegment = lastSegment == 0 || !lastSegmentWritable || recordsInLastSegment >= recordsPerSegment;
+  if (newSegment) {
+    if (firstSegment == 0) {
+      firstSegment = 1;
+    }
+    ++lastSegment;
+    recordsInLastSegment = 0;
+  }
+  File file = LittleFS.open(getSegmentPath(lastSegment), "a");
+  if (!file) {
+    lastSegmentWritable = false;
+    return false;
+  }
+  // The header and the first record are written at once, so a new segment costs no extra flash write.
+  uint8_t buffer[sizeof(SegmentHeader) + sizeof(ShotRecord)];
+  size_t length = 0;
+  if (newSegment) {
+    const SegmentHeader header{ { 'S', 'L' }, formatVersion, sizeof(ShotRecord) };
+    memcpy(buffer, &header, sizeof(header));
+    length = sizeof(header);
+  }
+  memcpy(buffer + length, &record, sizeof(record));
+  length += sizeof(record);
+  const bool written = file.write(buffer, length) == length;
+  file.close();
+
+  lastSegmentWritable = written;
+  if (!written) {
+    return false;
+  }
+  ++nextSequence;
+  ++recordsInLastSegment;
+  ++nrRecords;
+  if (newSegment) {
+    removeOldSegments();
+  }
+  return true;
+}
+
+void ShotLog::dump(Print &output) const {
+  output.println(
+      "sequence,unix_time,uptime_s,duration_s,hx_start,hx_min,hx_max,hx_end,steam_start,mode,kind,confidence");
+  forEach([&output](const ShotRecord &record) {
+    output.printf("%u,%u,%u,%u.%u,%u,%u,%u,%u,%u,%c,%s,%u\n", record.sequence, record.unixTime, record.uptimeInS,
+                  record.durationInDs / 10, record.durationInDs % 10, record.hxAtStart, record.minHx, record.maxHx,
+                  record.hxAtEnd, record.steamAtStart, record.mode, record.kind == 0 ? "shot" : "refill",
+                  record.confidence);
+  });
+}
+
+uint32_t ShotLog::getNrRecords() const { return nrRecords; }
+
+uint16_t ShotLog::crc16(const uint8_t *data, size_t length) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < length; ++i) {
+    crc ^= static_cast<uint16_t>(data[i]) << 8;
+    for (uint8_t bit = 0; bit < 8; ++bit) {
+      crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+bool ShotLog::isValid(const ShotRecord &record) {
+  return crc16(reinterpret_cast<const uint8_t *>(&record), offsetof(ShotRecord, crc)) == record.crc;
+}
+
+String ShotLog::getSegmentPath(uint32_t segment) { return String(directory) + '/' + segment + ".bin"; }
+
+bool ShotLog::readHeader(File &file) {
+  SegmentHeader header;
+  return file.read(reinterpret_cast<uint8_t *>(&header), sizeof(header)) == sizeof(header) &&
+         header.magic[0] == 'S' && header.magic[1] == 'L' && header.version == formatVersion &&
+         header.recordSize == sizeof(ShotRecord);
+}
+
+void ShotLog::removeOldSegments() {
+  while (lastSegment - firstSegment + 1 > maxSegments) {
+    File file = LittleFS.open(getSegmentPath(firstSegment), "r");
+    if (file) {
+      const size_t size = file.size();
+      file.close();
+      if (size > sizeof(SegmentHeader)) {
+        nrRecords -= (size - sizeof(SegmentHeader)) / sizeof(ShotRecord);
+      }
+    }
+    LittleFS.remove(getSegmentPath(firstSegment));
+    ++firstSegment;
+  }
+}
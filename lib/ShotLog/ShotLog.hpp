@@ -0,0 +1,121 @@
+#pragma once
+#include <LittleFS.h>
+#include <Print.h>
+#include <stdint.h>
+
+/**
+ * @brief One pump run as stored in the shot log.
+ */
+struct __attribute__((packed)) ShotRecord {
+  /// Counts all records ever written.
+  uint32_t sequence;
+  /// Seconds since 1970 at the start of the run. 0, if the time was not known (no wifi).
+  uint32_t unixTime;
+  /// Seconds since the boot at the start of the run.
+  uint32_t uptimeInS;
+  uint16_t durationInDs;
+  uint8_t hxAtStart;
+  uint8_t minHx;
+  uint8_t maxHx;
+  uint8_t hxAtEnd;
+  uint8_t steamAtStart;
+  /// 'C' for coffee priority, 'V' for steam priority.
+  char mode;
+  /// 0 for a shot, 1 for a refill (see PumpRunKind).
+  uint8_t kind;
+  uint8_t confidence;
+  /// CRC-16/CCITT of all bytes above.
+  uint16_t crc;
+};
+static_assert(sizeof(ShotRecord) == 24, "The record size is part of the file format");
+
+/**
+ * @brief Append-only log of the pump runs on LittleFS.
+ *
+ * The records are written to segment files /shots/<number>.bin. Each starts with a header of the format version and
+ * the record size, followed by the records. A record is appended by a single write, so a shot costs one append to the
+ * last segment and no rewrite of older data. Once a segment holds recordsPerSegment records, the next one is started
+ * and the oldest segments beyond maxSegments are deleted.
+ *
+ * A power cut while appending can at most lose the record written. Records with a wrong CRC are skipped when reading,
+ * and a segment, whose size does not match whole records, is never appended to again.
+ */
+class ShotLog {
+ public:
+  static constexpr uint16_t recordsPerSegment = 128;
+  static constexpr uint8_t maxSegments = 16;
+
+  ShotLog();
+
+  /**
+   * @brief Mounts the file system (formatting it, if there is none) and finds the end of the log.
+   *
+   * @return False, if the file system is not available. Nothing is logged then.
+   */
+  bool begin();
+
+  /**
+   * @brief Appends a record. Its sequence and crc are filled in.
+   *
+   * Writes to flash, so it should not be called from time critical code.
+   */
+  bool append(ShotRecord record);
+
+  /**
+   * @brief Calls callback(record) for every valid record from the oldest to the newest.
+   *
+   * Only one record is held in RAM at a time.
+   */
+  template <typename Callback>
+  void forEach(Callback callback) const;
+
+  /**
+   * @brief Prints all records as CSV.
+   */
+  void dump(Print &output) const;
+
+  uint32_t getNrRecords() const;
+
+ private:
+  struct __attribute__((packed)) SegmentHeader {
+    uint8_t magic[2];
+    uint8_t version;
+    uint8_t recordSize;
+  };
+
+  static uint16_t crc16(const uint8_t *data, size_t length);
+  static bool isValid(const ShotRecord &record);
+  static String getSegmentPath(uint32_t segment);
+  static bool readHeader(File &file);
+
+  void removeOldSegments();
+
+  bool mounted;
+  /// The numbers of the oldest and newest segment. 0, if there is none.
+  uint32_t firstSegment;
+  uint32_t lastSegment;
+  uint16_t recordsInLastSegment;
+  /// False, if the last segment can not be appended to, e.g. because of a torn record at its end.
+  bool lastSegmentWritable;
+  uint32_t nextSequence;
+  uint32_t nrRecords;
+};
+
+template <typename Callback>
+void ShotLog::forEach(Callback callback) const {
+  if (!mounted || firstSegment == 0) {
+    return;
+  }
+  for (uint32_t segment = firstSegment; segment <= lastSegment; ++segment) {
+    File file = LittleFS.open(getSegmentPath(segment), "r");
+    if (!file || !readHeader(file)) {
+      continue;
+    }
+    ShotRecord record;
+    while (file.read(reinterpret_cast<uint8_t *>(&record), sizeof(record)) == sizeof(record)) {
+      if (isValid(record)) {
+        callback(record);
+      }
+    }
+  }
+}
@@ -0,0 +1,131 @@
+#include <TemperatureHistory.hpp>
+
+namespace {
+constexpr uint8_t deltaZero = 0;
+constexpr uint8_t deltaPlusOne = 1;
+constexpr uint8_t deltaMinusOne = 2;
+/// The temperature follows the code of the sample.
+constexpr uint8_t deltaEscape = 3;
+constexpr uint8_t deltaMask = 0x03;
+constexpr uint8_t hxDeltaShift = 2;
+constexpr uint8_t heatingBit = 1 << 4;
+constexpr uint8_t pumpBit = 1 << 5;
+
+/**
+ * @brief Encodes the change of a temperature into 2 bits.
+ */
+uint8_t encodeDelta(uint8_t previous, uint8_t current) {
+  if (current == previous) {
+    return deltaZero;
+  } else if (current == previous + 1) {
+    return deltaPlusOne;
+  } else if (current + 1 == previous) {
+    return deltaMinusOne;
+  }
+  return deltaEscape;
+}
+}  // namespace
+
+static_assert(sizeof(HistorySample) == 4, "HistorySample is part of every block");
+
+TemperatureHistory::TemperatureHistory()
+    : blocks{}, oldestBlock{ 0 }, nrUsedBlocks{ 0 }, lastSample{}, lastTime{ 0 }, nextBitIndex{ 0 } {}
+
+void TemperatureHistory::append(uint32_t timeInSeconds, const HistorySample &sample) {
+  if (!appendToCurrentBlock(timeInSeconds, sample)) {
+    if (nrUsedBlocks < nrBlocks) {
+      nrUsedBlocks++;
+    } else {
+      oldestBlock = (oldestBlock + 1) % nrBlocks;
+    }
+    Block &block = blocks[getRingIndex(nrUsedBlocks - 1)];
+    block.firstTime = timeInSeconds;
+    block.keySample = sample;
+    block.nrSamples = 1;
+    nextBitIndex = 0;
+  }
+  lastSample = sample;
+  lastTime = timeInSeconds;
+}
+
+bool TemperatureHistory::isEmpty() const { return nrUsedBlocks == 0; }
+
+uint32_t TemperatureHistory::getFirstTime() const { return isEmpty() ? 0 : blocks[oldestBlock].firstTime; }
+
+uint32_t TemperatureHistory::getLastTime() const { return lastTime; }
+
+uint16_t TemperatureHistory::getRingIndex(uint16_t age) const { return (oldestBlock + age) % nrBlocks; }
+
+bool TemperatureHistory::appendToCurrentBlock(uint32_t timeInSeconds, const HistorySample &sample) {
+  if (isEmpty() || timeInSeconds != lastTime + 1) {
+    return false;
+  }
+  Block &block = blocks[getRingIndex(nrUsedBlocks - 1)];
+  const uint8_t steamCode = encodeDelta(lastSample.steamTemp, sample.steamTemp);
+  const uint8_t hxCode = encodeDelta(lastSample.hxTemp, sample.hxTemp);
+  const uint16_t nrBits = bitsPerSample + (steamCode == deltaEscape ? bitsPerEscapedTemp : 0) +
+                          (hxCode == deltaEscape ? bitsPerEscapedTemp : 0);
+  if (nextBitIndex + nrBits > payloadBytesPerBlock * 8) {
+    return false;
+  }
+  const uint8_t code = steamCode | (hxCode << hxDeltaShift) | (sample.heatingOn ? heatingBit : 0) |
+                       (sample.pumpOn ? pumpBit : 0);
+  writeBits(block, code, bitsPerSample);
+  if (steamCode == deltaEscape) {
+    writeBits(block, sample.steamTemp, bitsPerEscapedTemp);
+  }
+  if (hxCode == deltaEscape) {
+    writeBits(block, sample.hxTemp, bitsPerEscapedTemp);
+  }
+  block.nrSamples++;
+  return true;
+}
+
+void TemperatureHistory::writeBits(Block &block, uint8_t value, uint8_t nrBits) {
+  // Samples are packed back to back, so the bits may span two bytes.
+  const uint8_t byteIndex = nextBitIndex / 8;
+  const uint8_t bitOffset = nextBitIndex % 8;
+  block.payload[byteIndex] = (block.payload[byteIndex] & ((1 << bitOffset) - 1)) | (value << bitOffset);
+  if (bitOffset + nrBits > 8) {
+    block.payload[byteIndex + 1] = value >> (8 - bitOffset);
+  }
+  nextBitIndex += nrBits;
+}
+
+uint8_t TemperatureHistory::readBits(const Block &block, uint16_t &bitIndex, uint8_t nrBits) {
+  const uint8_t byteIndex = bitIndex / 8;
+  const uint8_t bitOffset = bitIndex % 8;
+  uint16_t bits = block.payload[byteIndex];
+  if (bitOffset + nrBits > 8) {
+    bits |= block.payload[byteIndex + 1] << 8;
+  }
+  bitIndex += nrBits;
+  return (bits >> bitOffset) & ((1 << nrBits) - 1);
+}
+
+HistorySample TemperatureHistory::decode(const Block &block, const HistorySample &previous, uint16_t &bitIndex) {
+  const uint8_t code = readBits(block, bitIndex, bitsPerSample);
+  HistorySample sample;
+  // Escaped temperatures follow in the same order as their codes.
+  sample.steamTemp = decodeTemp(block, previous.steamTemp, code, bitIndex);
+  sample.hxTemp = decodeTemp(block, previous.hxTemp, code >> hxDeltaShift, bitIndex);
+  sample.heatingOn = code & heatingBit;
+  sample.pumpOn = code & pumpBit;
+  return sample;
+}
+
+uint8_t TemperatureHistory::decodeTemp(const Block &block, uint8_t previous, uint8_t code, uint16_t &bitIndex) {
+  switch (code & deltaMask) {
+    case deltaPlusOne: return previous + 1;
+    case deltaMinusOne: return previous - 1;
+    case deltaEscape: return readBits(block, bitIndex, bitsPerEscapedTemp);
+    default: return previous;
+  }
+}
+
+void TemperatureHistory::dump(Print &output, uint32_t fromTime, uint32_t toTime) const {
+  output.println("time_s,steam,hx,heating,pump");
+  forEachInRange(fromTime, toTime, [&output](uint32_t timeInSeconds, const HistorySample &sample) {
+    output.printf("%u,%u,%u,%u,%u\n", timeInSeconds, sample.steamTemp, sample.hxTemp, sample.heatingOn, sample.pumpOn);
+  });
+}
@@ -0,0 +1,162 @@
+#pragma once
+#include <Print.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief One sample of the mara x state.
+ */
+struct HistorySample {
+  uint8_t steamTemp;
+  uint8_t hxTemp;
+  bool heatingOn;
+  bool pumpOn;
+};
+
+/**
+ * @brief Fixed-capacity store of the samples of the last hours.
+ *
+ * Samples are stored in blocks. Each block starts with a full key sample. Every following sample takes 6 bits: the
+ * change of the steam and of the hx temp by -1, 0 or +1 °C (2 bits each) plus both flags. A larger change is marked by
+ * the fourth 2 bit code and followed by the new temperature in 8 bits. A gap in time starts the next block. When all
+ * blocks are in use, the oldest one is overwritten.
+ *
+ * At 1 Hz and slowly changing temperatures, a block covers 74 s in 64 bytes, so the default capacity of 8 KB covers
+ * about 2.6 hours. Each larger change takes the room of about one more sample.
+ */
+class TemperatureHistory {
+ public:
+  static constexpr uint16_t nrBlocks = 128;
+  static constexpr uint8_t bitsPerSample = 6;
+  /// The bits following the code of a sample for each temperature, which changed by more than 1 °C.
+  static constexpr uint8_t bitsPerEscapedTemp = 8;
+  static constexpr uint8_t payloadBytesPerBlock = 55;
+  /// The key sample plus the delta encoded ones, if no temperature is escaped.
+  static constexpr uint8_t samplesPerBlock = 1 + payloadBytesPerBlock * 8 / bitsPerSample;
+
+  TemperatureHistory();
+
+  /**
+   * @brief Stores a sample in O(1).
+   *
+   * @param timeInSeconds When the sample was taken. Has to be later than the time of the previous sample.
+   * @param sample The sample.
+   */
+  void append(uint32_t timeInSeconds, const HistorySample &sample);
+
+  bool isEmpty() const;
+
+  /**
+   * @brief The time of the oldest stored sample.
+   */
+  uint32_t getFirstTime() const;
+
+  /**
+   * @brief The time of the newest stored sample.
+   */
+  uint32_t getLastTime() const;
+
+  /**
+   * @brief Calls callback(timeInSeconds, sample) for every stored sample with fromTime <= timeInSeconds <= toTime.
+   *
+   * Samples are passed in chronological order. Finding the first block takes O(log nrBlocks).
+   */
+  template <typename Callback>
+  void forEachInRange(uint32_t fromTime, uint32_t toTime, Callback callback) const;
+
+  /**
+   * @brief Writes the samples with fromTime <= timeInSeconds <= toTime as CSV.
+   */
+  void dump(Print &output, uint32_t fromTime, uint32_t toTime) const;
+
+ private:
+  struct Block {
+    uint32_t firstTime;
+    HistorySample keySample;
+    uint8_t nrSamples;
+    uint8_t payload[payloadBytesPerBlock];
+  };
+
+  /**
+   * @brief The ring index of the n-th oldest block.
+   */
+  uint16_t getRingIndex(uint16_t age) const;
+
+  /**
+   * @brief Tries to delta encode the sample into the current block.
+   *
+   * @return False, if the sample has to start a new block.
+   */
+  bool appendToCurrentBlock(uint32_t timeInSeconds, const HistorySample &sample);
+
+  /**
+   * @brief Writes the lowest nrBits (at most 8) of value to the payload of the current block at nextBitIndex.
+   */
+  void writeBits(Block &block, uint8_t value, uint8_t nrBits);
+
+  /**
+   * @brief Reads nrBits (at most 8) from the payload at bitIndex and advances bitIndex behind them.
+   */
+  static uint8_t readBits(const Block &block, uint16_t &bitIndex, uint8_t nrBits);
+
+  /**
+   * @brief Decodes the sample at bitIndex based on the previous one and advances bitIndex to the next sample.
+   */
+  static HistorySample decode(const Block &block, const HistorySample &previous, uint16_t &bitIndex);
+
+  /**
+   * @brief Applies the 2 bit code of a temperature to its previous value. An escaped temperature is read at bitIndex.
+   */
+  static uint8_t decodeTemp(const Block &block, uint8_t previous, uint8_t code, uint16_t &bitIndex);
+
+  Block blocks[nrBlocks];
+  /// The ring index of the oldest block.
+  uint16_t oldestBlock;
+  uint16_t nrUsedBlocks;
+  /// The last appended sample, the base for the next delta.
+  HistorySample lastSample;
+  uint32_t lastTime;
+  /// Where the next sample is written into the payload of the newest block.
+  uint16_t nextBitIndex;
+};
+
+template <typename Callback>
+void TemperatureHistory::forEachInRange(uint32_t fromTime, uint32_t toTime, Callback callback) const {
+  if (isEmpty() || fromTime > toTime) {
+    return;
+  }
+
+  // Binary search for the last block starting at or before fromTime.
+  uint16_t low = 0;
+  uint16_t high = nrUsedBlocks;
+  while (high - low > 1) {
+    const uint16_t middle = (low + high) / 2;
+    if (blocks[getRingIndex(middle)].firstTime <= fromTime) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+
+  for (uint16_t age = low; age < nrUsedBlocks; ++age) {
+    const Block &block = blocks[getRingIndex(age)];
+    if (block.firstTime > toTime) {
+      return;
+    }
+    // The samples differ in size, so they are decoded from the start of the block.
+    HistorySample sample = block.keySample;
+    uint16_t bitIndex = 0;
+    for (uint8_t i = 0; i < block.nrSamples; ++i) {
+      if (i > 0) {
+        sample = decode(block, sample, bitIndex);
+      }
+      const uint32_t timeInSeconds = block.firstTime + i;
+      if (timeInSeconds > toTime) {
+        return;
+      }
+      if (timeInSeconds >= fromTime) {
+        callback(timeInSeconds, sample);
+      }
+    }
+  }
+}
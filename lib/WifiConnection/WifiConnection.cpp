@@ -0,0 +1,113 @@
+#include <WifiConnection.hpp>
+
+/// How long a connection attempt may take, before it is considered as failed.
+constexpr unsigned long connectTimeoutInMs = 15000;
+constexpr unsigned long initialRetryDelayInMs = 5000;
+constexpr unsigned long maxRetryDelayInMs = 5 * 60 * 1000;
+/// The configuration portal is opened after this many failed attempts.
+constexpr uint8_t failedAttemptsUntilConfigPortal = 3;
+constexpr unsigned long configPortalTimeoutInS = 180;
+
+WifiConnection::WifiConnection(const char *ssidAP, const char *passwordAP)
+    : ssidAP{ ssidAP },
+      passwordAP{ passwordAP },
+      state{ State::WaitingForRetry },
+      stateStartedTime{ 0 },
+      retryDelay{ initialRetryDelayInMs },
+      nrFailedAttempts{ 0 } {}
+
+void WifiConnection::begin() {
+  wifiManager.setBreakAfterConfig(true);
+  wifiManager.setConfigPortalBlocking(false);
+  wifiManager.setConfigPortalTimeout(configPortalTimeoutInS);
+  WiFi.mode(WIFI_STA);
+  const unsigned long currentMillis = millis();
+  if (WiFi.SSID().length() == 0) {
+    openConfigPortal(currentMillis);
+  } else {
+    connect(currentMillis);
+  }
+}
+
+void WifiConnection::handle(const unsigned long &currentMillis) {
+  switch (state) {
+    case State::Connecting:
+      if (WiFi.status() == WL_CONNECTED) {
+        Serial.printf("Wifi connected to %s, IP address: %s\n", WiFi.SSID().c_str(), WiFi.localIP().toString().c_str());
+        nrFailedAttempts = 0;
+        retryDelay = initialRetryDelayInMs;
+        setState(State::Connected, currentMillis);
+      } else if (currentMillis - stateStartedTime > connectTimeoutInMs) {
+        nrFailedAttempts++;
+        if (nrFailedAttempts >= failedAttemptsUntilConfigPortal) {
+          openConfigPortal(currentMillis);
+        } else {
+          scheduleRetry(currentMillis);
+        }
+      }
+      break;
+    case State::Connected:
+      if (WiFi.status() != WL_CONNECTED) {
+        Serial.println("Wifi connection lost");
+        connect(currentMillis);
+      }
+      break;
+    case State::WaitingForRetry:
+      if (currentMillis - stateStartedTime > retryDelay) {
+        connect(currentMillis);
+      }
+      break;
+    case State::ConfigPortal:
+      wifiManager.process();
+      if (WiFi.status() == WL_CONNECTED) {
+        wifiManager.stopConfigPortal();
+        nrFailedAttempts = 0;
+        retryDelay = initialRetryDelayInMs;
+        setState(State::Connected, currentMillis);
+      } else if (!wifiManager.getConfigPortalActive()) {
+        // Timed out. Continue with the stored credentials.
+        nrFailedAttempts = 0;
+        scheduleRetry(currentMillis);
+      }
+      break;
+  }
+}
+
+bool WifiConnection::isConnected() const { return state == State::Connected; }
+
+WifiConnection::State WifiConnection::getState() const { return state; }
+
+void WifiConnection::connect(const unsigned long &currentMillis) {
+  WiFi.mode(WIFI_STA);
+  WiFi.begin();
+  setState(State::Connecting, currentMillis);
+}
+
+void WifiConnection::scheduleRetry(const unsigned long &currentMillis) {
+  Serial.printf("Wifi not available. Retrying in %lu s\n", retryDelay / 1000);
+  setState(State::WaitingForRetry, currentMillis);
+  retryDelay = retryDelay * 2 < maxRetryDelayInMs ? retryDelay * 2 : maxRetryDelayInMs;
+}
+
+void WifiConnection::openConfigPortal(const unsigned long &currentMillis) {
+  wifiManager.startConfigPortal(ssidAP, passwordAP);
+  setState(State::ConfigPortal, currentMillis);
+}
+
+const char *WifiConnection::toString(State state) {
+  switch (state) {
+    case State::Connecting: return "connecting";
+    case State::Connected: return "connected";
+    case State::WaitingForRetry: return "waiting for retry";
+    case State::ConfigPortal: return "config portal";
+  }
+  return "unknown";
+}
+
+void WifiConnection::setState(State newState, const unsigned long &currentMillis) {
+  if (newState != state) {
+    Serial.printf("Wifi: %s -> %s\n", toString(state), toString(newState));
+  }
+  state = newState;
+  stateStartedTime = currentMillis;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <WiFiManager.h>
+
+/**
+ * @brief Connects to the wifi in the background, so metering never waits for it.
+ *
+ * Instead of blocking in WiFiManager::autoConnect(), the stored credentials are tried without waiting. Failed and lost
+ * connections are retried with an exponential backoff. If no credentials are stored, or the wifi could not be reached
+ * several times in a row, the configuration portal of the WiFiManager is opened for a limited time. Everything
+ * proceeds within handle(), which has to be called from loop().
+ */
+class WifiConnection {
+ public:
+  enum class State : uint8_t {
+    Connecting,
+    Connected,
+    WaitingForRetry,
+    ConfigPortal,
+  };
+
+  /**
+   * @param ssidAP The name of the access point of the configuration portal.
+   * @param passwordAP The password of the access point of the configuration portal.
+   */
+  WifiConnection(const char *ssidAP, const char *passwordAP);
+
+  /**
+   * @brief Starts connecting with the stored credentials. Returns immediately.
+   */
+  void begin();
+
+  /**
+   * @brief Proceeds with connecting, retrying or the configuration portal.
+   */
+  void handle(const unsigned long &currentMillis);
+
+  bool isConnected() const;
+
+  State getState() const;
+
+ private:
+  /**
+   * @brief Starts a connection attempt with the stored credentials.
+   */
+  void connect(const unsigned long &currentMillis);
+
+  /**
+   * @brief Waits before the next connection attempt. The wait time doubles with every failed attempt.
+   */
+  void scheduleRetry(const unsigned long &currentMillis);
+
+  /**
+   * @brief Opens the configuration portal without blocking.
+   */
+  void openConfigPortal(const unsigned long &currentMillis);
+
+  static const char *toString(State state);
+
+  /**
+   * @brief Enters the state and remembers when.
+   */
+  void setState(State newState, const unsigned long &currentMillis);
+
+  const char *const ssidAP;
+  const char *const passwordAP;
+  WiFiManager wifiManager;
+  State state;
+  /// When the current state has been entered.
+  unsigned long stateStartedTime;
+  unsigned long retryDelay;
+  /// Failed connection attempts since the last connection or the last configuration portal.
+  uint8_t nrFailedAttempts;
+};
@@ -2,8 +2,18 @@
 #include <ArduinoOTA.h>
 
 #include <EInkHelper.hpp>
-#include <SoftwareSerial.h>
-#include <WiFiManager.h>
+#include <FrameLatch.hpp>
+#include <MaraXFrame.hpp>
+#include <MaraXFramer.hpp>
+#include <MaraXSerialIngest.hpp>
+#include <PumpDetector.hpp>
+#include <PumpRunClassifier.hpp>
+#include <ReedCapture.hpp>
+#include <RingBuffer.hpp>
+#include <ShotLog.hpp>
+#include <TemperatureHistory.hpp>
+#include <WifiConnection.hpp>
+#include <time.h>
 
 //----------- Hostname -----------
 constexpr const char *hostName = "MaraXMonitor";  // Name for OTA. See upload_port in the platformio.ini.
@@ -11,45 +21,67 @@ constexpr const char *hostName = "MaraXMonitor";  // Name for OTA. See upload_po
 //----------- AP -----------
 constexpr const char *ssidAP = "AutoConnectAP";  // Initial access point name to connect it to the wifi for OTA.
 constexpr const char *passwordAP = "password";
+WifiConnection wifiConnection(ssidAP, passwordAP);
+/// OTA is set up, once the wifi is connected for the first time.
+bool otaStarted = false;
 
 //----------- EInk Diagram Helper -----------
 EInkHelper eInkHelper;
 unsigned long lastDisplayUpdate;
+uint32_t lastDisplayedFrameSequence = 0;
 constexpr unsigned long displayUpdateFrequency = 1000;  //(ms)
+/// How often the shot timer is refreshed during a shot. Below 1000 ms, it shows tenths of seconds.
+constexpr unsigned long shotTimerRefreshIntervalInMs = 1000;
 
 //----------- MaraXSerial -----------
-SoftwareSerial maraXSerial(D4, D6);  // D6 - RX on Machine , D4 - TX on Machine
-constexpr byte nrMaraXChars = 32;
-char currentMaraXString[nrMaraXChars];
-unsigned long timePointSetupFinished = 0;
+MaraXSerialIngest maraXIngest(D4, D6);  // D6 - RX on Machine , D4 - TX on Machine
+MaraXFramer maraXFramer;
+/// The latest decoded frame. Written by readMaraXSerial(), read by the display update.
+FrameLatch<MaraXFrame> latestMaraXFrame;
+uint32_t reportedMaraXErrors = 0;
+/// The time point of the serial ingest start. All times shown and stored are relative to it.
+unsigned long timePointMeteringStarted = 0;
 
-/**
- * Handle the 1/0 values from the pump. If longer than X ms, the pump probably is off.
- */
-unsigned long pumpStoppedTime = 0;
+//----------- History -----------
+TemperatureHistory temperatureHistory;
+/// The time (in s since setup) of the next sample to store.
+uint32_t nextHistoryTimeInSeconds = 0;
+/// The time printed by the serial command 'h'. The whole history would block the loop for several seconds.
+constexpr uint32_t historyDumpInS = 15 * 60;
 
+//----------- Pump -----------
 bool pumpRunning = false;
-
+/// The time points of the first and last pulse of the pump, converted to millis().
 unsigned long pumpStartedTime = 0;
-constexpr uint8_t reedSensorPin = D0;
+unsigned long pumpStoppedTime = 0;
+#if defined(REED_SENSOR_INTERRUPT_PIN)
+// Build option for a reed sensor connected to a pin with interrupt support.
+ReedCapture reedCapture(REED_SENSOR_INTERRUPT_PIN, ReedCapture::Mode::PinInterrupt);
+#else
+ReedCapture reedCapture(D0, ReedCapture::Mode::TimerSampling);
+#endif
+uint32_t reportedReedOverflows = 0;
+PumpDetector pumpDetector;
+PumpRunClassifier pumpRunClassifier;
 
-/**
- * The reed sensor receives 0's and 1's when the pump is running.
- * This time defines, how long 1's (pump not running) have to be received, until the shot timer is stopped.
- */
-constexpr unsigned long thresholdPumpNoLongerRunning = 1500;
+//----------- Shot log -----------
+ShotLog shotLog;
+/// The current or last pump run.
+ShotRecord pumpRunRecord;
+/// Ended pump runs, written to the log from loop(). A refill may start before the last shot has been written.
+RingBuffer<ShotRecord, 4> endedPumpRunRecords;
+uint32_t reportedDroppedPumpRunRecords = 0;
+/// The clock is set via NTP, once the wifi is connected. Earlier times are not valid.
+constexpr time_t minValidUnixTime = 1600000000;
 
 ADC_MODE(ADC_VCC)
 uint16_t maxVoltage = 0;
+bool powerLossDetected = false;
 
-/**
- * Function to connect to a wifi. It waits until a connection is established.
- */
-void connectToWifi() {
-  WiFiManager wifiManager;
-  wifiManager.setBreakAfterConfig(true);
-  wifiManager.autoConnect(ssidAP, passwordAP);
-}
+//----------- Latency -----------
+unsigned long lastTimeCriticalTasksRun = 0;
+/// The longest time between two runs of the time critical tasks.
+unsigned long maxTimeCriticalTasksGap = 0;
 
 /**
  * @brief Prepares the OTA updates.
@@ -91,109 +123,247 @@ void setupOTA() {
  * @brief Opens up the serial communication to the mara x.
  */
 void setupMaraXCommunication() {
-  maraXSerial.begin(9600);
-  memset(currentMaraXString, 0, nrMaraXChars);
+  maraXIngest.begin();
 }
 
+void handleTimeCriticalTasks();
+
 void setup() {
   Serial.begin(115200);
 
-  connectToWifi();
-  setupOTA();
-  eInkHelper.setupDisplay();
-
-  pinMode(reedSensorPin, INPUT_PULLDOWN_16);
+  // Metering starts first, so that no data is lost while the display and the wifi are set up.
+  reedCapture.begin();
   setupMaraXCommunication();
+  timePointMeteringStarted = millis();
+  eInkHelper.setRefreshBusyHandler(handleTimeCriticalTasks);
+  eInkHelper.setShotModeRefreshInterval(shotTimerRefreshIntervalInMs);
+
+  // The boot screen is only shown after power on. A warm reset (e.g. after an OTA update) gets live faster without it.
+  eInkHelper.setupDisplay(ESP.getResetInfoPtr()->reason == REASON_DEFAULT_RST);
+  const unsigned long timePointDisplayReady = millis();
+
+  if (shotLog.begin()) {
+    Serial.printf("Shot log: %u records\n", shotLog.getNrRecords());
+  } else {
+    Serial.println("Shot log: file system not available");
+  }
+
+  // Connects in the background. OTA is set up and the clock is set, once connected.
+  wifiConnection.begin();
+  configTime(0, 0, "pool.ntp.org");
+
+  Serial.printf("Boot (%s): metering after %lu ms, display after %lu ms\n", ESP.getResetReason().c_str(),
+                timePointMeteringStarted, timePointDisplayReady);
+  Serial.printf("Framebuffer: %u bytes, free heap: %u bytes\n", eInkHelper.getFrameBufferSize(), ESP.getFreeHeap());
+}
+
+/**
+ * @brief Takes the temperatures of a frame received during a pump run into its record.
+ */
+void updatePumpRunRecord(const MaraXFrame &frame) {
+  if (pumpRunRecord.mode == 0) {
+    // No frame before the run.
+    pumpRunRecord.hxAtStart = pumpRunRecord.minHx = pumpRunRecord.maxHx = frame.hxTemp;
+    pumpRunRecord.steamAtStart = frame.steamTemp;
+    pumpRunRecord.mode = frame.mode;
+  }
+  // No std::min/max, as they can not bind to the members of the packed record.
+  if (frame.hxTemp < pumpRunRecord.minHx) pumpRunRecord.minHx = frame.hxTemp;
+  if (frame.hxTemp > pumpRunRecord.maxHx) pumpRunRecord.maxHx = frame.hxTemp;
+  pumpRunRecord.hxAtEnd = frame.hxTemp;
+}
 
-  timePointSetupFinished = millis();
+/**
+ * @brief Starts the record of a pump run with the latest frame.
+ */
+void startPumpRunRecord(unsigned long startedTime, unsigned long currentMillis) {
+  pumpRunRecord = ShotRecord{};
+  const time_t now = time(nullptr);
+  if (now > minValidUnixTime) {
+    pumpRunRecord.unixTime = now - (currentMillis - startedTime) / 1000;
+  }
+  pumpRunRecord.uptimeInS = startedTime / 1000;
+  MaraXFrame frame;
+  if (latestMaraXFrame.read(frame) != 0) {
+    updatePumpRunRecord(frame);
+  }
+}
+
+/**
+ * @brief Writes the records of the ended pump runs to the shot log. Not time critical, as it writes to flash.
+ */
+void handleShotLog() {
+  ShotRecord record;
+  while (endedPumpRunRecords.pop(record)) {
+    if (!shotLog.append(record)) {
+      Serial.println("Shot log: append failed");
+    }
+  }
+  if (endedPumpRunRecords.getOverflowCount() != reportedDroppedPumpRunRecords) {
+    reportedDroppedPumpRunRecords = endedPumpRunRecords.getOverflowCount();
+    Serial.printf("Shot log: %u records dropped\n", reportedDroppedPumpRunRecords);
+  }
 }
 
 /**
- * @brief Evaluates and stores the current mara x input.
+ * @brief Decodes the complete frames received from the mara x and publishes the latest one.
  */
 void readMaraXSerial() {
-  byte currentIndex = 0;
-  while (maraXSerial.available()) {
-    char currentMaraXChar = maraXSerial.read();
-
-    if (currentMaraXChar != '\n') {  // Stream of chars finished
-      currentMaraXString[currentIndex] = currentMaraXChar;
-      currentIndex++;
-      if (currentIndex >= nrMaraXChars) {
-        currentIndex = nrMaraXChars - 1;
+  char currentMaraXChar;
+  while (maraXIngest.read(currentMaraXChar)) {
+    if (maraXFramer.push(currentMaraXChar)) {
+      Serial.println(maraXFramer.getFrame());
+      MaraXFrame frame;
+      const auto result = decodeMaraXFrame(maraXFramer.getFrame(), maraXFramer.getFrameLength(), frame);
+      if (result == MaraXDecodeResult::Ok) {
+        if (latestMaraXFrame.getSequence() == 0) {
+          Serial.printf("First Mara X frame after %lu ms\n", millis());
+        }
+        latestMaraXFrame.publish(frame);
+        pumpRunClassifier.addFrame(frame);
+        if (pumpRunning) {
+          updatePumpRunRecord(frame);
+        }
+      } else {
+        Serial.printf("Mara X frame rejected: %s\n", toString(result));
       }
-    } else {
-      currentMaraXString[currentIndex] = '\0';
-      currentIndex = 0;
-      Serial.println(currentMaraXString);
     }
   }
+
+  const uint32_t maraXErrors = maraXIngest.getRingBufferOverflowCount() + maraXIngest.getSerialOverflowCount() +
+                               maraXFramer.getTruncatedFrameCount() + maraXFramer.getDiscardedCharCount();
+  if (maraXErrors != reportedMaraXErrors) {
+    reportedMaraXErrors = maraXErrors;
+    Serial.printf("Mara X serial overflows: ring buffer %u, serial %u. Truncated frames: %u, discarded chars: %u\n",
+                  maraXIngest.getRingBufferOverflowCount(), maraXIngest.getSerialOverflowCount(),
+                  maraXFramer.getTruncatedFrameCount(), maraXFramer.getDiscardedCharCount());
+  }
 }
 
 /**
- * @brief Extracts and updates all values received from the mara x.
+ * @brief Updates all values received from the mara x, if a new frame has arrived since the last call.
  *
  * @param currentTimeInSeconds The elapsed time since the tracking was started.
  * It is used in the graph as X axis.
  */
 void updateMaraXValuesInDisplay(unsigned int currentTimeInSeconds) {
-  unsigned int currentValueIndex = 0;
-  auto result = strtok(currentMaraXString, ",");
-
-  unsigned int currentSteamTemp = 0;
-  while (result != NULL) {
-    switch (currentValueIndex) {
-      case 0: break;
-      case 1:
-        // Steam temp in C
-        currentSteamTemp = atoi(result);
-        eInkHelper.drawPixelInGraph(currentTimeInSeconds, currentSteamTemp);
-        break;
-      case 2:
-        // Target Steam temp in C
-        eInkHelper.setSteamTemperature(currentSteamTemp, atoi(result));
-        break;
-      case 3: {
-        // HX temp in C
-        auto hxTemperature = atoi(result);
-        eInkHelper.setHXTemperature(hxTemperature);
-        eInkHelper.drawPixelInGraph(currentTimeInSeconds, hxTemperature);
-      } break;
-      case 5:
-        // Heating On Off
-        eInkHelper.setHeatingStatus(atoi(result));
-        break;
-      default: break;
+  MaraXFrame frame;
+  const uint32_t frameSequence = latestMaraXFrame.read(frame);
+  if (frameSequence == lastDisplayedFrameSequence) {
+    return;
+  }
+  lastDisplayedFrameSequence = frameSequence;
+
+  eInkHelper.addGraphSample(currentTimeInSeconds, frame.steamTemp, frame.hxTemp);
+  eInkHelper.setSteamTemperature(frame.steamTemp, frame.targetSteamTemp);
+  eInkHelper.setHXTemperature(frame.hxTemp);
+  eInkHelper.setHeatingStatus(frame.heatingOn);
+}
+
+/**
+ * @brief Converts a micros() time point of the past to the millis() time base.
+ */
+unsigned long toMillis(uint32_t timeInUs, unsigned long currentMillis, uint32_t currentMicros) {
+  // Time points captured after currentMicros count as now.
+  const int32_t ageInUs = static_cast<int32_t>(currentMicros - timeInUs);
+  return currentMillis - (ageInUs > 0 ? ageInUs / 1000 : 0);
+}
+
+void handlePumpEvent(PumpDetector::Event event, unsigned long currentMillis, uint32_t currentMicros) {
+  switch (event) {
+    case PumpDetector::Event::Started:
+      pumpStartedTime = toMillis(pumpDetector.getStartTime(), currentMillis, currentMicros);
+      pumpRunning = true;
+      pumpRunClassifier.startRun(pumpStartedTime);
+      startPumpRunRecord(pumpStartedTime, currentMillis);
+      Serial.println("Pump started -> Starting shot timer");
+      break;
+    case PumpDetector::Event::Stopped: {
+      pumpStoppedTime = toMillis(pumpDetector.getStopTime(), currentMillis, currentMicros);
+      pumpRunning = false;
+      const PumpRunClassification run = pumpRunClassifier.stopRun(pumpStoppedTime);
+      Serial.printf("Pump stopped after %lu ms -> %s (%u %%, score %d)\n", pumpStoppedTime - pumpStartedTime,
+                    run.kind == PumpRunKind::Shot ? "shot" : "refill, restoring the last shot time", run.confidence,
+                    run.score);
+      Serial.printf("Stop detected %u ms after the last pulse (pulse period %u us)\n",
+                    pumpDetector.getStopLatency() / 1000, pumpDetector.getPulsePeriod());
+      pumpRunRecord.durationInDs = std::min<unsigned long>((pumpStoppedTime - pumpStartedTime) / 100, UINT16_MAX);
+      pumpRunRecord.kind = static_cast<uint8_t>(run.kind);
+      pumpRunRecord.confidence = run.confidence;
+      endedPumpRunRecords.push(pumpRunRecord);
+      break;
     }
-    result = strtok(NULL, ",");
-    currentValueIndex++;
+    case PumpDetector::Event::None: break;
   }
 }
 
+/**
+ * @brief Follows the pump by the edges captured from the reed sensor.
+ *
+ * The times of the edges are taken from the capture, so they do not depend on how often this is called.
+ */
 void handlePump() {
-  // Pump running not yet recognized, input indicates that it is running
   const auto currentMillis = millis();
-  if (!pumpRunning && !digitalRead(reedSensorPin)) {
-    pumpStartedTime = currentMillis;
-    pumpRunning = true;
-    Serial.println("Pump started -> Starting shot timer");
-  }
-
-  // The reed sensor signals 0's and 1's while the pump is running. If we have stored, that the pump is running, but the
-  // reed sensor indicates that it no longer is running, we have to wait a certain threshold to ensure, that the pump
-  // really stopped.
-  if (pumpRunning && digitalRead(reedSensorPin)) {
-    if (pumpStoppedTime == 0) {
-      pumpStoppedTime = currentMillis;
-    }
-    if (currentMillis - pumpStoppedTime > thresholdPumpNoLongerRunning) {
-      pumpRunning = false;
-      pumpStoppedTime = 0;
-      Serial.println("Pump stoped -> Stopping shot timer");
+  const uint32_t currentMicros = micros();
+  ReedEdge edge;
+  while (reedCapture.read(edge)) {
+    handlePumpEvent(pumpDetector.addEdge(edge), currentMillis, currentMicros);
+  }
+  handlePumpEvent(pumpDetector.update(currentMicros), currentMillis, currentMicros);
+
+  if (reedCapture.getOverflowCount() != reportedReedOverflows) {
+    reportedReedOverflows = reedCapture.getOverflowCount();
+    Serial.printf("Reed sensor edges dropped: %u\n", reportedReedOverflows);
+  }
+}
+
+/**
+ * @brief Stores the latest values in the history once per second.
+ *
+ * The samples are scheduled by their time, not by the time of the last call, so the history stays at exactly 1 Hz.
+ */
+void handleHistory(const unsigned long &currentMillis) {
+  MaraXFrame frame;
+  while ((currentMillis - timePointMeteringStarted) / 1000 >= nextHistoryTimeInSeconds) {
+    if (latestMaraXFrame.read(frame) != 0) {
+      temperatureHistory.append(nextHistoryTimeInSeconds,
+                                HistorySample{ frame.steamTemp, frame.hxTemp, frame.heatingOn, pumpRunning });
     }
-  } else {
-    pumpStoppedTime = 0;
+    nextHistoryTimeInSeconds++;
+  }
+}
+
+/**
+ * @brief Detects the power loss of the machine by the drop of the supply voltage.
+ *
+ * A running display refresh is cut short, so that the remaining energy is left for clearing the display.
+ */
+void checkSupplyVoltage() {
+  const uint16_t voltage = ESP.getVcc();
+  maxVoltage = std::max(maxVoltage, voltage);
+  if ((maxVoltage - voltage) > 500 && !powerLossDetected) {
+    powerLossDetected = true;
+    eInkHelper.abortRefresh();
+  }
+}
+
+/**
+ * @brief Runs everything, which must not wait for the display.
+ *
+ * Besides from the loop, it is called while the display refreshes, which blocks for several hundred ms.
+ */
+void handleTimeCriticalTasks() {
+  const auto currentMillis = millis();
+  if (lastTimeCriticalTasksRun != 0 && currentMillis - lastTimeCriticalTasksRun > maxTimeCriticalTasksGap) {
+    maxTimeCriticalTasksGap = currentMillis - lastTimeCriticalTasksRun;
+    Serial.printf("Worst case latency of the time critical tasks: %lu ms\n", maxTimeCriticalTasksGap);
   }
+  lastTimeCriticalTasksRun = currentMillis;
+
+  checkSupplyVoltage();
+  readMaraXSerial();
+  handlePump();
+  handleHistory(currentMillis);
 }
 
 /**
@@ -201,24 +371,67 @@ void handlePump() {
  */
 void handleDisplayUpdate(const unsigned long &currentMillis) {
   if ((currentMillis - lastDisplayUpdate) > displayUpdateFrequency) {
-    updateMaraXValuesInDisplay(static_cast<float>(currentMillis - timePointSetupFinished) / 1000.0);
+    updateMaraXValuesInDisplay(static_cast<float>(currentMillis - timePointMeteringStarted) / 1000.0);
     lastDisplayUpdate = currentMillis;
+    // During a shot, only the shot timer is refreshed. The values drawn meanwhile are shown after the shot.
+    if (eInkHelper.isInShotMode()) {
+      return;
+    }
     eInkHelper.updateWindow();
   }
 }
 
+/**
+ * @brief Handles single char commands sent via the serial monitor.
+ *
+ * 'f' prints the content of the display as PBM (see tools/capture_framebuffer.py), 't' the render timings, 'l' the
+ * shot log and 'h' the temperature history of the last historyDumpInS as CSV.
+ */
+void handleSerialCommands() {
+  while (Serial.available() > 0) {
+    switch (Serial.read()) {
+      case 'f': eInkHelper.printFrameBuffer(Serial); break;
+      case 't': eInkHelper.printRenderTimings(Serial); break;
+      case 'l': shotLog.dump(Serial); break;
+      case 'h': {
+        const uint32_t lastTime = temperatureHistory.getLastTime();
+        temperatureHistory.dump(Serial, lastTime > historyDumpInS ? lastTime - historyDumpInS : 0, lastTime);
+        break;
+      }
+      default: break;
+    }
+  }
+}
+
+/**
+ * @brief Proceeds with the wifi connection and handles OTA updates, once connected.
+ */
+void handleNetwork() {
+  wifiConnection.handle(millis());
+  if (!otaStarted && wifiConnection.isConnected()) {
+    setupOTA();
+    otaStarted = true;
+  }
+  if (otaStarted) {
+    ArduinoOTA.handle();
+  }
+}
+
 void loop() {
   if (eInkHelper.isDisplayAwake()) {
-    maxVoltage = std::max(maxVoltage, ESP.getVcc());
-    readMaraXSerial();
-    handlePump();
+    handleTimeCriticalTasks();
     const auto currentMillis = millis();
-    if ((maxVoltage - ESP.getVcc()) > 500) {
+    if (powerLossDetected) {
       eInkHelper.goToSleep();
     } else {
-      eInkHelper.handleShotTimer(pumpRunning, currentMillis, pumpStartedTime);
+      // While running, it is not known yet, whether it is a shot. So every run is counted.
+      eInkHelper.handleShotTimer(pumpRunning, currentMillis,
+                                 pumpRunning ? pumpStartedTime : pumpRunClassifier.getLastShotStartTime(),
+                                 pumpRunClassifier.getLastShotStopTime());
       handleDisplayUpdate(currentMillis);
+      handleShotLog();
     }
+    handleSerialCommands();
   }
-  ArduinoOTA.handle();
+  handleNetwork();
 }
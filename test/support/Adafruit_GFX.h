@@ -0,0 +1,263 @@
+#pragma once
+#include <Arduino.h>
+#include <gfxfont.h>
+
+/**
+ * @brief Host version of the parts of Adafruit GFX used by the meter.
+ *
+ * The library itself does not build on the host, as it depends on the SPI and I2C drivers of the Arduino core. Lines,
+ * rectangles and custom fonts are drawn with the same algorithms as in Adafruit GFX, so their pixels match the
+ * device. The built-in 5x7 font is replaced by classicFont below, which only holds the chars of the labels.
+ */
+class Adafruit_GFX : public Print {
+ public:
+  Adafruit_GFX(int16_t w, int16_t h)
+      : _width{ w },
+        _height{ h },
+        cursor_x{ 0 },
+        cursor_y{ 0 },
+        textcolor{ 0xFFFF },
+        wrap{ true },
+        gfxFont{ nullptr } {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+  virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { writeLine(x, y, x, y + h - 1, color); }
+
+  virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { writeLine(x, y, x + w - 1, y, color); }
+
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    for (int16_t i = x; i < x + w; i++) {
+      drawFastVLine(i, y, h, color);
+    }
+  }
+
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    if (x0 == x1) {
+      if (y0 > y1) swap(y0, y1);
+      drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    } else if (y0 == y1) {
+      if (x0 > x1) swap(x0, x1);
+      drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    } else {
+      writeLine(x0, y0, x1, y1, color);
+    }
+  }
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+  }
+
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+    const int16_t maxRadius = ((w < h) ? w : h) / 2;
+    if (r > maxRadius) r = maxRadius;
+    drawFastHLine(x + r, y, w - 2 * r, color);
+    drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+    drawFastVLine(x, y + r, h - 2 * r, color);
+    drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+    drawCircleHelper(x + r, y + r, r, 1, color);
+    drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+    drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+    drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+  }
+
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+    const int16_t byteWidth = (w + 7) / 8;
+    uint8_t bits = 0;
+    for (int16_t j = 0; j < h; j++, y++) {
+      for (int16_t i = 0; i < w; i++) {
+        if (i & 7) {
+          bits <<= 1;
+        } else {
+          bits = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+        }
+        if (bits & 0x80) drawPixel(x + i, y, color);
+      }
+    }
+  }
+
+  void setCursor(int16_t x, int16_t y) {
+    cursor_x = x;
+    cursor_y = y;
+  }
+  int16_t getCursorX() const { return cursor_x; }
+  int16_t getCursorY() const { return cursor_y; }
+  void setTextColor(uint16_t color) { textcolor = color; }
+  void setTextWrap(bool wrapText) { wrap = wrapText; }
+
+  void setFont(const GFXfont *font) {
+    // Custom fonts are positioned at the baseline, the built-in one at the top left corner.
+    if (font != nullptr && gfxFont == nullptr) {
+      cursor_y += 6;
+    } else if (font == nullptr && gfxFont != nullptr) {
+      cursor_y -= 6;
+    }
+    gfxFont = font;
+  }
+
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  size_t write(uint8_t c) override {
+    if (gfxFont == nullptr) {
+      if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += 8;
+      } else if (c != '\r') {
+        if (wrap && cursor_x + 6 > _width) {
+          cursor_x = 0;
+          cursor_y += 8;
+        }
+        drawClassicChar(cursor_x, cursor_y, c, textcolor);
+        cursor_x += 6;
+      }
+      return 1;
+    }
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += gfxFont->yAdvance;
+    } else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+      const GFXglyph &glyph = gfxFont->glyph[c - gfxFont->first];
+      if (glyph.width > 0 && glyph.height > 0) {
+        if (wrap && cursor_x + glyph.xOffset + glyph.width > _width) {
+          cursor_x = 0;
+          cursor_y += gfxFont->yAdvance;
+        }
+        drawFontChar(cursor_x, cursor_y, glyph, textcolor);
+      }
+      cursor_x += glyph.xAdvance;
+    }
+    return 1;
+  }
+  using Print::write;
+
+ protected:
+  const int16_t _width;
+  const int16_t _height;
+  int16_t cursor_x;
+  int16_t cursor_y;
+  uint16_t textcolor;
+  bool wrap;
+  const GFXfont *gfxFont;
+
+ private:
+  static void swap(int16_t &a, int16_t &b) {
+    const int16_t t = a;
+    a = b;
+    b = t;
+  }
+
+  /// Bresenham as in Adafruit_GFX::writeLine().
+  void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    const bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+      swap(x0, y0);
+      swap(x1, y1);
+    }
+    if (x0 > x1) {
+      swap(x0, x1);
+      swap(y0, y1);
+    }
+    const int16_t dx = x1 - x0;
+    const int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    const int16_t ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+      if (steep) {
+        drawPixel(y0, x0, color);
+      } else {
+        drawPixel(x0, y0, color);
+      }
+      err -= dy;
+      if (err < 0) {
+        y0 += ystep;
+        err += dx;
+      }
+    }
+  }
+
+  void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+      if (corners & 0x4) {
+        drawPixel(x0 + x, y0 + y, color);
+        drawPixel(x0 + y, y0 + x, color);
+      }
+      if (corners & 0x2) {
+        drawPixel(x0 + x, y0 - y, color);
+        drawPixel(x0 + y, y0 - x, color);
+      }
+      if (corners & 0x8) {
+        drawPixel(x0 - y, y0 + x, color);
+        drawPixel(x0 - x, y0 + y, color);
+      }
+      if (corners & 0x1) {
+        drawPixel(x0 - y, y0 - x, color);
+        drawPixel(x0 - x, y0 - y, color);
+      }
+    }
+  }
+
+  void drawFontChar(int16_t x, int16_t y, const GFXglyph &glyph, uint16_t color) {
+    uint16_t offset = glyph.bitmapOffset;
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    for (uint8_t yy = 0; yy < glyph.height; yy++) {
+      for (uint8_t xx = 0; xx < glyph.width; xx++) {
+        if (!(bit++ & 7)) bits = gfxFont->bitmap[offset++];
+        if (bits & 0x80) drawPixel(x + glyph.xOffset + xx, y + glyph.yOffset + yy, color);
+        bits <<= 1;
+      }
+    }
+  }
+
+  void drawClassicChar(int16_t x, int16_t y, uint8_t c, uint16_t color) {
+    const uint8_t *columns = findClassicGlyph(c);
+    if (columns == nullptr) {
+      return;
+    }
+    for (int8_t i = 0; i < 5; i++) {
+      uint8_t line = columns[i];
+      for (int8_t j = 0; j < 8; j++, line >>= 1) {
+        if (line & 1) drawPixel(x + i, y + j, color);
+      }
+    }
+  }
+
+  /**
+   * @brief The 5 columns (LSB at the top) of a char of the built-in font or nullptr, if it is not available.
+   */
+  static const uint8_t *findClassicGlyph(uint8_t c) {
+    static constexpr char chars[] = "0123456789/CHSTXaegimnrt";
+    static constexpr uint8_t classicFont[][5] = {
+      { 0x3E, 0x51, 0x49, 0x45, 0x3E }, { 0x00, 0x42, 0x7F, 0x40, 0x00 }, { 0x72, 0x49, 0x49, 0x49, 0x46 },
+      { 0x21, 0x41, 0x49, 0x4D, 0x33 }, { 0x18, 0x14, 0x12, 0x7F, 0x10 }, { 0x27, 0x45, 0x45, 0x45, 0x39 },
+      { 0x3C, 0x4A, 0x49, 0x49, 0x31 }, { 0x41, 0x21, 0x11, 0x09, 0x07 }, { 0x36, 0x49, 0x49, 0x49, 0x36 },
+      { 0x46, 0x49, 0x49, 0x29, 0x1E }, { 0x20, 0x10, 0x08, 0x04, 0x02 }, { 0x3E, 0x41, 0x41, 0x41, 0x22 },
+      { 0x7F, 0x08, 0x08, 0x08, 0x7F }, { 0x26, 0x49, 0x49, 0x49, 0x32 }, { 0x01, 0x01, 0x7F, 0x01, 0x01 },
+      { 0x63, 0x14, 0x08, 0x14, 0x63 }, { 0x20, 0x54, 0x54, 0x78, 0x40 }, { 0x38, 0x54, 0x54, 0x54, 0x18 },
+      { 0x18, 0xA4, 0xA4, 0x9C, 0x78 }, { 0x00, 0x44, 0x7D, 0x40, 0x00 }, { 0x7C, 0x04, 0x78, 0x04, 0x78 },
+      { 0x7C, 0x08, 0x04, 0x04, 0x78 }, { 0x7C, 0x08, 0x04, 0x04, 0x08 }, { 0x04, 0x3F, 0x44, 0x40, 0x20 },
+    };
+    static_assert(sizeof(chars) - 1 == sizeof(classicFont) / sizeof(classicFont[0]), "One glyph per char");
+    const char *found = c != '\0' ? strchr(chars, c) : nullptr;
+    return found != nullptr ? classicFont[found - chars] : nullptr;
+  }
+};
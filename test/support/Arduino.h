@@ -0,0 +1,55 @@
+#pragma once
+#include <Print.h>
+#include <chrono>
+#include <pgmspace.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Host version of the parts of the Arduino core used by the libraries of the meter (env:native).
+ *
+ * millis() and micros() run on the clock of the host. The pin and timer functions only exist, so the hardware capture
+ * classes compile. Nothing is emulated by them.
+ */
+
+#define LOW 0x0
+#define HIGH 0x1
+#define INPUT 0x00
+#define INPUT_PULLDOWN_16 0x04
+#define CHANGE 0x03
+#define IRAM_ATTR
+#define SS 15
+
+#define TIM_DIV16 0
+#define TIM_EDGE 0
+#define TIM_LOOP 1
+
+inline unsigned long micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+inline unsigned long millis() { return micros() / 1000; }
+inline void yield() {}
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void attachInterruptArg(uint8_t, void (*)(void *), void *, int) {}
+inline void timer1_isr_init() {}
+inline void timer1_attachInterrupt(void (*)()) {}
+inline void timer1_enable(uint8_t, uint8_t, uint8_t) {}
+inline void timer1_write(uint32_t) {}
+
+/**
+ * @brief Prints to stdout, where the test runner shows it.
+ */
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long) {}
+  size_t write(uint8_t character) override { return fputc(character, stdout) == EOF ? 0 : 1; }
+  using Print::write;
+};
+
+inline HardwareSerial Serial;
@@ -0,0 +1,181 @@
+#pragma once
+#include <GxEPD2.h>
+#include <Pbm.hpp>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Host stand-in for the GxEPD2 panel driver, which captures everything pushed to the panel.
+ *
+ * Like the controller, it holds the transferred image and the previous one in two RAM buffers. A refresh shows the
+ * transferred image within the refreshed window and calls the busy callback a few times, as if BUSY was polled. Every
+ * refresh is recorded with its window and the content of the panel afterwards.
+ *
+ * If the environment variable EINK_CAPTURE_DIR is set, the window of every refresh is written there as PBM, numbered in
+ * order of the refreshes.
+ *
+ * @tparam Width The width of the panel in pixels.
+ * @tparam Height The height of the panel in pixels.
+ */
+template <uint16_t Width, uint16_t Height>
+class CapturePanel {
+ public:
+  static const uint16_t WIDTH = Width;
+  static const uint16_t HEIGHT = Height;
+  /// How often the busy callback is called per refresh.
+  static constexpr uint8_t busyPollsPerRefresh = 3;
+
+  struct Refresh {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    bool full;
+    /// The content of the whole panel after the refresh.
+    std::vector<uint8_t> shown;
+
+    PbmImage getImage() const { return PbmImage::fromFrameBuffer(shown.data(), Width, x, y, w, h); }
+  };
+
+  CapturePanel(int16_t, int16_t, int16_t, int16_t)
+      : transferred(bufferSize, 0xFF),
+        previous(bufferSize, 0xFF),
+        shown(bufferSize, 0xFF),
+        busyCallback{ nullptr },
+        busyCallbackParameter{ nullptr } {
+    lastInstance = this;
+  }
+
+  ~CapturePanel() {
+    if (lastInstance == this) {
+      lastInstance = nullptr;
+    }
+  }
+
+  /**
+   * @brief The panel created last, i.e. the one of the EInkHelper under test.
+   */
+  static CapturePanel *getLastInstance() { return lastInstance; }
+
+  void init(uint32_t) {}
+
+  void setBusyCallback(void (*callback)(const void *), const void *parameter = nullptr) {
+    busyCallback = callback;
+    busyCallbackParameter = parameter;
+  }
+
+  void writeScreenBuffer(uint8_t value = 0xFF) {
+    transferred.assign(bufferSize, value);
+    previous.assign(bufferSize, value);
+  }
+
+  void clearScreen(uint8_t value = 0xFF) {
+    writeScreenBuffer(value);
+    refresh(false);
+  }
+
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool = false, bool = false,
+                  bool = false) {
+    copy(transferred, bitmap, 0, 0, w, x, y, w, h);
+  }
+
+  void writeImagePart(const uint8_t bitmap[], int16_t xPart, int16_t yPart, int16_t wBitmap, int16_t, int16_t x,
+                      int16_t y, int16_t w, int16_t h, bool = false, bool = false, bool = false) {
+    copy(transferred, bitmap, xPart, yPart, wBitmap, x, y, w, h);
+  }
+
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t xPart, int16_t yPart, int16_t wBitmap, int16_t,
+                           int16_t x, int16_t y, int16_t w, int16_t h, bool = false, bool = false, bool = false) {
+    copy(transferred, bitmap, xPart, yPart, wBitmap, x, y, w, h);
+    copy(previous, bitmap, xPart, yPart, wBitmap, x, y, w, h);
+  }
+
+  void refresh(bool) {
+    shown = transferred;
+    record(0, 0, Width, Height, true);
+  }
+
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+    for (int16_t row = y; row < y + h; ++row) {
+      for (int16_t column = x; column < x + w; ++column) {
+        setPixel(shown, column, row, isWhite(transferred, column, row));
+      }
+    }
+    record(x, y, w, h, false);
+  }
+
+  void powerOff() {}
+
+  const std::vector<Refresh> &getRefreshes() const { return refreshes; }
+
+  void clearRefreshes() { refreshes.clear(); }
+
+  /**
+   * @brief The content of the panel within the rectangle.
+   */
+  PbmImage getShownImage(int16_t x = 0, int16_t y = 0, int16_t w = Width, int16_t h = Height) const {
+    return PbmImage::fromFrameBuffer(shown.data(), Width, x, y, w, h);
+  }
+
+  /**
+   * @brief Whether both RAM buffers of the controller hold the shown content, as needed for the next partial refresh.
+   */
+  bool isInSync() const { return transferred == shown && previous == shown; }
+
+ private:
+  static constexpr size_t bufferSize = Width / 8 * Height;
+
+  static bool isWhite(const std::vector<uint8_t> &buffer, int16_t x, int16_t y) {
+    return buffer[y * (Width / 8) + x / 8] & (0x80 >> (x % 8));
+  }
+
+  static void setPixel(std::vector<uint8_t> &buffer, int16_t x, int16_t y, bool white) {
+    uint8_t &pixelByte = buffer[y * (Width / 8) + x / 8];
+    if (white) {
+      pixelByte |= 0x80 >> (x % 8);
+    } else {
+      pixelByte &= ~(0x80 >> (x % 8));
+    }
+  }
+
+  static void copy(std::vector<uint8_t> &buffer, const uint8_t bitmap[], int16_t xPart, int16_t yPart,
+                   int16_t wBitmap, int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (x < 0 || y < 0 || x + w > Width || y + h > Height) {
+      fprintf(stderr, "CapturePanel: window %d,%d %dx%d exceeds the panel\n", x, y, w, h);
+      abort();
+    }
+    for (int16_t row = 0; row < h; ++row) {
+      for (int16_t column = 0; column < w; ++column) {
+        const int16_t xInBitmap = xPart + column;
+        const bool white = bitmap[(yPart + row) * ((wBitmap + 7) / 8) + xInBitmap / 8] & (0x80 >> (xInBitmap % 8));
+        setPixel(buffer, x + column, y + row, white);
+      }
+    }
+  }
+
+  void record(int16_t x, int16_t y, int16_t w, int16_t h, bool full) {
+    refreshes.push_back(Refresh{ x, y, w, h, full, shown });
+    const char *captureDirectory = getenv("EINK_CAPTURE_DIR");
+    if (captureDirectory != nullptr) {
+      char name[64];
+      snprintf(name, sizeof(name), "/%04u-%s-%d-%d-%dx%d.pbm", nrCaptured++, full ? "full" : "window", x, y, w, h);
+      refreshes.back().getImage().write(captureDirectory + std::string(name));
+    }
+    for (uint8_t i = 0; busyCallback != nullptr && i < busyPollsPerRefresh; ++i) {
+      busyCallback(busyCallbackParameter);
+    }
+  }
+
+  std::vector<uint8_t> transferred;
+  std::vector<uint8_t> previous;
+  std::vector<uint8_t> shown;
+  std::vector<Refresh> refreshes;
+  void (*busyCallback)(const void *);
+  const void *busyCallbackParameter;
+
+  static inline CapturePanel *lastInstance = nullptr;
+  static inline unsigned nrCaptured = 0;
+};
@@ -0,0 +1,124 @@
+#pragma once
+#include <Adafruit_GFX.h>
+
+// Host stand-in for the font of Adafruit GFX, which is not available on the host. Holds the digits as seven-segment
+// shapes, '/' and ' ' only, which is what the info bar needs. The metrics are close to FreeSerif12pt7b.
+
+const uint8_t FreeSerif12pt7bBitmaps[] PROGMEM = {
+  0x02, 0x04, 0x18, 0x30, 0x61, 0x83, 0x0C, 0x18, 0x30, 0xC1, 0x83, 0x0C, 0x18, 0x60, 0xC0, 0xFF,
+  0xFF, 0xFC, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x7F, 0xDF, 0xF0, 0x0C, 0x03,
+  0x00, 0xC0, 0x30, 0x0D, 0xFF, 0xFF, 0xF0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFE, 0xFF,
+  0x80, 0x7F, 0xDF, 0xF0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0D, 0xFF, 0x7F, 0xC0, 0x30, 0x0C, 0x03,
+  0x00, 0xC0, 0x30, 0x0D, 0xFF, 0x7F, 0xC0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0xFF, 0xFF, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0xFF, 0xBF, 0xEC,
+  0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFE, 0xFF, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0D,
+  0xFF, 0x7F, 0xC0, 0xFF, 0xBF, 0xEC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFE, 0xFF, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0xFF, 0xFF, 0xC0, 0x7F, 0xDF, 0xF0, 0x0C, 0x03, 0x00, 0xC0,
+  0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0xFF,
+  0xFF, 0xFC, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0xFF, 0xFF, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFC, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0xFF, 0xFF,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0D, 0xFF, 0x7F, 0xC0
+};
+
+const GFXglyph FreeSerif12pt7bGlyphs[] PROGMEM = {
+  { 0, 0, 0, 6, 0, 1 },  // ' '
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0, 0 },
+  { 0, 7, 17, 8, 0, -17 },  // '/'
+  { 15, 10, 17, 12, 1, -17 },  // '0'
+  { 37, 10, 17, 12, 1, -17 },  // '1'
+  { 59, 10, 17, 12, 1, -17 },  // '2'
+  { 81, 10, 17, 12, 1, -17 },  // '3'
+  { 103, 10, 17, 12, 1, -17 },  // '4'
+  { 125, 10, 17, 12, 1, -17 },  // '5'
+  { 147, 10, 17, 12, 1, -17 },  // '6'
+  { 169, 10, 17, 12, 1, -17 },  // '7'
+  { 191, 10, 17, 12, 1, -17 },  // '8'
+  { 213, 10, 17, 12, 1, -17 },  // '9'
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 },
+  { 235, 0, 0, 0, 0, 0 }
+};
+
+const GFXfont FreeSerif12pt7b PROGMEM = { (uint8_t *)FreeSerif12pt7bBitmaps, (GFXglyph *)FreeSerif12pt7bGlyphs,
+                                          0x20, 0x7E, 29 };
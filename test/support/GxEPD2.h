@@ -0,0 +1,5 @@
+#pragma once
+
+// The colors of GxEPD2. The panel itself is replaced by CapturePanel.hpp on the host.
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
@@ -0,0 +1,120 @@
+#pragma once
+#include <Print.h>
+#include <map>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+/**
+ * Host version of LittleFS and the String class of the Arduino core, as far as the shot log uses them (env:native).
+ *
+ * The files are kept in memory. Tests may change them directly via LittleFS.files, e.g. to cut off the end of a file
+ * like a power cut while writing would.
+ */
+
+class String {
+ public:
+  String(const char *text = "") : text{ text } {}
+  String(std::string text) : text{ std::move(text) } {}
+
+  String operator+(const char *other) const { return String(text + other); }
+  String operator+(char other) const { return String(text + other); }
+  String operator+(uint32_t other) const { return String(text + std::to_string(other)); }
+
+  long toInt() const { return atol(text.c_str()); }
+  const char *c_str() const { return text.c_str(); }
+
+ private:
+  std::string text;
+};
+
+using FileContent = std::vector<uint8_t>;
+
+class File {
+ public:
+  File() : content{ nullptr }, position{ 0 } {}
+  File(FileContent *content, size_t position) : content{ content }, position{ position } {}
+
+  explicit operator bool() const { return content != nullptr; }
+
+  size_t read(uint8_t *buffer, size_t size) {
+    const size_t available = content->size() - position;
+    const size_t length = size < available ? size : available;
+    memcpy(buffer, content->data() + position, length);
+    position += length;
+    return length;
+  }
+
+  size_t write(const uint8_t *buffer, size_t size) {
+    content->insert(content->end(), buffer, buffer + size);
+    position = content->size();
+    return size;
+  }
+
+  bool seek(size_t newPosition) {
+    if (newPosition > content->size()) {
+      return false;
+    }
+    position = newPosition;
+    return true;
+  }
+
+  size_t size() const { return content->size(); }
+  void close() { content = nullptr; }
+
+ private:
+  FileContent *content;
+  size_t position;
+};
+
+class Dir {
+ public:
+  Dir(std::vector<std::pair<std::string, size_t>> entries) : entries{ std::move(entries) }, index{ 0 } {}
+
+  bool next() { return ++index <= entries.size(); }
+  String fileName() const { return String(entries[index - 1].first); }
+  size_t fileSize() const { return entries[index - 1].second; }
+
+ private:
+  /// The names within the directory and the sizes of the files.
+  std::vector<std::pair<std::string, size_t>> entries;
+  size_t index;
+};
+
+class FS {
+ public:
+  bool begin() { return available; }
+  bool mkdir(const char *) { return true; }
+
+  /**
+   * @param mode "r" to read or "a" to append. Appending creates the file.
+   */
+  File open(const String &path, const char *mode) {
+    const auto found = files.find(path.c_str());
+    if (mode[0] == 'a') {
+      FileContent &content = files[path.c_str()];
+      return File(&content, content.size());
+    }
+    return found == files.end() ? File() : File(&found->second, 0);
+  }
+
+  Dir openDir(const char *directory) {
+    const std::string prefix = std::string(directory) + '/';
+    std::vector<std::pair<std::string, size_t>> entries;
+    for (const auto &file : files) {
+      if (file.first.compare(0, prefix.size(), prefix) == 0) {
+        entries.emplace_back(file.first.substr(prefix.size()), file.second.size());
+      }
+    }
+    return Dir(entries);
+  }
+
+  bool remove(const String &path) { return files.erase(path.c_str()) > 0; }
+
+  /// Whether begin() succeeds.
+  bool available = true;
+  std::map<std::string, FileContent> files;
+};
+
+inline FS LittleFS;
@@ -0,0 +1,81 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+/**
+ * @brief A 1bpp image as stored in a binary PBM (P4): rows padded to whole bytes, MSB first, 1 = black.
+ */
+struct PbmImage {
+  int16_t width = 0;
+  int16_t height = 0;
+  std::vector<uint8_t> data;
+
+  int16_t bytesPerRow() const { return (width + 7) / 8; }
+
+  bool isBlack(int16_t x, int16_t y) const { return data[y * bytesPerRow() + x / 8] & (0x80 >> (x % 8)); }
+
+  bool operator==(const PbmImage &other) const {
+    return width == other.width && height == other.height && data == other.data;
+  }
+
+  /**
+   * @brief Number of pixels, which differ from the other image of the same size.
+   */
+  uint32_t countDifferences(const PbmImage &other) const {
+    uint32_t differences = 0;
+    for (size_t i = 0; i < data.size() && i < other.data.size(); ++i) {
+      differences += __builtin_popcount(data[i] ^ other.data[i]);
+    }
+    return differences;
+  }
+
+  /**
+   * @brief Cuts a rectangle out of a framebuffer in the format of the e-ink controller (MSB first, 1 = white).
+   */
+  static PbmImage fromFrameBuffer(const uint8_t *buffer, int16_t bufferWidth, int16_t x, int16_t y, int16_t w,
+                                  int16_t h) {
+    PbmImage image;
+    image.width = w;
+    image.height = h;
+    image.data.assign(image.bytesPerRow() * h, 0);
+    for (int16_t row = 0; row < h; ++row) {
+      for (int16_t column = 0; column < w; ++column) {
+        const int16_t xInBuffer = x + column;
+        const bool white = buffer[(y + row) * (bufferWidth / 8) + xInBuffer / 8] & (0x80 >> (xInBuffer % 8));
+        if (!white) {
+          image.data[row * image.bytesPerRow() + column / 8] |= 0x80 >> (column % 8);
+        }
+      }
+    }
+    return image;
+  }
+
+  bool write(const std::string &path) const {
+    FILE *file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+      return false;
+    }
+    fprintf(file, "P4\n%d %d\n", width, height);
+    const bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+    fclose(file);
+    return written;
+  }
+
+  bool read(const std::string &path) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+      return false;
+    }
+    int fileWidth = 0;
+    int fileHeight = 0;
+    const bool header = fscanf(file, "P4 %d %d", &fileWidth, &fileHeight) == 2 && fgetc(file) != EOF;
+    width = fileWidth;
+    height = fileHeight;
+    data.assign(bytesPerRow() * height, 0);
+    const bool complete = header && fread(data.data(), 1, data.size(), file) == data.size();
+    fclose(file);
+    return complete;
+  }
+};
@@ -0,0 +1,49 @@
+#pragma once
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief Host version of the Print class of the Arduino core. Only the parts used by the meter.
+ */
+class Print {
+ public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t character) = 0;
+
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t written = 0;
+    while (size-- > 0) {
+      written += write(*buffer++);
+    }
+    return written;
+  }
+
+  size_t write(const char *text) { return write(reinterpret_cast<const uint8_t *>(text), strlen(text)); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+    char text[256];
+    va_list arguments;
+    va_start(arguments, format);
+    const int length = vsnprintf(text, sizeof(text), format, arguments);
+    va_end(arguments);
+    return length > 0 ? write(text) : 0;
+  }
+
+  size_t print(const char *text) { return write(text); }
+  size_t print(char character) { return write(static_cast<uint8_t>(character)); }
+  size_t print(unsigned long value) { return printf("%lu", value); }
+  size_t print(long value) { return printf("%ld", value); }
+  size_t print(unsigned int value) { return print(static_cast<unsigned long>(value)); }
+  size_t print(int value) { return print(static_cast<long>(value)); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T>
+  size_t println(T value) {
+    const size_t written = print(value);
+    return written + println();
+  }
+};
@@ -0,0 +1,16 @@
+#pragma once
+#include <Arduino.h>
+
+#define SWSERIAL_8N1 0
+
+/**
+ * @brief Host version of the software serial of the ESP8266 core. Never receives anything.
+ */
+class SoftwareSerial {
+ public:
+  SoftwareSerial(int8_t, int8_t) {}
+  void begin(uint32_t, int, int8_t, int8_t, bool, int) {}
+  bool overflow() { return false; }
+  int available() { return 0; }
+  int read() { return -1; }
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief Host version of the Ticker of the ESP8266 core. Never calls the callback.
+ */
+class Ticker {
+ public:
+  template <typename Argument>
+  void attach_ms(uint32_t, void (*)(Argument), Argument) {}
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+
+// The host has no separate program memory.
+#define PROGMEM
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t *>(address))
+#define pgm_read_word(address) (*reinterpret_cast<const uint16_t *>(address))
+#define pgm_read_dword(address) (*reinterpret_cast<const uint32_t *>(address))
+#define pgm_read_ptr(address) (*reinterpret_cast<const void *const *>(address))
+#define memcpy_P memcpy
@@ -0,0 +1,234 @@
+#include <EInkHelper.hpp>
+#include <PackBitsReader.hpp>
+#include <Pbm.hpp>
+#include <bootscreen.h>
+#include <stdlib.h>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+/**
+ * Renders the meter into CapturePanel and compares what the panel shows with the golden images in golden/.
+ *
+ * Run with the environment variable UPDATE_GOLDEN=1 to write the golden images instead, after an intended change of the
+ * display. A mismatching image is written next to its golden image as <name>.actual.pbm.
+ */
+
+using Panel = EInkPanel;
+
+static EInkHelper *helper = nullptr;
+
+static Panel &panel() { return *Panel::getLastInstance(); }
+
+static void assertMatchesGolden(const PbmImage &image, const char *name) {
+  const std::string path = std::string("test/test_display/golden/") + name;
+  if (getenv("UPDATE_GOLDEN") != nullptr) {
+    TEST_ASSERT_TRUE_MESSAGE(image.write(path + ".pbm"), "Cannot write the golden image");
+    TEST_MESSAGE(("Updated " + path + ".pbm").c_str());
+    return;
+  }
+  PbmImage golden;
+  if (!golden.read(path + ".pbm")) {
+    TEST_FAIL_MESSAGE(("Missing golden image " + path + ".pbm. Create it with UPDATE_GOLDEN=1").c_str());
+  }
+  if (!(image == golden)) {
+    image.write(path + ".actual.pbm");
+    char message[160];
+    snprintf(message, sizeof(message), "%u pixels differ from %s.pbm, see %s.actual.pbm",
+             image.countDifferences(golden), name, name);
+    TEST_FAIL_MESSAGE(message);
+  }
+}
+
+/**
+ * @brief Collects the output of printFrameBuffer().
+ */
+class PbmCollector : public Print {
+ public:
+  size_t write(uint8_t character) override {
+    bytes.push_back(character);
+    return 1;
+  }
+  using Print::write;
+
+  /// The pixels behind the header of the PBM.
+  std::vector<uint8_t> getPixels() const {
+    const std::string header = "P4\n" + std::to_string(Layout::width) + " " + std::to_string(Layout::height) + "\n";
+    return std::vector<uint8_t>(bytes.begin() + header.size(), bytes.end());
+  }
+
+ private:
+  std::vector<uint8_t> bytes;
+};
+
+void setUp() { helper = new EInkHelper(); }
+
+void tearDown() {
+  delete helper;
+  helper = nullptr;
+}
+
+static void assertPanelShowsFrameBuffer() {
+  PbmCollector frameBuffer;
+  helper->printFrameBuffer(frameBuffer);
+  TEST_ASSERT_TRUE_MESSAGE(frameBuffer.getPixels() == panel().getShownImage().data,
+                           "The panel does not show the framebuffer");
+  TEST_ASSERT_TRUE_MESSAGE(panel().isInSync(), "The RAM of the controller differs from the shown content");
+}
+
+static void drawInfoBar() {
+  helper->setupDisplay(false);
+  helper->setHeatingStatus(true);
+  helper->setHXTemperature(93);
+  helper->setSteamTemperature(116, 124);
+  helper->handleShotTimer(false, 60000, 10000, 37500);
+  helper->updateWindow();
+}
+
+void test_boot_screens() {
+  const struct {
+    const unsigned char *data;
+    size_t size;
+    const char *golden;
+  } pictures[] = {
+    { MrBeanFromBottomRight, sizeof(MrBeanFromBottomRight), "boot_screen_from_bottom_right" },
+    { MrBeanAnticipated, sizeof(MrBeanAnticipated), "boot_screen_anticipated" },
+    { MrBeanSurprised, sizeof(MrBeanSurprised), "boot_screen_surprised" },
+  };
+  constexpr size_t pictureSize = Layout::width / 8 * Layout::height;
+  bool seen[3] = {};
+  for (unsigned int seed = 0; seed < 100 && !(seen[0] && seen[1] && seen[2]); ++seed) {
+    tearDown();
+    setUp();
+    srand(seed);
+    helper->setupDisplay(true);
+    // Cleared, boot screen, cleared again.
+    TEST_ASSERT_EQUAL(3, panel().getRefreshes().size());
+    const Panel::Refresh &bootScreen = panel().getRefreshes()[1];
+    TEST_ASSERT_TRUE(bootScreen.full);
+
+    uint8_t decoded[pictureSize];
+    for (uint8_t i = 0; i < 3; ++i) {
+      PackBitsReader reader(pictures[i].data, pictures[i].size);
+      TEST_ASSERT_EQUAL(pictureSize, reader.read(decoded, sizeof(decoded)));
+      if (!seen[i] && memcmp(decoded, bootScreen.shown.data(), pictureSize) == 0) {
+        seen[i] = true;
+        assertMatchesGolden(bootScreen.getImage(), pictures[i].golden);
+      }
+    }
+  }
+  TEST_ASSERT_TRUE_MESSAGE(seen[0] && seen[1] && seen[2], "Not every boot screen has been shown");
+}
+
+void test_info_bar() {
+  drawInfoBar();
+  assertMatchesGolden(panel().getShownImage(0, 0, Layout::width, Layout::heightInfoBar), "info_bar");
+  assertPanelShowsFrameBuffer();
+  helper->printRenderTimings(Serial);
+}
+
+void test_changed_value_refreshes_only_its_window() {
+  drawInfoBar();
+  panel().clearRefreshes();
+
+  helper->setHXTemperature(94);
+  helper->updateWindow();
+
+  TEST_ASSERT_EQUAL(1, panel().getRefreshes().size());
+  const Panel::Refresh &refresh = panel().getRefreshes()[0];
+  TEST_ASSERT_FALSE(refresh.full);
+  // Within the value area of the HX box, widened to the tiles of the diff.
+  TEST_ASSERT_TRUE(refresh.x >= Layout::xHXInfo - 40 && refresh.x + refresh.w <= Layout::xSteamInfo + 40);
+  TEST_ASSERT_TRUE(refresh.y >= 0 && refresh.y + refresh.h <= Layout::heightInfoBar);
+  // Transferred twice: before the refresh and again afterwards.
+  TEST_ASSERT_EQUAL_UINT32(2 * (refresh.w / 8) * refresh.h, helper->getLastRefreshBytes());
+  TEST_ASSERT_LESS_OR_EQUAL(2 * (Layout::widthHXInfo / 8 + 10) * Layout::heightInfoBar,
+                            helper->getLastRefreshBytes());
+  assertPanelShowsFrameBuffer();
+
+  // Nothing changed, nothing to refresh.
+  panel().clearRefreshes();
+  helper->setHXTemperature(94);
+  helper->updateWindow();
+  TEST_ASSERT_EQUAL(0, panel().getRefreshes().size());
+  TEST_ASSERT_EQUAL_UINT32(0, helper->getLastRefreshBytes());
+}
+
+void test_shot_timer_is_not_refreshed_again_after_the_shot() {
+  drawInfoBar();
+  panel().clearRefreshes();
+  for (unsigned long time = 100000; time <= 103000; time += 500) {
+    helper->handleShotTimer(true, time, 100000, 0);
+  }
+  helper->handleShotTimer(false, 103200, 100000, 103200);
+  // Refreshed at 0, 1, 2 and 3 s and once more, when the pump stopped.
+  TEST_ASSERT_EQUAL(5, panel().getRefreshes().size());
+  assertPanelShowsFrameBuffer();
+
+  panel().clearRefreshes();
+  helper->updateWindow();
+  TEST_ASSERT_EQUAL(0, panel().getRefreshes().size());
+}
+
+void test_shot_timer_in_tenths() {
+  helper->setShotModeRefreshInterval(500);
+  drawInfoBar();
+  panel().clearRefreshes();
+  for (unsigned long time = 100000; time <= 103000; time += 250) {
+    helper->handleShotTimer(true, time, 100000, 0);
+  }
+  // Refreshed at 0.0, 0.5, ... 3.0 s.
+  TEST_ASSERT_EQUAL(7, panel().getRefreshes().size());
+  helper->handleShotTimer(false, 103200, 100000, 103200);
+  TEST_ASSERT_EQUAL(8, panel().getRefreshes().size());
+  assertPanelShowsFrameBuffer();
+}
+
+static void abortRefresh() { helper->abortRefresh(); }
+
+void test_abort_skips_the_remaining_windows() {
+  drawInfoBar();
+  // Two changes far apart, which are refreshed as separate windows.
+  helper->setHXTemperature(94);
+  helper->addGraphSample(2400, 30, 25);
+  helper->addGraphSample(2600, 30, 25);
+  panel().clearRefreshes();
+
+  helper->setRefreshBusyHandler(abortRefresh);
+  helper->updateWindow();
+  TEST_ASSERT_EQUAL(1, panel().getRefreshes().size());
+
+  // The next update is not aborted anymore.
+  helper->setRefreshBusyHandler(nullptr);
+  panel().clearRefreshes();
+  helper->setHXTemperature(95);
+  helper->updateWindow();
+  TEST_ASSERT_EQUAL(1, panel().getRefreshes().size());
+}
+
+void test_graph() {
+  helper->setupDisplay(false);
+  // Heating up after switching the machine on. Beyond 45 min, the time window of the graph is doubled.
+  for (unsigned int time = 0; time <= 3000; time += 5) {
+    const unsigned int steamTemp = time < 1040 ? 20 + time / 10 : 124 - (time / 30) % 5;
+    const unsigned int hxTemp = time < 1460 ? 20 + time / 20 : 93 - (time / 45) % 3;
+    helper->addGraphSample(time, steamTemp, hxTemp);
+  }
+  helper->updateWindow();
+  assertMatchesGolden(
+      panel().getShownImage(0, Layout::y0GraphArea, Layout::width, Layout::height - Layout::y0GraphArea), "graph");
+  assertPanelShowsFrameBuffer();
+  helper->printRenderTimings(Serial);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_screens);
+  RUN_TEST(test_info_bar);
+  RUN_TEST(test_changed_value_refreshes_only_its_window);
+  RUN_TEST(test_shot_timer_is_not_refreshed_again_after_the_shot);
+  RUN_TEST(test_shot_timer_in_tenths);
+  RUN_TEST(test_abort_skips_the_remaining_windows);
+  RUN_TEST(test_graph);
+  return UNITY_END();
+}
@@ -0,0 +1,131 @@
+#include <FrameDiff.hpp>
+#include <chrono>
+#include <stdio.h>
+#include <unity.h>
+
+/**
+ * Checks the regions found by both diff strategies and measures what a scan of the 4.2" framebuffer costs.
+ */
+
+constexpr int16_t width = 400;
+constexpr int16_t height = 300;
+using Shadow = ShadowFrameDiff<width, height>;
+using TileHash = TileHashFrameDiff<width, height, 40, 12>;
+
+alignas(4) static uint8_t buffer[width / 8 * height];
+
+static void setBlack(int16_t x, int16_t y) { buffer[y * (width / 8) + x / 8] &= ~(0x80 >> (x % 8)); }
+
+static void assertRegion(const DirtyRegions &regions, int16_t x, int16_t y, int16_t w, int16_t h) {
+  TEST_ASSERT_EQUAL(1, regions.size());
+  TEST_ASSERT_EQUAL_INT16(x, regions[0].x);
+  TEST_ASSERT_EQUAL_INT16(y, regions[0].y);
+  TEST_ASSERT_EQUAL_INT16(w, regions[0].w);
+  TEST_ASSERT_EQUAL_INT16(h, regions[0].h);
+}
+
+/**
+ * @brief Finds the changes of the current buffer.
+ */
+template <typename Diff>
+static DirtyRegions findChanges(Diff &diff) {
+  DirtyRegions regions;
+  diff.findChanges(buffer, regions);
+  return regions;
+}
+
+/**
+ * @brief Returns the average duration of a scan in ns. Every call sees one changed pixel, like a typical update.
+ */
+template <typename Diff>
+static double measureScan(Diff &diff) {
+  constexpr uint32_t nrRounds = 2000;
+  uint32_t nrRegions = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t round = 0; round < nrRounds; ++round) {
+    buffer[(round * 997) % sizeof(buffer)] ^= 0x10;
+    DirtyRegions regions;
+    diff.findChanges(buffer, regions);
+    nrRegions += regions.size();
+  }
+  const auto duration = std::chrono::steady_clock::now() - start;
+  TEST_ASSERT_EQUAL_UINT32(nrRounds, nrRegions);
+  return std::chrono::duration<double, std::nano>(duration).count() / nrRounds;
+}
+
+void setUp() { memset(buffer, 0xFF, sizeof(buffer)); }
+
+void tearDown() {}
+
+void test_unchanged_buffer_has_no_regions() {
+  static Shadow shadow;
+  static TileHash tileHash;
+  shadow.reset(0xFF);
+  tileHash.reset(0xFF);
+  TEST_ASSERT_TRUE(findChanges(shadow).isEmpty());
+  TEST_ASSERT_TRUE(findChanges(tileHash).isEmpty());
+}
+
+void test_shadow_is_exact_to_bytes() {
+  static Shadow shadow;
+  shadow.reset(0xFF);
+  setBlack(101, 50);
+  setBlack(130, 52);
+  assertRegion(findChanges(shadow), 96, 50, 40, 3);
+  // Taken as pushed.
+  TEST_ASSERT_TRUE(findChanges(shadow).isEmpty());
+}
+
+void test_tile_hash_is_exact_to_tiles() {
+  static TileHash tileHash;
+  tileHash.reset(0xFF);
+  setBlack(101, 50);
+  setBlack(130, 52);
+  assertRegion(findChanges(tileHash), 80, 48, 80, 12);
+  TEST_ASSERT_TRUE(findChanges(tileHash).isEmpty());
+}
+
+void test_take_as_pushed() {
+  static Shadow shadow;
+  static TileHash tileHash;
+  shadow.reset(0xFF);
+  tileHash.reset(0xFF);
+  setBlack(301, 20);
+  const DisplayRegion timerRegion{ 296, 14, 104, 44 };
+  const DisplayRegion shadowRegion = Shadow::align(timerRegion);
+  const DisplayRegion tileRegion = TileHash::align(timerRegion);
+  TEST_ASSERT_EQUAL_INT16(296, shadowRegion.x);
+  TEST_ASSERT_EQUAL_INT16(104, shadowRegion.w);
+  TEST_ASSERT_EQUAL_INT16(280, tileRegion.x);
+  TEST_ASSERT_EQUAL_INT16(12, tileRegion.y);
+  TEST_ASSERT_EQUAL_INT16(120, tileRegion.w);
+  TEST_ASSERT_EQUAL_INT16(48, tileRegion.h);
+  shadow.takeAsPushed(buffer, shadowRegion);
+  tileHash.takeAsPushed(buffer, tileRegion);
+  TEST_ASSERT_TRUE(findChanges(shadow).isEmpty());
+  TEST_ASSERT_TRUE(findChanges(tileHash).isEmpty());
+}
+
+void test_benchmark_scan() {
+  static Shadow shadow;
+  static TileHash tileHash;
+  shadow.reset(0xFF);
+  tileHash.reset(0xFF);
+  const double shadowNs = measureScan(shadow);
+  const double tileHashNs = measureScan(tileHash);
+  char message[160];
+  snprintf(message, sizeof(message),
+           "%dx%d: shadow copy %.0f ns per scan (%u bytes), tile hashes %.0f ns per scan (%u bytes)", width, height,
+           shadowNs, static_cast<unsigned>(sizeof(Shadow)), tileHashNs, static_cast<unsigned>(sizeof(TileHash)));
+  TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_unchanged_buffer_has_no_regions);
+  RUN_TEST(test_shadow_is_exact_to_bytes);
+  RUN_TEST(test_tile_hash_is_exact_to_tiles);
+  RUN_TEST(test_take_as_pushed);
+  RUN_TEST(test_benchmark_scan);
+  return UNITY_END();
+}
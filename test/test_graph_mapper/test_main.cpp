@@ -0,0 +1,118 @@
+#include <GraphMapper.hpp>
+#include <unity.h>
+
+/**
+ * Compares GraphMapper with the float mapping it replaced, in the layout of the 4.2" panel.
+ */
+
+constexpr int16_t x0 = 20;
+constexpr int16_t y0 = 60;
+constexpr int16_t width = 360;
+constexpr int16_t height = 240;
+constexpr unsigned int maxTimeInMin = 45;
+constexpr unsigned int minTemp = 20;
+constexpr unsigned int maxTemp = 140;
+
+/**
+ * @brief The y position as calculated before GraphMapper.
+ */
+static int16_t getYForTempWithFloat(unsigned int temperature) {
+  int16_t yPosPixel = y0 + height;
+  if (temperature <= minTemp) {
+  } else if (temperature >= maxTemp) {
+    yPosPixel = y0;
+  } else {
+    yPosPixel =
+        y0 + height - static_cast<float>(height) / static_cast<float>(maxTemp - minTemp) * temperature + y0 - minTemp;
+  }
+  return yPosPixel;
+}
+
+/**
+ * @brief The x position as calculated before GraphMapper.
+ */
+static int16_t getXForTimeWithFloat(unsigned int timeInSeconds) {
+  if (timeInSeconds >= maxTimeInMin * 60) {
+    return x0 + width;
+  }
+  return static_cast<float>(width) / static_cast<float>(maxTimeInMin) * (static_cast<float>(timeInSeconds) / 60.0) +
+         x0;
+}
+
+static GraphMapper createMapper() { return GraphMapper(x0, y0, width, height, maxTimeInMin * 60, minTemp, maxTemp); }
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_y_for_every_temperature() {
+  const GraphMapper mapper = createMapper();
+  for (unsigned int temperature = minTemp; temperature <= maxTemp; ++temperature) {
+    char message[32];
+    snprintf(message, sizeof(message), "at %u C", temperature);
+    TEST_ASSERT_EQUAL_INT16_MESSAGE(getYForTempWithFloat(temperature), mapper.getYForTemp(temperature), message);
+  }
+  TEST_ASSERT_EQUAL_INT16(y0 + height, mapper.getYForTemp(minTemp));
+  TEST_ASSERT_EQUAL_INT16(y0, mapper.getYForTemp(maxTemp));
+}
+
+void test_y_is_clamped() {
+  const GraphMapper mapper = createMapper();
+  TEST_ASSERT_EQUAL_INT16(y0 + height, mapper.getYForTemp(0));
+  TEST_ASSERT_EQUAL_INT16(y0 + height, mapper.getYForTemp(minTemp - 1));
+  TEST_ASSERT_EQUAL_INT16(y0, mapper.getYForTemp(maxTemp + 1));
+  TEST_ASSERT_EQUAL_INT16(y0, mapper.getYForTemp(GraphMapper::maxSupportedTemp + 1));
+  TEST_ASSERT_EQUAL_INT16(y0, mapper.getYForTemp(UINT32_MAX));
+}
+
+void test_y_is_rounded_for_uneven_scales() {
+  // 7 pixels for 3 degrees.
+  const GraphMapper mapper(0, 0, 100, 7, 100, 10, 13);
+  TEST_ASSERT_EQUAL_INT16(7, mapper.getYForTemp(10));
+  TEST_ASSERT_EQUAL_INT16(5, mapper.getYForTemp(11));
+  TEST_ASSERT_EQUAL_INT16(2, mapper.getYForTemp(12));
+  TEST_ASSERT_EQUAL_INT16(0, mapper.getYForTemp(13));
+}
+
+void test_x_for_every_second() {
+  const GraphMapper mapper = createMapper();
+  unsigned int mismatches = 0;
+  for (unsigned int time = 0; time < maxTimeInMin * 60; ++time) {
+    if (mapper.getXForTime(time) != getXForTimeWithFloat(time)) {
+      ++mismatches;
+    }
+    TEST_ASSERT_EQUAL_UINT16(mapper.getXForTime(time) - x0, mapper.getColumnForTime(time));
+  }
+  TEST_ASSERT_EQUAL_UINT(0, mismatches);
+}
+
+void test_x_is_clamped() {
+  const GraphMapper mapper = createMapper();
+  TEST_ASSERT_EQUAL_INT16(x0, mapper.getXForTime(0));
+  TEST_ASSERT_EQUAL_INT16(x0 + width - 1, mapper.getXForTime(maxTimeInMin * 60 - 1));
+  TEST_ASSERT_EQUAL_INT16(x0 + width, mapper.getXForTime(maxTimeInMin * 60));
+  TEST_ASSERT_EQUAL_INT16(x0 + width, mapper.getXForTime(UINT32_MAX));
+}
+
+void test_x_after_doubling_the_time_window() {
+  GraphMapper mapper = createMapper();
+  // Up to 12 h.
+  for (unsigned int maxTimeInS = 2 * maxTimeInMin * 60; maxTimeInS <= 16 * maxTimeInMin * 60; maxTimeInS *= 2) {
+    mapper.setMaxTime(maxTimeInS);
+    TEST_ASSERT_EQUAL_UINT(maxTimeInS, mapper.getMaxTime());
+    for (unsigned int time = 0; time < maxTimeInS; ++time) {
+      TEST_ASSERT_EQUAL_INT16(x0 + time * width / maxTimeInS, mapper.getXForTime(time));
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_y_for_every_temperature);
+  RUN_TEST(test_y_is_clamped);
+  RUN_TEST(test_y_is_rounded_for_uneven_scales);
+  RUN_TEST(test_x_for_every_second);
+  RUN_TEST(test_x_is_clamped);
+  RUN_TEST(test_x_after_doubling_the_time_window);
+  return UNITY_END();
+}
@@ -0,0 +1,196 @@
+#include <MaraXFrame.hpp>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+
+static MaraXDecodeResult decode(const char *frame, MaraXFrame &decoded) {
+  return decodeMaraXFrame(frame, strlen(frame), decoded);
+}
+
+static MaraXDecodeResult decode(const char *frame) {
+  MaraXFrame decoded;
+  return decode(frame, decoded);
+}
+
+static void assertResult(MaraXDecodeResult expected, const char *frame) {
+  TEST_ASSERT_EQUAL_STRING_MESSAGE(toString(expected), toString(decode(frame)), frame);
+}
+
+/**
+ * @brief The values of a frame as extracted before decodeMaraXFrame(): copied, split by strtok() and read by atoi().
+ */
+struct StrtokValues {
+  int steamTemp;
+  int targetSteamTemp;
+  int hxTemp;
+  int boostCountdown;
+  int heatingOn;
+  int pumpOn;
+};
+
+static void decodeWithStrtok(const char *frame, StrtokValues &values) {
+  // strtok() writes into the string, so the received frame had to be copied.
+  char currentMaraXString[64];
+  strncpy(currentMaraXString, frame, sizeof(currentMaraXString) - 1);
+  currentMaraXString[sizeof(currentMaraXString) - 1] = '\0';
+  unsigned int currentValueIndex = 0;
+  char *result = strtok(currentMaraXString, ",");
+  while (result != NULL) {
+    switch (currentValueIndex) {
+      case 1: values.steamTemp = atoi(result); break;
+      case 2: values.targetSteamTemp = atoi(result); break;
+      case 3: values.hxTemp = atoi(result); break;
+      case 4: values.boostCountdown = atoi(result); break;
+      case 5: values.heatingOn = atoi(result); break;
+      case 6: values.pumpOn = atoi(result); break;
+      default: break;
+    }
+    result = strtok(NULL, ",");
+    currentValueIndex++;
+  }
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_decodes_all_fields() {
+  MaraXFrame decoded;
+  TEST_ASSERT_EQUAL_STRING("Ok", toString(decode("C1.19,116,124,093,0840,1,0", decoded)));
+  TEST_ASSERT_EQUAL('C', decoded.mode);
+  TEST_ASSERT_EQUAL_UINT8(1, decoded.firmwareMajor);
+  TEST_ASSERT_EQUAL_UINT8(19, decoded.firmwareMinor);
+  TEST_ASSERT_EQUAL_UINT8(116, decoded.steamTemp);
+  TEST_ASSERT_EQUAL_UINT8(124, decoded.targetSteamTemp);
+  TEST_ASSERT_EQUAL_UINT8(93, decoded.hxTemp);
+  TEST_ASSERT_EQUAL_UINT16(840, decoded.boostCountdown);
+  TEST_ASSERT_TRUE(decoded.heatingOn);
+  TEST_ASSERT_FALSE(decoded.pumpOn);
+
+  TEST_ASSERT_EQUAL_STRING("Ok", toString(decode("V1.22,200,200,200,9999,0,1", decoded)));
+  TEST_ASSERT_EQUAL('V', decoded.mode);
+  TEST_ASSERT_EQUAL_UINT16(9999, decoded.boostCountdown);
+  TEST_ASSERT_FALSE(decoded.heatingOn);
+  TEST_ASSERT_TRUE(decoded.pumpOn);
+}
+
+void test_does_not_need_null_termination() {
+  const char frame[] = "C1.19,116,124,093,0840,1,0xxxx";
+  MaraXFrame decoded;
+  TEST_ASSERT_EQUAL_STRING("Ok", toString(decodeMaraXFrame(frame, strlen(frame) - 4, decoded)));
+  TEST_ASSERT_FALSE(decoded.pumpOn);
+}
+
+void test_invalid_mode() {
+  assertResult(MaraXDecodeResult::InvalidMode, "");
+  assertResult(MaraXDecodeResult::InvalidMode, "X1.19,116,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidMode, "c1.19,116,124,093,0840,1,0");
+}
+
+void test_invalid_version() {
+  assertResult(MaraXDecodeResult::InvalidVersion, "C");
+  assertResult(MaraXDecodeResult::InvalidVersion, "C1");
+  assertResult(MaraXDecodeResult::InvalidVersion, "C1.");
+  assertResult(MaraXDecodeResult::InvalidVersion, "C119,116,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidVersion, "C.19,116,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidVersion, "C1.,116,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidVersion, "C1-19,116,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidVersion, "C256.19,116,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidVersion, "C1.256,116,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidVersion, "C1.123456,116,124,093,0840,1,0");
+}
+
+void test_invalid_number() {
+  assertResult(MaraXDecodeResult::InvalidNumber, "C1.19,11a,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidNumber, "C1.19,,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidNumber, "C1.19,-16,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidNumber, "C1.19,116,124,093,0840,1,0 ");
+  assertResult(MaraXDecodeResult::InvalidNumber, "C1.19;116,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::InvalidNumber, "C1.19,116,124,093,000840,1,0");
+}
+
+void test_out_of_range() {
+  assertResult(MaraXDecodeResult::OutOfRange, "C1.19,201,124,093,0840,1,0");
+  assertResult(MaraXDecodeResult::OutOfRange, "C1.19,116,255,093,0840,1,0");
+  assertResult(MaraXDecodeResult::OutOfRange, "C1.19,116,124,999,0840,1,0");
+  assertResult(MaraXDecodeResult::OutOfRange, "C1.19,116,124,093,10000,1,0");
+  assertResult(MaraXDecodeResult::OutOfRange, "C1.19,116,124,093,0840,2,0");
+  assertResult(MaraXDecodeResult::OutOfRange, "C1.19,116,124,093,0840,1,9");
+}
+
+void test_wrong_field_count() {
+  assertResult(MaraXDecodeResult::WrongFieldCount, "C1.19");
+  assertResult(MaraXDecodeResult::WrongFieldCount, "C1.19,116,124,093,0840,1");
+  assertResult(MaraXDecodeResult::WrongFieldCount, "C1.19,116,124,093,0840,1,0,");
+  assertResult(MaraXDecodeResult::WrongFieldCount, "C1.19,116,124,093,0840,1,0,0");
+}
+
+void test_benchmark_against_strtok() {
+  const char *frames[] = {
+    "C1.19,116,124,093,0840,1,0",
+    "C1.19,095,124,087,0000,1,0",
+    "V1.22,124,124,094,0000,0,1",
+    "C1.19,021,124,025,1324,1,0",
+  };
+  constexpr size_t nrFrames = sizeof(frames) / sizeof(frames[0]);
+  size_t lengths[nrFrames];
+  for (size_t i = 0; i < nrFrames; ++i) {
+    lengths[i] = strlen(frames[i]);
+  }
+  constexpr uint32_t nrRounds = 200000;
+  // Summed up, so the decoding can not be optimized away.
+  volatile uint32_t sink = 0;
+
+  const auto strtokStart = std::chrono::steady_clock::now();
+  for (uint32_t round = 0; round < nrRounds; ++round) {
+    StrtokValues values{};
+    decodeWithStrtok(frames[round % nrFrames], values);
+    sink = sink + values.steamTemp + values.hxTemp + values.heatingOn;
+  }
+  const auto strtokDuration = std::chrono::steady_clock::now() - strtokStart;
+
+  const auto decodeStart = std::chrono::steady_clock::now();
+  for (uint32_t round = 0; round < nrRounds; ++round) {
+    MaraXFrame decoded;
+    if (decodeMaraXFrame(frames[round % nrFrames], lengths[round % nrFrames], decoded) == MaraXDecodeResult::Ok) {
+      sink = sink + decoded.steamTemp + decoded.hxTemp + decoded.heatingOn;
+    }
+  }
+  const auto decodeDuration = std::chrono::steady_clock::now() - decodeStart;
+
+  const double strtokNsPerFrame = std::chrono::duration<double, std::nano>(strtokDuration).count() / nrRounds;
+  const double decodeNsPerFrame = std::chrono::duration<double, std::nano>(decodeDuration).count() / nrRounds;
+  char message[120];
+  snprintf(message, sizeof(message), "strtok/atoi: %.1f ns per frame, decodeMaraXFrame: %.1f ns per frame (%.1fx)",
+           strtokNsPerFrame, decodeNsPerFrame, strtokNsPerFrame / decodeNsPerFrame);
+  TEST_MESSAGE(message);
+
+  // Both see the same values.
+  for (size_t i = 0; i < nrFrames; ++i) {
+    StrtokValues values{};
+    decodeWithStrtok(frames[i], values);
+    MaraXFrame decoded;
+    TEST_ASSERT_EQUAL_STRING("Ok", toString(decodeMaraXFrame(frames[i], lengths[i], decoded)));
+    TEST_ASSERT_EQUAL(values.steamTemp, decoded.steamTemp);
+    TEST_ASSERT_EQUAL(values.targetSteamTemp, decoded.targetSteamTemp);
+    TEST_ASSERT_EQUAL(values.hxTemp, decoded.hxTemp);
+    TEST_ASSERT_EQUAL(values.boostCountdown, decoded.boostCountdown);
+    TEST_ASSERT_EQUAL(values.heatingOn, decoded.heatingOn);
+    TEST_ASSERT_EQUAL(values.pumpOn, decoded.pumpOn);
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_decodes_all_fields);
+  RUN_TEST(test_does_not_need_null_termination);
+  RUN_TEST(test_invalid_mode);
+  RUN_TEST(test_invalid_version);
+  RUN_TEST(test_invalid_number);
+  RUN_TEST(test_out_of_range);
+  RUN_TEST(test_wrong_field_count);
+  RUN_TEST(test_benchmark_against_strtok);
+  return UNITY_END();
+}
@@ -0,0 +1,86 @@
+#include <MaraXFramer.hpp>
+#include <string.h>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+static MaraXFramer *framer = nullptr;
+
+/**
+ * @brief Pushes all chars and returns the frames completed meanwhile.
+ */
+static std::vector<std::string> pushAll(const char *received) {
+  std::vector<std::string> frames;
+  for (const char *receivedChar = received; *receivedChar != '\0'; ++receivedChar) {
+    if (framer->push(*receivedChar)) {
+      TEST_ASSERT_EQUAL(strlen(framer->getFrame()), framer->getFrameLength());
+      frames.push_back(framer->getFrame());
+    }
+  }
+  return frames;
+}
+
+void setUp() { framer = new MaraXFramer(); }
+
+void tearDown() {
+  delete framer;
+  framer = nullptr;
+}
+
+void test_frames_in_any_chunks() {
+  TEST_ASSERT_EQUAL(0, pushAll("C1.19,116,1").size());
+  TEST_ASSERT_EQUAL(0, pushAll("24,093,0840,1,0\r").size());
+  const std::vector<std::string> frames = pushAll("\nV1.19,116,124,093,0000,0,1\r\n");
+  TEST_ASSERT_EQUAL(2, frames.size());
+  TEST_ASSERT_EQUAL_STRING("C1.19,116,124,093,0840,1,0", frames[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("V1.19,116,124,093,0000,0,1", frames[1].c_str());
+  TEST_ASSERT_EQUAL_UINT32(2, framer->getCompletedFrameCount());
+  TEST_ASSERT_EQUAL_UINT32(0, framer->getTruncatedFrameCount());
+  TEST_ASSERT_EQUAL_UINT32(0, framer->getDiscardedCharCount());
+}
+
+void test_start_within_frame_restarts_it() {
+  // The '\n' of the first frame was lost. The next frame is kept.
+  const std::vector<std::string> frames = pushAll("C1.19,116,124,0C1.19,117,124,093,0840,1,0\n");
+  TEST_ASSERT_EQUAL(1, frames.size());
+  TEST_ASSERT_EQUAL_STRING("C1.19,117,124,093,0840,1,0", frames[0].c_str());
+  TEST_ASSERT_EQUAL_UINT32(1, framer->getTruncatedFrameCount());
+  TEST_ASSERT_EQUAL_UINT32(15, framer->getDiscardedCharCount());
+}
+
+void test_start_after_too_long_frame_restarts() {
+  // Longer than maxFrameLength, before the next frame starts.
+  const std::vector<std::string> frames = pushAll("C1.19,116,124,093,0840,1,0,0,0,0,0,0V1.19,116,124,093,0840,1,0\n");
+  TEST_ASSERT_EQUAL(1, frames.size());
+  TEST_ASSERT_EQUAL_STRING("V1.19,116,124,093,0840,1,0", frames[0].c_str());
+  TEST_ASSERT_EQUAL_UINT32(1, framer->getTruncatedFrameCount());
+}
+
+void test_drops_short_frames() {
+  const std::vector<std::string> frames = pushAll("C1.19,116\nC1.19,116,124,093,0840,1,0\n");
+  TEST_ASSERT_EQUAL(1, frames.size());
+  TEST_ASSERT_EQUAL_UINT32(1, framer->getTruncatedFrameCount());
+}
+
+void test_resynchronizes_after_garbage() {
+  const std::vector<std::string> frames = pushAll(
+      "xx,0840\n"
+      "C1.19,116,1\x01"
+      "24,093,0840,1,0\n"
+      "C1.19,116,124,093,0840,1,0\n");
+  TEST_ASSERT_EQUAL(1, frames.size());
+  TEST_ASSERT_EQUAL_STRING("C1.19,116,124,093,0840,1,0", frames[0].c_str());
+  TEST_ASSERT_EQUAL_UINT32(1, framer->getTruncatedFrameCount());
+  // 7 before the first frame, 12 of the broken one and 15 skipped behind it.
+  TEST_ASSERT_EQUAL_UINT32(7 + 12 + 15, framer->getDiscardedCharCount());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_frames_in_any_chunks);
+  RUN_TEST(test_start_within_frame_restarts_it);
+  RUN_TEST(test_start_after_too_long_frame_restarts);
+  RUN_TEST(test_drops_short_frames);
+  RUN_TEST(test_resynchronizes_after_garbage);
+  return UNITY_END();
+}
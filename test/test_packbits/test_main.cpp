@@ -0,0 +1,104 @@
+#include "bootscreen_raw.h"
+#include <PackBitsReader.hpp>
+#include <bootscreen.h>
+#include <unity.h>
+#include <vector>
+
+/**
+ * Decodes the compressed boot screens and compares them with the uncompressed arrays they were created from.
+ */
+
+struct Picture {
+  const char *name;
+  const uint8_t *compressed;
+  size_t compressedSize;
+  const uint8_t *raw;
+  size_t rawSize;
+};
+
+static const Picture pictures[] = {
+  { "MrBeanFromBottomRight", MrBeanFromBottomRight, sizeof(MrBeanFromBottomRight), MrBeanFromBottomRightRaw,
+    sizeof(MrBeanFromBottomRightRaw) },
+  { "MrBeanAnticipated", MrBeanAnticipated, sizeof(MrBeanAnticipated), MrBeanAnticipatedRaw,
+    sizeof(MrBeanAnticipatedRaw) },
+  { "MrBeanSurprised", MrBeanSurprised, sizeof(MrBeanSurprised), MrBeanSurprisedRaw, sizeof(MrBeanSurprisedRaw) },
+};
+
+/**
+ * @brief Decodes the whole data in chunks of the size.
+ */
+static std::vector<uint8_t> decodeInChunks(const uint8_t *data, size_t size, size_t chunkSize) {
+  PackBitsReader reader(data, size);
+  std::vector<uint8_t> decoded;
+  std::vector<uint8_t> chunk(chunkSize);
+  size_t read = 0;
+  do {
+    read = reader.read(chunk.data(), chunkSize);
+    decoded.insert(decoded.end(), chunk.begin(), chunk.begin() + read);
+  } while (read == chunkSize);
+  TEST_ASSERT_TRUE(reader.isAtEnd());
+  TEST_ASSERT_EQUAL(0, reader.read(chunk.data(), chunkSize));
+  return decoded;
+}
+
+static void assertBootScreensInChunks(size_t chunkSize) {
+  for (const Picture &picture : pictures) {
+    const std::vector<uint8_t> decoded = decodeInChunks(picture.compressed, picture.compressedSize, chunkSize);
+    TEST_ASSERT_EQUAL_MESSAGE(picture.rawSize, decoded.size(), picture.name);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(picture.raw, decoded.data(), picture.rawSize, picture.name);
+    TEST_ASSERT_TRUE_MESSAGE(picture.compressedSize < picture.rawSize, picture.name);
+  }
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_boot_screens_in_chunks_of_1() { assertBootScreensInChunks(1); }
+
+void test_boot_screens_in_chunks_of_7() { assertBootScreensInChunks(7); }
+
+void test_boot_screens_in_chunks_of_1000() { assertBootScreensInChunks(1000); }
+
+void test_boot_screens_in_chunks_of_15000() { assertBootScreensInChunks(15000); }
+
+void test_longest_literal_and_run() {
+  std::vector<uint8_t> data;
+  std::vector<uint8_t> expected;
+  // 128 literal bytes.
+  data.push_back(127);
+  for (uint16_t i = 0; i < 128; ++i) {
+    data.push_back(i);
+    expected.push_back(i);
+  }
+  // Skipped header.
+  data.push_back(128);
+  // 128 repeated bytes.
+  data.push_back(129);
+  data.push_back(0xA5);
+  expected.insert(expected.end(), 128, 0xA5);
+  // 2 repeated bytes.
+  data.push_back(255);
+  data.push_back(0x00);
+  expected.insert(expected.end(), 2, 0x00);
+  // A single literal byte.
+  data.push_back(0);
+  data.push_back(0x42);
+  expected.push_back(0x42);
+
+  for (size_t chunkSize : { 1, 3, 128, 1000 }) {
+    const std::vector<uint8_t> decoded = decodeInChunks(data.data(), data.size(), chunkSize);
+    TEST_ASSERT_EQUAL(expected.size(), decoded.size());
+    TEST_ASSERT_EQUAL_MEMORY(expected.data(), decoded.data(), expected.size());
+  }
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_screens_in_chunks_of_1);
+  RUN_TEST(test_boot_screens_in_chunks_of_7);
+  RUN_TEST(test_boot_screens_in_chunks_of_1000);
+  RUN_TEST(test_boot_screens_in_chunks_of_15000);
+  RUN_TEST(test_longest_literal_and_run);
+  return UNITY_END();
+}
@@ -0,0 +1,188 @@
+#include <PumpDetector.hpp>
+#include <unity.h>
+#include <vector>
+
+/**
+ * Feeds synthetic traces of the reed sensor into PumpDetector, as handlePump() does: every loopIntervalInUs, the edges
+ * captured so far are added and update() is called.
+ */
+
+constexpr uint32_t loopIntervalInUs = 20000;
+/// The reed sensor stays LOW for about a quarter of the period.
+constexpr uint32_t pulseWidthInUs = 5000;
+
+struct Observed {
+  PumpDetector::Event event;
+  /// The time of the loop, which reported the event.
+  uint32_t timeInUs;
+};
+
+static void addPulse(std::vector<ReedEdge> &edges, uint32_t timeInUs, uint32_t widthInUs = pulseWidthInUs) {
+  edges.push_back(ReedEdge{ timeInUs, LOW });
+  edges.push_back(ReedEdge{ timeInUs + widthInUs, HIGH });
+}
+
+/**
+ * @brief Pulses with the period from start for the duration. Pulses, whose number is in dropped, are left out.
+ */
+static std::vector<ReedEdge> createPulseTrain(uint32_t startInUs, uint32_t periodInUs, uint32_t durationInUs,
+                                              const std::vector<uint32_t> &dropped = {}) {
+  std::vector<ReedEdge> edges;
+  uint32_t number = 0;
+  for (uint32_t offset = 0; offset < durationInUs; offset += periodInUs, ++number) {
+    bool drop = false;
+    for (uint32_t droppedNumber : dropped) {
+      drop = drop || droppedNumber == number;
+    }
+    if (!drop) {
+      addPulse(edges, startInUs + offset);
+    }
+  }
+  return edges;
+}
+
+/**
+ * @brief Runs the loop from begin for the duration. Edge times are relative to begin, so they may wrap around.
+ */
+static std::vector<Observed> run(PumpDetector &detector, const std::vector<ReedEdge> &edges, uint32_t beginInUs,
+                                 uint32_t durationInUs) {
+  std::vector<Observed> observed;
+  size_t nextEdge = 0;
+  for (uint32_t elapsed = 0; elapsed <= durationInUs; elapsed += loopIntervalInUs) {
+    const uint32_t now = beginInUs + elapsed;
+    while (nextEdge < edges.size() && edges[nextEdge].timeInUs - beginInUs <= elapsed) {
+      const PumpDetector::Event event = detector.addEdge(edges[nextEdge++]);
+      if (event != PumpDetector::Event::None) {
+        observed.push_back(Observed{ event, now });
+      }
+    }
+    const PumpDetector::Event event = detector.update(now);
+    if (event != PumpDetector::Event::None) {
+      observed.push_back(Observed{ event, now });
+    }
+  }
+  return observed;
+}
+
+/**
+ * @brief Asserts a single run from the first to the last pulse of the trace.
+ */
+static void assertSingleRun(const PumpDetector &detector, const std::vector<Observed> &observed,
+                            const std::vector<ReedEdge> &edges, uint32_t periodInUs) {
+  TEST_ASSERT_EQUAL(2, observed.size());
+  TEST_ASSERT_TRUE(observed[0].event == PumpDetector::Event::Started);
+  TEST_ASSERT_TRUE(observed[1].event == PumpDetector::Event::Stopped);
+  TEST_ASSERT_FALSE(detector.isRunning());
+  TEST_ASSERT_EQUAL_UINT32(edges.front().timeInUs, detector.getStartTime());
+  TEST_ASSERT_EQUAL_UINT32(edges[edges.size() - 2].timeInUs, detector.getStopTime());
+  // Detected with the first loop after missingPeriodsToStop periods without a pulse.
+  TEST_ASSERT_EQUAL_UINT32(observed[1].timeInUs - detector.getStopTime(), detector.getStopLatency());
+  TEST_ASSERT_GREATER_THAN_UINT32(PumpDetector::missingPeriodsToStop * detector.getPulsePeriod(),
+                                  detector.getStopLatency());
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(PumpDetector::missingPeriodsToStop * detector.getPulsePeriod() + loopIntervalInUs,
+                                   detector.getStopLatency());
+  TEST_ASSERT_UINT32_WITHIN(periodInUs / 50, periodInUs, detector.getPulsePeriod());
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_50_hz_with_dropped_pulses() {
+  // Single and double gaps, but never missingPeriodsToStop pulses in a row.
+  const std::vector<ReedEdge> edges = createPulseTrain(100000, 20000, 25000000, { 10, 30, 31, 500, 700, 701, 702 });
+  PumpDetector detector;
+  const std::vector<Observed> observed = run(detector, edges, 0, 26000000);
+  assertSingleRun(detector, observed, edges, 20000);
+  // Started by the third pulse.
+  TEST_ASSERT_EQUAL_UINT32(140000, observed[0].timeInUs);
+}
+
+void test_60_hz_with_contact_bounce() {
+  std::vector<ReedEdge> edges;
+  for (uint32_t offset = 0; offset < 8000000; offset += 16667) {
+    // The contact bounces twice, before it settles.
+    edges.push_back(ReedEdge{ 200000 + offset, LOW });
+    edges.push_back(ReedEdge{ 200000 + offset + 300, HIGH });
+    edges.push_back(ReedEdge{ 200000 + offset + 600, LOW });
+    edges.push_back(ReedEdge{ 200000 + offset + 800, HIGH });
+    edges.push_back(ReedEdge{ 200000 + offset + 1000, LOW });
+    edges.push_back(ReedEdge{ 200000 + offset + pulseWidthInUs, HIGH });
+  }
+  PumpDetector detector;
+  const std::vector<Observed> observed = run(detector, edges, 0, 9000000);
+
+  TEST_ASSERT_EQUAL(2, observed.size());
+  TEST_ASSERT_TRUE(observed[0].event == PumpDetector::Event::Started);
+  TEST_ASSERT_TRUE(observed[1].event == PumpDetector::Event::Stopped);
+  TEST_ASSERT_EQUAL_UINT32(200000, detector.getStartTime());
+  // The bounces of the last pulse do not extend the run.
+  TEST_ASSERT_EQUAL_UINT32(edges[edges.size() - 6].timeInUs, detector.getStopTime());
+  TEST_ASSERT_UINT32_WITHIN(16667 / 50, 16667, detector.getPulsePeriod());
+  // The stop is detected faster than at 50 Hz.
+  TEST_ASSERT_GREATER_THAN_UINT32(PumpDetector::missingPeriodsToStop * detector.getPulsePeriod(),
+                                  detector.getStopLatency());
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(100000, detector.getStopLatency());
+}
+
+void test_glitches_do_not_start_the_pump() {
+  std::vector<ReedEdge> edges;
+  // A single knock, then two pulses in a row, then pulses too far apart for a pulse train.
+  addPulse(edges, 100000);
+  addPulse(edges, 1000000);
+  addPulse(edges, 1020000);
+  for (uint32_t time = 2000000; time < 4000000; time += 50000) {
+    addPulse(edges, time);
+  }
+  // A short pulse and its bounce, which must not count as two pulses.
+  addPulse(edges, 5000000, 200);
+  addPulse(edges, 5000500, 200);
+  addPulse(edges, 5001000);
+  PumpDetector detector;
+  const std::vector<Observed> observed = run(detector, edges, 0, 6000000);
+
+  TEST_ASSERT_EQUAL(0, observed.size());
+  TEST_ASSERT_FALSE(detector.isRunning());
+}
+
+void test_micros_wrap_around() {
+  // micros() wraps about every 71.6 min. The run starts 0.5 s before.
+  const uint32_t begin = UINT32_MAX - 600000 + 1;
+  const std::vector<ReedEdge> edges = createPulseTrain(begin + 100000, 20000, 1000000, { 12 });
+  TEST_ASSERT_TRUE(edges.back().timeInUs < begin);
+  PumpDetector detector;
+  const std::vector<Observed> observed = run(detector, edges, begin, 2000000);
+
+  assertSingleRun(detector, observed, edges, 20000);
+  TEST_ASSERT_EQUAL_UINT32(begin + 140000, observed[0].timeInUs);
+  TEST_ASSERT_EQUAL_UINT32(120000, detector.getStopLatency());
+  // The run time is not affected by the wrap around.
+  TEST_ASSERT_EQUAL_UINT32(980000, detector.getStopTime() - detector.getStartTime());
+}
+
+void test_back_to_back_runs() {
+  // A refill shortly after a shot is a run of its own.
+  std::vector<ReedEdge> edges = createPulseTrain(100000, 20000, 2000000);
+  const std::vector<ReedEdge> second = createPulseTrain(2100000 + 150000, 20000, 1000000);
+  edges.insert(edges.end(), second.begin(), second.end());
+  PumpDetector detector;
+  const std::vector<Observed> observed = run(detector, edges, 0, 4000000);
+
+  TEST_ASSERT_EQUAL(4, observed.size());
+  TEST_ASSERT_TRUE(observed[0].event == PumpDetector::Event::Started);
+  TEST_ASSERT_TRUE(observed[1].event == PumpDetector::Event::Stopped);
+  TEST_ASSERT_TRUE(observed[2].event == PumpDetector::Event::Started);
+  TEST_ASSERT_TRUE(observed[3].event == PumpDetector::Event::Stopped);
+  TEST_ASSERT_EQUAL_UINT32(2250000, detector.getStartTime());
+  TEST_ASSERT_EQUAL_UINT32(2250000 + 980000, detector.getStopTime());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_50_hz_with_dropped_pulses);
+  RUN_TEST(test_60_hz_with_contact_bounce);
+  RUN_TEST(test_glitches_do_not_start_the_pump);
+  RUN_TEST(test_micros_wrap_around);
+  RUN_TEST(test_back_to_back_runs);
+  return UNITY_END();
+}
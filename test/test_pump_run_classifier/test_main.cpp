@@ -0,0 +1,126 @@
+#include <PumpRunClassifier.hpp>
+#include <unity.h>
+#include <vector>
+
+/**
+ * Feeds the frames before and during synthetic pump runs into PumpRunClassifier, as readMaraXSerial() and
+ * handlePumpEvent() do, and checks the evidence summed up for each run.
+ */
+
+static PumpRunClassifier *classifier = nullptr;
+
+static MaraXFrame createFrame(uint8_t hxTemp, uint8_t steamTemp, bool heatingOn = false, bool pumpOn = false) {
+  MaraXFrame frame{};
+  frame.mode = 'C';
+  frame.hxTemp = hxTemp;
+  frame.steamTemp = steamTemp;
+  frame.targetSteamTemp = 124;
+  frame.heatingOn = heatingOn;
+  frame.pumpOn = pumpOn;
+  return frame;
+}
+
+/**
+ * @brief Runs the pump from start for the duration. The frames are received during the run.
+ */
+static PumpRunClassification run(unsigned long startInMs, unsigned long durationInMs,
+                                 const std::vector<MaraXFrame> &frames = {}) {
+  classifier->startRun(startInMs);
+  for (const MaraXFrame &frame : frames) {
+    classifier->addFrame(frame);
+  }
+  return classifier->stopRun(startInMs + durationInMs);
+}
+
+static void assertClassification(PumpRunKind kind, int16_t score, uint8_t confidence,
+                                 const PumpRunClassification &classification) {
+  TEST_ASSERT_EQUAL_INT16(score, classification.score);
+  TEST_ASSERT_EQUAL_UINT8(confidence, classification.confidence);
+  TEST_ASSERT_TRUE(kind == classification.kind);
+}
+
+void setUp() { classifier = new PumpRunClassifier(); }
+
+void tearDown() {
+  delete classifier;
+  classifier = nullptr;
+}
+
+void test_long_shot() {
+  classifier->addFrame(createFrame(93, 116));
+  // The HX cools down by the fresh water, the boiler does not.
+  const std::vector<MaraXFrame> frames = { createFrame(92, 116), createFrame(90, 116), createFrame(88, 116),
+                                           createFrame(88, 117) };
+  // Duration +10 (clamped from +30), HX drop of 5 C +6 (clamped from +8), no steam drop +2.
+  assertClassification(PumpRunKind::Shot, 18, 86, run(100000, 25000, frames));
+  TEST_ASSERT_EQUAL_UINT32(100000, classifier->getLastShotStartTime());
+  TEST_ASSERT_EQUAL_UINT32(125000, classifier->getLastShotStopTime());
+}
+
+void test_short_refill() {
+  classifier->addFrame(createFrame(93, 116));
+  // Cold water fed into the boiler, so the heating switches on. The mara x reports its pump.
+  const std::vector<MaraXFrame> frames = { createFrame(93, 114, true, true), createFrame(93, 112, true, true) };
+  // Duration -10 (clamped from -14), no HX drop -2, steam drop of 4 C -6, heating -2, pump -2.
+  assertClassification(PumpRunKind::Refill, -22, 88, run(100000, 3000, frames));
+}
+
+void test_burst_of_refills() {
+  // Without frames, only the duration and the burst count. 11 s alone is a shot.
+  assertClassification(PumpRunKind::Shot, 2, 62, run(100000, 11000));
+  // Starting 2 s after the previous run is a burst.
+  assertClassification(PumpRunKind::Refill, -2, 62, run(113000, 11000));
+  // 5 s after the previous run, it is not a burst anymore.
+  assertClassification(PumpRunKind::Shot, 2, 62, run(129000, 11000));
+}
+
+void test_run_without_frames() {
+  // Nothing known but the duration. No frames do not count as reported by the pump field.
+  assertClassification(PumpRunKind::Shot, 10, 80, run(100000, 30000));
+  assertClassification(PumpRunKind::Refill, -10, 80, run(200000, 2000));
+  assertClassification(PumpRunKind::Shot, 0, 50, run(300000, 10000));
+}
+
+void test_temperature_drops_are_clamped() {
+  classifier->addFrame(createFrame(93, 116));
+  // A huge drop of both counts no more than 6 points each, so they cancel out.
+  assertClassification(PumpRunKind::Shot, 0, 50, run(100000, 10000, { createFrame(60, 80) }));
+  // A drop of 1 C is noise, so it counts as no drop.
+  classifier->addFrame(createFrame(93, 116));
+  assertClassification(PumpRunKind::Shot, 0, 50, run(200000, 10000, { createFrame(92, 115) }));
+}
+
+void test_pump_field_counts_for_most_frames() {
+  classifier->addFrame(createFrame(93, 116));
+  // Half of the frames only is not enough.
+  const std::vector<MaraXFrame> half = { createFrame(93, 116, false, true), createFrame(93, 116) };
+  assertClassification(PumpRunKind::Shot, 0, 50, run(100000, 10000, half));
+  const std::vector<MaraXFrame> most = { createFrame(93, 116, false, true), createFrame(93, 116, false, true),
+                                         createFrame(93, 116) };
+  assertClassification(PumpRunKind::Refill, -2, 62, run(200000, 10000, most));
+}
+
+void test_refill_keeps_the_last_shot() {
+  TEST_ASSERT_EQUAL_UINT32(0, classifier->getLastShotStartTime());
+  TEST_ASSERT_EQUAL_UINT32(0, classifier->getLastShotStopTime());
+  TEST_ASSERT_TRUE(PumpRunKind::Shot == run(100000, 28000).kind);
+  TEST_ASSERT_TRUE(PumpRunKind::Refill == run(200000, 3000).kind);
+  TEST_ASSERT_TRUE(PumpRunKind::Refill == run(204000, 3000).kind);
+  TEST_ASSERT_EQUAL_UINT32(100000, classifier->getLastShotStartTime());
+  TEST_ASSERT_EQUAL_UINT32(128000, classifier->getLastShotStopTime());
+  TEST_ASSERT_TRUE(PumpRunKind::Shot == run(300000, 25000).kind);
+  TEST_ASSERT_EQUAL_UINT32(300000, classifier->getLastShotStartTime());
+  TEST_ASSERT_EQUAL_UINT32(325000, classifier->getLastShotStopTime());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_long_shot);
+  RUN_TEST(test_short_refill);
+  RUN_TEST(test_burst_of_refills);
+  RUN_TEST(test_run_without_frames);
+  RUN_TEST(test_temperature_drops_are_clamped);
+  RUN_TEST(test_pump_field_counts_for_most_frames);
+  RUN_TEST(test_refill_keeps_the_last_shot);
+  return UNITY_END();
+}
@@ -0,0 +1,147 @@
+#include <LittleFS.h>
+#include <ShotLog.hpp>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+/**
+ * Writes the shot log to the in-memory LittleFS of test/support and starts it again on the files, as after a reboot.
+ * The files are changed directly to simulate power cuts while appending.
+ */
+
+constexpr size_t headerSize = 4;
+
+static ShotRecord createRecord(uint32_t uptimeInS) {
+  ShotRecord record{};
+  record.uptimeInS = uptimeInS;
+  record.durationInDs = 280;
+  record.hxAtStart = 93;
+  record.minHx = record.hxAtEnd = 88;
+  record.maxHx = 93;
+  record.steamAtStart = 116;
+  record.mode = 'C';
+  return record;
+}
+
+static void appendRecords(ShotLog &log, uint32_t nrRecords, uint32_t firstUptimeInS = 1) {
+  for (uint32_t i = 0; i < nrRecords; ++i) {
+    TEST_ASSERT_TRUE(log.append(createRecord(firstUptimeInS + i)));
+  }
+}
+
+static std::vector<ShotRecord> readAll(const ShotLog &log) {
+  std::vector<ShotRecord> records;
+  log.forEach([&records](const ShotRecord &record) { records.push_back(record); });
+  return records;
+}
+
+static FileContent &segmentFile(uint32_t segment) {
+  return LittleFS.files.at("/shots/" + std::to_string(segment) + ".bin");
+}
+
+void setUp() {
+  LittleFS.files.clear();
+  LittleFS.available = true;
+}
+
+void tearDown() {}
+
+void test_append_and_read_after_reboot() {
+  ShotLog log;
+  TEST_ASSERT_TRUE(log.begin());
+  appendRecords(log, 3);
+  TEST_ASSERT_EQUAL(headerSize + 3 * sizeof(ShotRecord), segmentFile(1).size());
+
+  ShotLog rebooted;
+  TEST_ASSERT_TRUE(rebooted.begin());
+  TEST_ASSERT_EQUAL_UINT32(3, rebooted.getNrRecords());
+  appendRecords(rebooted, 1, 4);
+  const std::vector<ShotRecord> records = readAll(rebooted);
+  TEST_ASSERT_EQUAL(4, records.size());
+  for (uint32_t i = 0; i < records.size(); ++i) {
+    TEST_ASSERT_EQUAL_UINT32(i, records[i].sequence);
+    TEST_ASSERT_EQUAL_UINT32(i + 1, records[i].uptimeInS);
+  }
+  // Still appended to the first segment.
+  TEST_ASSERT_EQUAL(1, LittleFS.files.size());
+}
+
+void test_torn_record_closes_the_segment() {
+  ShotLog log;
+  log.begin();
+  appendRecords(log, 3);
+  // The power was cut while the 4th record was written.
+  FileContent &file = segmentFile(1);
+  const ShotRecord torn = createRecord(4);
+  file.insert(file.end(), reinterpret_cast<const uint8_t *>(&torn), reinterpret_cast<const uint8_t *>(&torn) + 10);
+
+  ShotLog rebooted;
+  rebooted.begin();
+  appendRecords(rebooted, 1, 5);
+  // The torn segment is left as it is and the sequence continues after its last valid record.
+  TEST_ASSERT_EQUAL(headerSize + 3 * sizeof(ShotRecord) + 10, segmentFile(1).size());
+  TEST_ASSERT_EQUAL(headerSize + sizeof(ShotRecord), segmentFile(2).size());
+  const std::vector<ShotRecord> records = readAll(rebooted);
+  TEST_ASSERT_EQUAL(4, records.size());
+  TEST_ASSERT_EQUAL_UINT32(3, records[3].sequence);
+  TEST_ASSERT_EQUAL_UINT32(5, records[3].uptimeInS);
+}
+
+void test_corrupt_last_record_skips_the_sequence() {
+  ShotLog log;
+  log.begin();
+  appendRecords(log, 3);
+  // A whole record, whose bytes did not all reach the flash.
+  segmentFile(1).back() ^= 0xFF;
+
+  ShotLog rebooted;
+  rebooted.begin();
+  appendRecords(rebooted, 1, 4);
+  const std::vector<ShotRecord> records = readAll(rebooted);
+  // The corrupt record is skipped. The sequence jumps behind the segment, which keeps the order.
+  TEST_ASSERT_EQUAL(3, records.size());
+  TEST_ASSERT_EQUAL_UINT32(1, records[1].sequence);
+  TEST_ASSERT_EQUAL_UINT32(2 * ShotLog::recordsPerSegment, records[2].sequence);
+  TEST_ASSERT_EQUAL(2, LittleFS.files.size());
+}
+
+void test_old_segments_rotate_out() {
+  ShotLog log;
+  log.begin();
+  appendRecords(log, ShotLog::maxSegments * ShotLog::recordsPerSegment);
+  TEST_ASSERT_EQUAL(ShotLog::maxSegments, LittleFS.files.size());
+  TEST_ASSERT_EQUAL_UINT32(ShotLog::maxSegments * ShotLog::recordsPerSegment, log.getNrRecords());
+
+  // Starting one more segment deletes the oldest one.
+  appendRecords(log, 1, 100000);
+  TEST_ASSERT_EQUAL(ShotLog::maxSegments, LittleFS.files.size());
+  TEST_ASSERT_EQUAL(0, LittleFS.files.count("/shots/1.bin"));
+  const uint32_t expectedNrRecords = (ShotLog::maxSegments - 1) * ShotLog::recordsPerSegment + 1;
+  TEST_ASSERT_EQUAL_UINT32(expectedNrRecords, log.getNrRecords());
+
+  ShotLog rebooted;
+  rebooted.begin();
+  TEST_ASSERT_EQUAL_UINT32(expectedNrRecords, rebooted.getNrRecords());
+  const std::vector<ShotRecord> records = readAll(rebooted);
+  TEST_ASSERT_EQUAL(expectedNrRecords, records.size());
+  TEST_ASSERT_EQUAL_UINT32(ShotLog::recordsPerSegment, records.front().sequence);
+  TEST_ASSERT_EQUAL_UINT32(100000, records.back().uptimeInS);
+}
+
+void test_without_file_system() {
+  LittleFS.available = false;
+  ShotLog log;
+  TEST_ASSERT_FALSE(log.begin());
+  TEST_ASSERT_FALSE(log.append(createRecord(1)));
+  TEST_ASSERT_EQUAL(0, readAll(log).size());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_append_and_read_after_reboot);
+  RUN_TEST(test_torn_record_closes_the_segment);
+  RUN_TEST(test_corrupt_last_record_skips_the_sequence);
+  RUN_TEST(test_old_segments_rotate_out);
+  RUN_TEST(test_without_file_system);
+  return UNITY_END();
+}
@@ -0,0 +1,170 @@
+#include <TemperatureHistory.hpp>
+#include <string>
+#include <unity.h>
+#include <vector>
+
+struct TimedSample {
+  uint32_t timeInSeconds;
+  HistorySample sample;
+};
+
+static TemperatureHistory *history = nullptr;
+
+/**
+ * @brief Deterministic pseudo random numbers, so a failing sequence can be reproduced.
+ */
+static uint32_t nextRandom() {
+  static uint32_t state = 12345;
+  state = state * 1103515245 + 12345;
+  return state >> 16;
+}
+
+/**
+ * @brief Appends samples at 1 Hz. Each temperature changes by one degree with the probability of 1 / changeEvery and
+ * jumps with the probability of 1 / jumpEvery. Every gapEvery-th second is left out.
+ */
+static std::vector<TimedSample> appendSamples(uint32_t nrSeconds, uint32_t changeEvery, uint32_t jumpEvery,
+                                              uint32_t gapEvery) {
+  std::vector<TimedSample> appended;
+  HistorySample sample{ 20, 20, true, false };
+  for (uint32_t time = 1000; time < 1000 + nrSeconds; ++time) {
+    if (gapEvery > 0 && time % gapEvery == 0) {
+      continue;
+    }
+    for (uint8_t *temperature : { &sample.steamTemp, &sample.hxTemp }) {
+      const uint32_t random = nextRandom();
+      if (jumpEvery > 0 && random % jumpEvery == 0) {
+        *temperature = 20 + nextRandom() % 180;
+      } else if (random % changeEvery == 1) {
+        *temperature += *temperature < 200 ? 1 : 0;
+      } else if (random % changeEvery == 2) {
+        *temperature -= *temperature > 0 ? 1 : 0;
+      }
+    }
+    sample.heatingOn = nextRandom() % 20 != 0 ? sample.heatingOn : !sample.heatingOn;
+    sample.pumpOn = nextRandom() % 30 != 0 ? sample.pumpOn : !sample.pumpOn;
+    history->append(time, sample);
+    appended.push_back(TimedSample{ time, sample });
+  }
+  return appended;
+}
+
+static std::vector<TimedSample> readRange(uint32_t fromTime, uint32_t toTime) {
+  std::vector<TimedSample> read;
+  history->forEachInRange(fromTime, toTime, [&read](uint32_t timeInSeconds, const HistorySample &sample) {
+    read.push_back(TimedSample{ timeInSeconds, sample });
+  });
+  return read;
+}
+
+/**
+ * @brief Asserts, that the history holds the newest of the appended samples and returns their number.
+ */
+static size_t assertRoundTrip(const std::vector<TimedSample> &appended) {
+  const std::vector<TimedSample> read = readRange(0, UINT32_MAX);
+  TEST_ASSERT_TRUE(read.size() > 0 && read.size() <= appended.size());
+  const size_t offset = appended.size() - read.size();
+  for (size_t i = 0; i < read.size(); ++i) {
+    const TimedSample &expected = appended[offset + i];
+    char message[64];
+    snprintf(message, sizeof(message), "at %u s", expected.timeInSeconds);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected.timeInSeconds, read[i].timeInSeconds, message);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected.sample.steamTemp, read[i].sample.steamTemp, message);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected.sample.hxTemp, read[i].sample.hxTemp, message);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected.sample.heatingOn, read[i].sample.heatingOn, message);
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(expected.sample.pumpOn, read[i].sample.pumpOn, message);
+  }
+  TEST_ASSERT_EQUAL_UINT32(read.front().timeInSeconds, history->getFirstTime());
+  TEST_ASSERT_EQUAL_UINT32(appended.back().timeInSeconds, history->getLastTime());
+  return read.size();
+}
+
+void setUp() { history = new TemperatureHistory(); }
+
+void tearDown() {
+  delete history;
+  history = nullptr;
+}
+
+void test_empty() {
+  TEST_ASSERT_TRUE(history->isEmpty());
+  TEST_ASSERT_EQUAL(0, readRange(0, UINT32_MAX).size());
+}
+
+void test_round_trip_of_slow_changes() {
+  const std::vector<TimedSample> appended = appendSamples(4 * 3600, 10, 0, 0);
+  const size_t nrStored = assertRoundTrip(appended);
+  // Every block but the newest one is filled completely.
+  TEST_ASSERT_GREATER_THAN((TemperatureHistory::nrBlocks - 1) * TemperatureHistory::samplesPerBlock, nrStored);
+  TEST_ASSERT_LESS_OR_EQUAL(TemperatureHistory::nrBlocks * TemperatureHistory::samplesPerBlock, nrStored);
+}
+
+void test_round_trip_with_jumps_and_gaps() {
+  const std::vector<TimedSample> appended = appendSamples(4 * 3600, 3, 50, 997);
+  const size_t nrStored = assertRoundTrip(appended);
+  // A jump takes 8 more bits, but does not start a new block. About every 25th sample has one.
+  TEST_ASSERT_GREATER_THAN(TemperatureHistory::nrBlocks * TemperatureHistory::samplesPerBlock * 8 / 10, nrStored);
+}
+
+void test_every_temperature_change() {
+  // From every temperature to every other one, each stored as jump, step or no change.
+  std::vector<TimedSample> appended;
+  uint32_t time = 0;
+  for (uint16_t from = 0; from <= 255; from += 15) {
+    for (uint16_t to = 0; to <= 255; ++to) {
+      const HistorySample forth{ static_cast<uint8_t>(from), static_cast<uint8_t>(to), false, true };
+      const HistorySample back{ static_cast<uint8_t>(to), static_cast<uint8_t>(from), true, false };
+      for (const HistorySample &sample : { forth, back }) {
+        history->append(++time, sample);
+        appended.push_back(TimedSample{ time, sample });
+      }
+    }
+  }
+  assertRoundTrip(appended);
+}
+
+void test_range() {
+  const std::vector<TimedSample> appended = appendSamples(1000, 5, 40, 0);
+  const std::vector<TimedSample> read = readRange(1200, 1209);
+  TEST_ASSERT_EQUAL(10, read.size());
+  for (size_t i = 0; i < read.size(); ++i) {
+    TEST_ASSERT_EQUAL_UINT32(1200 + i, read[i].timeInSeconds);
+    TEST_ASSERT_EQUAL_UINT8(appended[200 + i].sample.hxTemp, read[i].sample.hxTemp);
+  }
+  TEST_ASSERT_EQUAL(1, readRange(1999, 5000).size());
+  TEST_ASSERT_EQUAL(0, readRange(2000, 5000).size());
+  TEST_ASSERT_EQUAL(0, readRange(1209, 1200).size());
+}
+
+/**
+ * @brief Collects the output of dump().
+ */
+class StringPrint : public Print {
+ public:
+  size_t write(uint8_t character) override {
+    text += static_cast<char>(character);
+    return 1;
+  }
+  using Print::write;
+
+  std::string text;
+};
+
+void test_dump() {
+  history->append(10, HistorySample{ 116, 93, true, false });
+  history->append(11, HistorySample{ 117, 60, false, true });
+  StringPrint output;
+  history->dump(output, 0, 100);
+  TEST_ASSERT_EQUAL_STRING("time_s,steam,hx,heating,pump\r\n10,116,93,1,0\n11,117,60,0,1\n", output.text.c_str());
+}
+
+int main(int argc, char **argv) {
+  UNITY_BEGIN();
+  RUN_TEST(test_empty);
+  RUN_TEST(test_round_trip_of_slow_changes);
+  RUN_TEST(test_round_trip_with_jumps_and_gaps);
+  RUN_TEST(test_every_temperature_change);
+  RUN_TEST(test_range);
+  RUN_TEST(test_dump);
+  return UNITY_END();
+}
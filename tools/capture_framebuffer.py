@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""Saves the content of the e-ink display of a running meter as PBM image.
+
+Sends the 'f' command via the serial port and stores the binary PBM (P4) the meter answers with. Log lines printed
+before the image are skipped. Needs pyserial (pip install pyserial).
+
+Usage: capture_framebuffer.py /dev/ttyUSB0 display.pbm
+"""
+import argparse
+import sys
+
+import serial
+
+BAUD_RATE = 115200
+HEADER = b"P4\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port", help="the serial port of the D1 mini")
+    parser.add_argument("output", help="the PBM file to write")
+    parser.add_argument("--timeout", type=float, default=10, help="seconds to wait for the image")
+    arguments = parser.parse_args()
+
+    with serial.Serial(arguments.port, BAUD_RATE, timeout=arguments.timeout) as port:
+        port.reset_input_buffer()
+        port.write(b"f")
+        received = port.read_until(HEADER)
+        if not received.endswith(HEADER):
+            sys.exit("No image received")
+        size = port.readline()
+        width, height = (int(value) for value in size.split())
+        image = port.read(width // 8 * height)
+        if len(image) != width // 8 * height:
+            sys.exit(f"Image incomplete: {len(image)} of {width // 8 * height} bytes")
+
+    with open(arguments.output, "wb") as file:
+        file.write(HEADER + size + image)
+    print(f"Saved {width}x{height} image to {arguments.output}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Compresses the boot screen bitmaps for lib/EInkHelper/bootscreen.h.
+
+The input is the "Arduino code" output of https://javl.github.io/image2cpp/ (400x300, horizontal, 1 bit per pixel),
+i.e. one or more `... NAME [] PROGMEM = { 0xff, ... };` arrays. Each array is PackBits compressed and written as
+array of the same name. Every compressed image is decoded again and compared to its input before anything is written.
+
+Usage: compress_bootscreen.py image2cpp_output.h [more.h ...] -o lib/EInkHelper/bootscreen.h
+"""
+import argparse
+import re
+import sys
+
+WIDTH = 400
+HEIGHT = 300
+IMAGE_SIZE = WIDTH // 8 * HEIGHT
+MAX_RUN = 128
+
+ARRAY_PATTERN = re.compile(r"(\w+)\s*\[\s*\]\s*PROGMEM\s*=\s*\{(.*?)\}\s*;", re.S)
+BYTE_PATTERN = re.compile(r"0x[0-9a-fA-F]{1,2}")
+
+
+def compress(data):
+    """PackBits: n < 128 is followed by n + 1 literal bytes, n > 128 by one byte repeated 257 - n times."""
+    output = bytearray()
+    literal = bytearray()
+    position = 0
+
+    def flush_literal():
+        if literal:
+            output.append(len(literal) - 1)
+            output.extend(literal)
+            literal.clear()
+
+    while position < len(data):
+        run = 1
+        while position + run < len(data) and run < MAX_RUN and data[position + run] == data[position]:
+            run += 1
+        # A run of two only pays off, if it does not split a literal.
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            output.append(257 - run)
+            output.append(data[position])
+            position += run
+        else:
+            literal.extend(data[position:position + run])
+            position += run
+            if len(literal) >= MAX_RUN:
+                output.append(MAX_RUN - 1)
+                output.extend(literal[:MAX_RUN])
+                del literal[:MAX_RUN]
+    flush_literal()
+    return bytes(output)
+
+
+def decompress(data):
+    output = bytearray()
+    position = 0
+    while position < len(data):
+        header = data[position]
+        position += 1
+        if header < 128:
+            output.extend(data[position:position + header + 1])
+            position += header + 1
+        elif header > 128:
+            output.extend(bytes([data[position]]) * (257 - header))
+            position += 1
+    return bytes(output)
+
+
+def read_images(paths):
+    images = []
+    for path in paths:
+        with open(path, encoding="utf-8") as file:
+            for name, body in ARRAY_PATTERN.findall(file.read()):
+                data = bytes(int(value, 16) for value in BYTE_PATTERN.findall(body))
+                if len(data) != IMAGE_SIZE:
+                    sys.exit(f"{path}: {name} has {len(data)} bytes, expected {IMAGE_SIZE} ({WIDTH}x{HEIGHT})")
+                images.append((name, data))
+    return images
+
+
+def to_header(compressed_images):
+    lines = [
+        "#pragma once",
+        "",
+        "#include <pgmspace.h>",
+        "// Generated by tools/compress_bootscreen.py from the output of https://javl.github.io/image2cpp/",
+        f"// {WIDTH}x{HEIGHT}, 1 bit per pixel, PackBits compressed. See PackBitsReader.",
+    ]
+    for name, data in compressed_images:
+        lines.append("")
+        lines.append(f"constexpr unsigned char {name}[] PROGMEM = {{")
+        for start in range(0, len(data), 19):
+            chunk = ", ".join(f"0x{value:02x}" for value in data[start:start + 19])
+            lines.append(f"  {chunk}{',' if start + 19 < len(data) else ''}")
+        lines.append("};")
+    return "\r\n".join(lines) + "\r\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("inputs", nargs="+", help="image2cpp output files")
+    parser.add_argument("-o", "--output", required=True, help="the header to write")
+    arguments = parser.parse_args()
+
+    compressed_images = []
+    for name, data in read_images(arguments.inputs):
+        compressed = compress(data)
+        if decompress(compressed) != data:
+            sys.exit(f"{name}: decoded image differs from the input")
+        print(f"{name}: {len(data)} -> {len(compressed)} bytes ({100 * len(compressed) / len(data):.1f} %)")
+        compressed_images.append((name, compressed))
+
+    with open(arguments.output, "w", encoding="utf-8", newline="") as file:
+        file.write(to_header(compressed_images))
+
+
+if __name__ == "__main__":
+    main()